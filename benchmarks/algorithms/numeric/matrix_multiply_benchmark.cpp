@@ -0,0 +1,133 @@
+#include <dsa/algorithms/numeric/matrix_multiply.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/matrices/matrix.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::matrices::Matrix;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t Size = 256;
+    constexpr double Flops = 2.0 * Size * Size * Size;
+
+    Matrix<float> makeMatrix(size_t seed)
+    {
+        Matrix<float> matrix(Size, Size);
+
+        for (size_t i = 0; i < matrix.getSize(); i++)
+        {
+            matrix.getData()[i] = static_cast<float>((i + seed) % 17) * 0.25f;
+        }
+
+        return matrix;
+    }
+
+    DynamicArray<DynamicArray<float>> makeNested(size_t seed)
+    {
+        DynamicArray<DynamicArray<float>> matrix(Size);
+
+        for (size_t i = 0; i < Size; i++)
+        {
+            matrix[i] = DynamicArray<float>(Size);
+
+            for (size_t j = 0; j < Size; j++)
+            {
+                matrix[i][j] = static_cast<float>((i * Size + j + seed) % 17) * 0.25f;
+            }
+        }
+
+        return matrix;
+    }
+}
+
+DSA_BENCHMARK(Matrix, NestedArraysMultiply256)
+{
+    DynamicArray<DynamicArray<float>> a = makeNested(1);
+    DynamicArray<DynamicArray<float>> b = makeNested(2);
+    DynamicArray<DynamicArray<float>> c = makeNested(0);
+
+    state.setFlopsPerOp(Flops);
+
+    while (state.keepRunning())
+    {
+        for (size_t i = 0; i < Size; i++)
+        {
+            for (size_t j = 0; j < Size; j++)
+            {
+                float sum = 0;
+
+                for (size_t p = 0; p < Size; p++)
+                {
+                    sum += a[i][p] * b[p][j];
+                }
+
+                c[i][j] = sum;
+            }
+        }
+
+        doNotOptimize(c[0].getData());
+    }
+}
+
+DSA_BENCHMARK(Matrix, BlockedMultiply256)
+{
+    Matrix<float> a = makeMatrix(1);
+    Matrix<float> b = makeMatrix(2);
+    Matrix<float> c(Size, Size);
+
+    state.setFlopsPerOp(Flops);
+
+    while (state.keepRunning())
+    {
+        dsa::algorithms::numeric::multiply(a.getData(), b.getData(), c.getData(), Size, Size, Size);
+        doNotOptimize(c.getData());
+    }
+}
+
+DSA_BENCHMARK(Matrix, ParallelMultiply256)
+{
+    Matrix<float> a = makeMatrix(1);
+    Matrix<float> b = makeMatrix(2);
+    Matrix<float> c(Size, Size);
+
+    state.setFlopsPerOp(Flops);
+
+    while (state.keepRunning())
+    {
+        dsa::algorithms::numeric::parallelMultiply(a.getData(), b.getData(), c.getData(), Size, Size, Size);
+        doNotOptimize(c.getData());
+    }
+}
+
+DSA_BENCHMARK(Matrix, NaiveTranspose1024)
+{
+    Matrix<float> input(1024, 1024);
+    Matrix<float> output(1024, 1024);
+
+    while (state.keepRunning())
+    {
+        for (size_t i = 0; i < 1024; i++)
+        {
+            for (size_t j = 0; j < 1024; j++)
+            {
+                output.getData()[j * 1024 + i] = input.getData()[i * 1024 + j];
+            }
+        }
+
+        doNotOptimize(output.getData());
+    }
+}
+
+DSA_BENCHMARK(Matrix, BlockedTranspose1024)
+{
+    Matrix<float> input(1024, 1024);
+    Matrix<float> output(1024, 1024);
+
+    while (state.keepRunning())
+    {
+        dsa::algorithms::numeric::transpose(input.getData(), 1024, 1024, output.getData());
+        doNotOptimize(output.getData());
+    }
+}
@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <dsa/algorithms/numeric/scan.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t ScanSize = 1 << 22;
+
+    DynamicArray<int32_t> makeInput()
+    {
+        DynamicArray<int32_t> input(ScanSize);
+
+        for (size_t i = 0; i < ScanSize; i++)
+        {
+            input[i] = static_cast<int32_t>(i % 17);
+        }
+
+        return input;
+    }
+
+    struct ScalarPlus
+    {
+        int32_t operator()(int32_t first, int32_t second) const
+        {
+            return first + second;
+        }
+    };
+}
+
+DSA_BENCHMARK(InclusiveScan, Simd4M)
+{
+    DynamicArray<int32_t> input = makeInput();
+    DynamicArray<int32_t> output(ScanSize);
+
+    while (state.keepRunning())
+    {
+        dsa::algorithms::numeric::inclusiveScan(input.getData(), ScanSize, output.getData());
+        doNotOptimize(output.getData());
+    }
+}
+
+DSA_BENCHMARK(InclusiveScan, Scalar4M)
+{
+    DynamicArray<int32_t> input = makeInput();
+    DynamicArray<int32_t> output(ScanSize);
+
+    while (state.keepRunning())
+    {
+        dsa::algorithms::numeric::inclusiveScan(input.getData(), ScanSize, output.getData(), ScalarPlus());
+        doNotOptimize(output.getData());
+    }
+}
+
+DSA_BENCHMARK(InclusiveScan, Parallel4M)
+{
+    DynamicArray<int32_t> input = makeInput();
+    DynamicArray<int32_t> output(ScanSize);
+
+    while (state.keepRunning())
+    {
+        dsa::algorithms::numeric::parallelInclusiveScan(input.getData(), ScanSize, output.getData());
+        doNotOptimize(output.getData());
+    }
+}
+
+DSA_BENCHMARK(StdInclusiveScan, Sequential4M)
+{
+    DynamicArray<int32_t> input = makeInput();
+    DynamicArray<int32_t> output(ScanSize);
+
+    while (state.keepRunning())
+    {
+        std::inclusive_scan(input.getData(), input.getData() + ScanSize, output.getData());
+        doNotOptimize(output.getData());
+    }
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <functional>
+#include <dsa/algorithms/searching/binary_search.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr int SearchSize = 1 << 20;
+
+    DynamicArray<int> makeSorted()
+    {
+        DynamicArray<int> sorted(SearchSize);
+
+        for (int i = 0; i < SearchSize; i++)
+        {
+            sorted[i] = i * 2;
+        }
+
+        return sorted;
+    }
+}
+
+DSA_BENCHMARK(BranchlessLowerBound, Search1M)
+{
+    DynamicArray<int> sorted = makeSorted();
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(dsa::algorithms::searching::branchlessLowerBound(sorted.getData(), sorted.getSize(), key, std::less<int>()));
+        key = (key + 7919) % (SearchSize * 2);
+    }
+}
+
+DSA_BENCHMARK(EytzingerLowerBound, Search1M)
+{
+    DynamicArray<int> sorted = makeSorted();
+    DynamicArray<int> layout(SearchSize);
+
+    dsa::algorithms::searching::eytzingerLayout(sorted.getData(), layout.getData(), layout.getSize());
+
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(dsa::algorithms::searching::eytzingerLowerBound(layout.getData(), layout.getSize(), key, std::less<int>()));
+        key = (key + 7919) % (SearchSize * 2);
+    }
+}
+
+DSA_BENCHMARK(StdLowerBound, Search1M)
+{
+    DynamicArray<int> sorted = makeSorted();
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(std::lower_bound(sorted.getData(), sorted.getData() + sorted.getSize(), key));
+        key = (key + 7919) % (SearchSize * 2);
+    }
+}
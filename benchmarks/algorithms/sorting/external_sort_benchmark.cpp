@@ -0,0 +1,43 @@
+#include <cstdint>
+#include <random>
+#include <dsa/algorithms/sorting/external_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::algorithms::sorting::ExternalSorter;
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t RecordCount = 200000;
+
+    void externalSortBenchmark(dsa::utility::benchmark::State& state, size_t memoryBudget)
+    {
+        DynamicArray<uint32_t> input(RecordCount);
+        std::mt19937 random(1);
+
+        for (size_t i = 0; i < RecordCount; i++)
+        {
+            input[i] = static_cast<uint32_t>(random());
+        }
+
+        while (state.keepRunning())
+        {
+            ExternalSorter<uint32_t> sorter(memoryBudget);
+            uint64_t checksum = 0;
+
+            for (size_t i = 0; i < RecordCount; i++)
+            {
+                sorter.add(input.getData()[i]);
+            }
+
+            sorter.finish([&](const uint32_t& value) { checksum = checksum * 31 + value; });
+
+            doNotOptimize(checksum);
+        }
+    }
+}
+
+DSA_BENCHMARK(ExternalSort, InMemory200000) { externalSortBenchmark(state, RecordCount * sizeof(uint32_t)); }
+DSA_BENCHMARK(ExternalSort, Budget64KB200000) { externalSortBenchmark(state, 64 * 1024); }
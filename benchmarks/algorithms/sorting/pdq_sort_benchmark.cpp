@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <random>
+#include <dsa/algorithms/sorting/pdq_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t SortSize = 100000;
+
+    enum class Distribution
+    {
+        Random,
+        Sorted,
+        Reversed,
+        FewUnique
+    };
+
+    DynamicArray<int> makeInput(Distribution distribution)
+    {
+        DynamicArray<int> data(SortSize);
+        std::mt19937 random(1);
+
+        for (size_t i = 0; i < SortSize; i++)
+        {
+            switch (distribution)
+            {
+                case Distribution::Random: data[i] = static_cast<int>(random()); break;
+                case Distribution::Sorted: data[i] = static_cast<int>(i); break;
+                case Distribution::Reversed: data[i] = static_cast<int>(SortSize - i); break;
+                case Distribution::FewUnique: data[i] = static_cast<int>(random() % 16); break;
+            }
+        }
+
+        return data;
+    }
+
+    template<bool UsePdqSort>
+    void sortBenchmark(dsa::utility::benchmark::State& state, Distribution distribution)
+    {
+        DynamicArray<int> input = makeInput(distribution);
+        DynamicArray<int> data(SortSize);
+
+        while (state.keepRunning())
+        {
+            std::copy(input.getData(), input.getData() + SortSize, data.getData());
+
+            if constexpr (UsePdqSort)
+                dsa::algorithms::sorting::pdqSort(data);
+            else
+                std::sort(data.getData(), data.getData() + SortSize);
+
+            doNotOptimize(data.getData());
+        }
+    }
+}
+
+DSA_BENCHMARK(PdqSort, Random100000) { sortBenchmark<true>(state, Distribution::Random); }
+DSA_BENCHMARK(StdSort, Random100000) { sortBenchmark<false>(state, Distribution::Random); }
+DSA_BENCHMARK(PdqSort, Sorted100000) { sortBenchmark<true>(state, Distribution::Sorted); }
+DSA_BENCHMARK(StdSort, Sorted100000) { sortBenchmark<false>(state, Distribution::Sorted); }
+DSA_BENCHMARK(PdqSort, Reversed100000) { sortBenchmark<true>(state, Distribution::Reversed); }
+DSA_BENCHMARK(StdSort, Reversed100000) { sortBenchmark<false>(state, Distribution::Reversed); }
+DSA_BENCHMARK(PdqSort, FewUnique100000) { sortBenchmark<true>(state, Distribution::FewUnique); }
+DSA_BENCHMARK(StdSort, FewUnique100000) { sortBenchmark<false>(state, Distribution::FewUnique); }
@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <vector>
+#include <dsa/structures/arrays/bit_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::BitArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+DSA_BENCHMARK(BitArray, Popcount65536)
+{
+    BitArray bits(65536);
+
+    for (size_t i = 0; i < bits.getSize(); i += 3)
+    {
+        bits.set(i);
+    }
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(bits.popcount());
+    }
+}
+
+DSA_BENCHMARK(StdVectorBool, Count65536)
+{
+    std::vector<bool> bits(65536);
+
+    for (size_t i = 0; i < bits.size(); i += 3)
+    {
+        bits[i] = true;
+    }
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(std::count(bits.begin(), bits.end(), true));
+    }
+}
+
+DSA_BENCHMARK(BitArray, And65536)
+{
+    BitArray left(65536, true);
+    BitArray right(65536);
+
+    while (state.keepRunning())
+    {
+        left &= right;
+        doNotOptimize(left);
+    }
+}
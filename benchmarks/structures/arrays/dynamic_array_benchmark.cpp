@@ -0,0 +1,176 @@
+#include <vector>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/cow_dynamic_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::CowDynamicArray;
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    struct Record
+    {
+        int id;
+        float position[3];
+        double weight;
+    };
+}
+
+DSA_BENCHMARK(DynamicArray, AddLast100)
+{
+    while (state.keepRunning())
+    {
+        DynamicArray<int> arr;
+
+        for (int i = 0; i < 100; i++)
+        {
+            arr.addLast(i);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(StdVector, PushBack100)
+{
+    while (state.keepRunning())
+    {
+        std::vector<int> vector;
+
+        for (int i = 0; i < 100; i++)
+        {
+            vector.push_back(i);
+        }
+
+        doNotOptimize(vector.data());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, Copy10000)
+{
+    DynamicArray<int> source(10000);
+
+    while (state.keepRunning())
+    {
+        DynamicArray<int> copy(source);
+        doNotOptimize(copy.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, CopyRecords10000)
+{
+    DynamicArray<Record> source(10000);
+
+    while (state.keepRunning())
+    {
+        DynamicArray<Record> copy(source);
+        doNotOptimize(copy.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, AddFirst100)
+{
+    while (state.keepRunning())
+    {
+        DynamicArray<int> arr;
+
+        for (int i = 0; i < 100; i++)
+        {
+            arr.addFirst(i);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, RemoveAtRecords1000)
+{
+    DynamicArray<Record> source(1000);
+
+    while (state.keepRunning())
+    {
+        DynamicArray<Record> arr(source);
+
+        while (arr.getSize() > 1)
+        {
+            arr.removeAt(arr.getSize() / 2);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, RemoveIfHalf10000)
+{
+    DynamicArray<int> source(10000);
+
+    for (size_t i = 0; i < source.getSize(); i++)
+    {
+        source[i] = static_cast<int>(i);
+    }
+
+    while (state.keepRunning())
+    {
+        DynamicArray<int> arr(source);
+        arr.removeIf([](const int& value) { return value % 2 == 0; });
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, SwapRemoveRecords1000)
+{
+    DynamicArray<Record> source(1000);
+
+    while (state.keepRunning())
+    {
+        DynamicArray<Record> arr(source);
+
+        while (arr.getSize() > 1)
+        {
+            arr.swapRemove(arr.getSize() / 2);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, Iterate10000)
+{
+    DynamicArray<int> arr(10000);
+
+    while (state.keepRunning())
+    {
+        long long sum = 0;
+
+        for (int value : arr)
+        {
+            sum += value;
+        }
+
+        doNotOptimize(sum);
+    }
+}
+
+DSA_BENCHMARK(CowDynamicArray, Copy10000)
+{
+    CowDynamicArray<int> source(DynamicArray<int>(10000));
+
+    while (state.keepRunning())
+    {
+        CowDynamicArray<int> copy(source);
+        doNotOptimize(copy.getData());
+    }
+}
+
+DSA_BENCHMARK(CowDynamicArray, CopyAndWrite10000)
+{
+    CowDynamicArray<int> source(DynamicArray<int>(10000));
+
+    while (state.keepRunning())
+    {
+        CowDynamicArray<int> copy(source);
+        copy.set(0, 1);
+        doNotOptimize(copy.getData());
+    }
+}
@@ -0,0 +1,64 @@
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/expressions.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::assign;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t Size = 1024;
+
+    DynamicArray<float> makeInput(float seed)
+    {
+        DynamicArray<float> array(Size);
+
+        for (size_t i = 0; i < Size; i++)
+        {
+            array[i] = seed + static_cast<float>(i % 17);
+        }
+
+        return array;
+    }
+}
+
+DSA_BENCHMARK(Expressions, FusedMultiplyAdd1024)
+{
+    DynamicArray<float> a = makeInput(1.0f);
+    DynamicArray<float> b = makeInput(2.0f);
+    DynamicArray<float> c = makeInput(3.0f);
+    DynamicArray<float> result(Size);
+
+    while (state.keepRunning())
+    {
+        assign(result, a + b * c);
+        doNotOptimize(result.getData());
+    }
+}
+
+DSA_BENCHMARK(Expressions, TemporariesMultiplyAdd1024)
+{
+    DynamicArray<float> a = makeInput(1.0f);
+    DynamicArray<float> b = makeInput(2.0f);
+    DynamicArray<float> c = makeInput(3.0f);
+
+    while (state.keepRunning())
+    {
+        DynamicArray<float> product(Size);
+
+        for (size_t i = 0; i < Size; i++)
+        {
+            product[i] = b[i] * c[i];
+        }
+
+        DynamicArray<float> result(Size);
+
+        for (size_t i = 0; i < Size; i++)
+        {
+            result[i] = a[i] + product[i];
+        }
+
+        doNotOptimize(result.getData());
+    }
+}
@@ -0,0 +1,53 @@
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/inplace_vector.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::InplaceVector;
+using dsa::utility::benchmark::doNotOptimize;
+
+DSA_BENCHMARK(InplaceVector, AddLast32)
+{
+    while (state.keepRunning())
+    {
+        InplaceVector<int, 32> arr;
+
+        for (int i = 0; i < 32; i++)
+        {
+            arr.addLast(i);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, AddLast32)
+{
+    while (state.keepRunning())
+    {
+        DynamicArray<int> arr;
+
+        for (int i = 0; i < 32; i++)
+        {
+            arr.addLast(i);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, ReserveAddLast32)
+{
+    while (state.keepRunning())
+    {
+        DynamicArray<int> arr;
+        arr.reserve(32);
+
+        for (int i = 0; i < 32; i++)
+        {
+            arr.addLast(i);
+        }
+
+        doNotOptimize(arr.getData());
+    }
+}
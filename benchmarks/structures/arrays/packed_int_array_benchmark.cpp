@@ -0,0 +1,104 @@
+#include <cstdint>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/packed_int_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::PackedIntArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t Size = 1 << 20;
+
+    DynamicArray<uint32_t> makeSortedIds()
+    {
+        DynamicArray<uint32_t> ids(Size);
+        uint32_t id = 1000;
+        uint32_t state = 12345;
+
+        for (size_t i = 0; i < Size; i++)
+        {
+            state = state * 1664525u + 1013904223u;
+            id += 1 + (state >> 27);
+            ids[i] = id;
+        }
+
+        return ids;
+    }
+}
+
+DSA_BENCHMARK(PackedIntArray, EncodeSortedIds1M)
+{
+    DynamicArray<uint32_t> ids = makeSortedIds();
+
+    state.setBytesProcessedPerOp(Size * sizeof(uint32_t));
+
+    while (state.keepRunning())
+    {
+        PackedIntArray packed(ids);
+        doNotOptimize(packed.getCompressedBytes());
+    }
+}
+
+DSA_BENCHMARK(PackedIntArray, DecodeSortedIds1M)
+{
+    PackedIntArray packed(makeSortedIds());
+    DynamicArray<uint32_t> output(Size);
+
+    state.setBytesProcessedPerOp(Size * sizeof(uint32_t));
+    state.setCounter("compressionRatio", packed.getCompressionRatio());
+
+    while (state.keepRunning())
+    {
+        packed.decode(output.getData());
+        doNotOptimize(output.getData());
+    }
+}
+
+DSA_BENCHMARK(PackedIntArray, SumSortedIds1M)
+{
+    PackedIntArray packed(makeSortedIds());
+
+    state.setBytesProcessedPerOp(Size * sizeof(uint32_t));
+
+    while (state.keepRunning())
+    {
+        uint64_t sum = 0;
+
+        packed.forEach([&sum](uint32_t value) { sum += value; });
+        doNotOptimize(sum);
+    }
+}
+
+DSA_BENCHMARK(PackedIntArray, RawSumSortedIds1M)
+{
+    DynamicArray<uint32_t> ids = makeSortedIds();
+
+    state.setBytesProcessedPerOp(Size * sizeof(uint32_t));
+
+    while (state.keepRunning())
+    {
+        uint64_t sum = 0;
+        const uint32_t* data = ids.getData();
+
+        for (size_t i = 0; i < Size; i++)
+        {
+            sum += data[i];
+        }
+
+        doNotOptimize(sum);
+    }
+}
+
+DSA_BENCHMARK(PackedIntArray, RandomGet1M)
+{
+    PackedIntArray packed(makeSortedIds());
+    size_t index = 0;
+
+    while (state.keepRunning())
+    {
+        index = (index * 2654435761u + 1) % Size;
+        doNotOptimize(packed.get(index));
+    }
+}
@@ -0,0 +1,61 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <dsa/structures/arrays/per_thread_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::PerThreadArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t ContentionThreads = 4;
+    constexpr uint64_t IncrementsPerThread = 20000;
+
+    /**
+     * @brief Lets every thread increment its own counter and waits for all of them.
+     */
+    template<typename Counters>
+    void incrementConcurrently(Counters& counters)
+    {
+        std::thread threads[ContentionThreads];
+
+        for (size_t t = 0; t < ContentionThreads; t++)
+        {
+            threads[t] = std::thread([&counters, t]()
+            {
+                for (uint64_t i = 0; i < IncrementsPerThread; i++)
+                {
+                    counters[t].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+DSA_BENCHMARK(PackedCounters, Increment4Threads)
+{
+    while (state.keepRunning())
+    {
+        std::atomic<uint64_t> counters[ContentionThreads] = {};
+
+        incrementConcurrently(counters);
+        doNotOptimize(counters[0].load());
+    }
+}
+
+DSA_BENCHMARK(PerThreadArray, Increment4Threads)
+{
+    while (state.keepRunning())
+    {
+        PerThreadArray<std::atomic<uint64_t>> counters(ContentionThreads);
+
+        incrementConcurrently(counters);
+        doNotOptimize(counters[0].load());
+    }
+}
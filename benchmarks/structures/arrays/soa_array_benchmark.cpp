@@ -0,0 +1,60 @@
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/soa_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::SoAArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    struct Particle
+    {
+        double x;
+        double y;
+        double z;
+        double mass;
+    };
+}
+
+DSA_BENCHMARK(SoAArray, SumColumn10000)
+{
+    SoAArray<double, double, double, double> particles;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        particles.addLast(i, i, i, i);
+    }
+
+    while (state.keepRunning())
+    {
+        auto mass = particles.column<3>();
+        const double* data = mass.getData();
+        double sum = 0;
+
+        for (size_t i = 0; i < mass.getSize(); i++)
+        {
+            sum += data[i];
+        }
+
+        doNotOptimize(sum);
+    }
+}
+
+DSA_BENCHMARK(AoSArray, SumField10000)
+{
+    DynamicArray<Particle> particles(10000);
+
+    while (state.keepRunning())
+    {
+        const Particle* data = particles.getData();
+        double sum = 0;
+
+        for (size_t i = 0; i < particles.getSize(); i++)
+        {
+            sum += data[i].mass;
+        }
+
+        doNotOptimize(sum);
+    }
+}
@@ -0,0 +1,25 @@
+#include <dsa/structures/arrays/static_array.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::StaticArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+DSA_BENCHMARK(StaticArray, Construct64)
+{
+    while (state.keepRunning())
+    {
+        StaticArray<int, 64> arr;
+        doNotOptimize(arr.getSize());
+    }
+}
+
+DSA_BENCHMARK(StaticArray, Copy1024)
+{
+    StaticArray<int, 1024> source;
+
+    while (state.keepRunning())
+    {
+        StaticArray<int, 1024> copy(source);
+        doNotOptimize(copy.get(0));
+    }
+}
@@ -0,0 +1,139 @@
+#include <map>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/associative/btree_map.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::associative::BTreeMap;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr int MapSize = 100000;
+    constexpr int RangeLength = 1000;
+
+    DynamicArray<std::pair<int, int>> makeEntries()
+    {
+        DynamicArray<std::pair<int, int>> entries(MapSize);
+
+        for (int i = 0; i < MapSize; i++)
+        {
+            entries[i] = std::pair<int, int>(i * 2, i);
+        }
+
+        return entries;
+    }
+
+    BTreeMap<int, int> makeBTreeMap()
+    {
+        BTreeMap<int, int> map;
+
+        map.bulkLoad(makeEntries());
+
+        return map;
+    }
+
+    std::map<int, int> makeStdMap()
+    {
+        std::map<int, int> map;
+
+        for (int i = 0; i < MapSize; i++)
+        {
+            map[i * 2] = i;
+        }
+
+        return map;
+    }
+}
+
+DSA_BENCHMARK(BTreeMap, Find100000)
+{
+    BTreeMap<int, int> map = makeBTreeMap();
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(map.find(key));
+        key = (key + 7919) % (MapSize * 2);
+    }
+}
+
+DSA_BENCHMARK(BTreeMap, RangeScan1000)
+{
+    BTreeMap<int, int> map = makeBTreeMap();
+    int from = 0;
+
+    while (state.keepRunning())
+    {
+        long long sum = 0;
+
+        map.forEachInRange(from, from + RangeLength * 2, [&sum](const int&, int& value) {
+            sum += value;
+        });
+
+        doNotOptimize(sum);
+        from = (from + 7919 * 2) % ((MapSize - RangeLength) * 2);
+    }
+}
+
+DSA_BENCHMARK(StdMap, RangeScan1000)
+{
+    std::map<int, int> map = makeStdMap();
+    int from = 0;
+
+    while (state.keepRunning())
+    {
+        long long sum = 0;
+        auto last = map.lower_bound(from + RangeLength * 2);
+
+        for (auto iterator = map.lower_bound(from); iterator != last; ++iterator)
+        {
+            sum += iterator->second;
+        }
+
+        doNotOptimize(sum);
+        from = (from + 7919 * 2) % ((MapSize - RangeLength) * 2);
+    }
+}
+
+DSA_BENCHMARK(BTreeMap, Insert100000)
+{
+    while (state.keepRunning())
+    {
+        BTreeMap<int, int> map;
+
+        for (int i = 0; i < MapSize; i++)
+        {
+            map.insert((i * 7919) % MapSize, i);
+        }
+
+        doNotOptimize(map.getSize());
+    }
+}
+
+DSA_BENCHMARK(StdMap, Insert100000)
+{
+    while (state.keepRunning())
+    {
+        std::map<int, int> map;
+
+        for (int i = 0; i < MapSize; i++)
+        {
+            map[(i * 7919) % MapSize] = i;
+        }
+
+        doNotOptimize(map.size());
+    }
+}
+
+DSA_BENCHMARK(BTreeMap, BulkLoad100000)
+{
+    while (state.keepRunning())
+    {
+        BTreeMap<int, int> map;
+
+        map.bulkLoad(makeEntries());
+        doNotOptimize(map.getSize());
+    }
+}
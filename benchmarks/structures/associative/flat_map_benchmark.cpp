@@ -0,0 +1,71 @@
+#include <functional>
+#include <map>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/associative/flat_map.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::associative::FlatLayout;
+using dsa::structures::associative::FlatMap;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr int MapSize = 100000;
+
+    template<FlatLayout Layout>
+    FlatMap<int, int, std::less<int>, Layout> makeFlatMap()
+    {
+        DynamicArray<std::pair<int, int>> entries(MapSize);
+
+        for (int i = 0; i < MapSize; i++)
+        {
+            entries[i] = std::pair<int, int>(i * 2, i);
+        }
+
+        return FlatMap<int, int, std::less<int>, Layout>(std::move(entries));
+    }
+}
+
+DSA_BENCHMARK(FlatMap, Find100000)
+{
+    auto map = makeFlatMap<FlatLayout::Sorted>();
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(map.find(key));
+        key = (key + 7919) % (MapSize * 2);
+    }
+}
+
+DSA_BENCHMARK(EytzingerFlatMap, Find100000)
+{
+    auto map = makeFlatMap<FlatLayout::Eytzinger>();
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(map.find(key));
+        key = (key + 7919) % (MapSize * 2);
+    }
+}
+
+DSA_BENCHMARK(StdMap, Find100000)
+{
+    std::map<int, int> map;
+
+    for (int i = 0; i < MapSize; i++)
+    {
+        map[i * 2] = i;
+    }
+
+    int key = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(map.find(key));
+        key = (key + 7919) % (MapSize * 2);
+    }
+}
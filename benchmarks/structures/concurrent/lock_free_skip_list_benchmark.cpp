@@ -0,0 +1,161 @@
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/concurrent/lock_free_skip_list.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::concurrent::LockFreeSkipList;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr int KeyRange = 20000;
+    constexpr int TotalOperations = 40000;
+
+    /**
+     * @brief std::map behind single mutex, the usual alternative to a concurrent ordered map.
+     */
+    class MutexMap
+    {
+        private:
+            std::map<int, int> mMap;
+            std::mutex mMutex;
+
+        public:
+            bool insert(int key, int value)
+            {
+                std::lock_guard<std::mutex> lock(this->mMutex);
+                return this->mMap.emplace(key, value).second;
+            }
+
+            bool erase(int key)
+            {
+                std::lock_guard<std::mutex> lock(this->mMutex);
+                return this->mMap.erase(key) == 1;
+            }
+
+            bool contains(int key)
+            {
+                std::lock_guard<std::mutex> lock(this->mMutex);
+                return this->mMap.count(key) == 1;
+            }
+    };
+
+    /**
+     * @brief Splits fixed number of operations among threads.
+     *
+     * With writes, 80 % of operations are lookups, 10 % inserts and 10 % erases. Which inserts and
+     * erases succeed then depends on interleaving of threads, and so does the number of allocated
+     * nodes, so only single thread runs mix in writes and multi-threaded runs are lookups only.
+     */
+    template<typename Map>
+    void runOperations(Map& map, int threadCount, bool withWrites)
+    {
+        DynamicArray<std::thread> threads(threadCount - 1);
+        auto work = [&map, threadCount, withWrites](int thread) {
+            uint64_t state = 0x9E3779B97F4A7C15ull * (thread + 1);
+
+            for (int i = 0; i < TotalOperations / threadCount; i++)
+            {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                int key = static_cast<int>(state % KeyRange);
+                uint64_t choice = withWrites ? (state >> 32) % 10 : 2;
+
+                if (choice == 0)
+                    doNotOptimize(map.insert(key, key));
+                else if (choice == 1)
+                    doNotOptimize(map.erase(key));
+                else
+                    doNotOptimize(map.contains(key));
+            }
+        };
+
+        for (int t = 1; t < threadCount; t++)
+        {
+            threads[t - 1] = std::thread(work, t);
+        }
+
+        work(0);
+
+        for (int t = 1; t < threadCount; t++)
+        {
+            threads[t - 1].join();
+        }
+    }
+
+    template<typename Map>
+    void benchmarkOperations(dsa::utility::benchmark::State& state, int threadCount, bool withWrites)
+    {
+        Map map;
+
+        for (int key = 0; key < KeyRange; key += 2)
+        {
+            map.insert(key, key);
+        }
+
+        state.setCounter("threads", threadCount);
+
+        while (state.keepRunning())
+        {
+            runOperations(map, threadCount, withWrites);
+        }
+    }
+}
+
+DSA_BENCHMARK(LockFreeSkipList, Mixed40000Ops1Thread)
+{
+    // Tower heights are random, so bytes of inserted nodes differ from run to run.
+    state.setDeterministicAllocations(false);
+    benchmarkOperations<LockFreeSkipList<int, int>>(state, 1, true);
+}
+
+DSA_BENCHMARK(LockFreeSkipList, Lookup40000Ops1Thread)
+{
+    benchmarkOperations<LockFreeSkipList<int, int>>(state, 1, false);
+}
+
+DSA_BENCHMARK(LockFreeSkipList, Lookup40000Ops2Threads)
+{
+    benchmarkOperations<LockFreeSkipList<int, int>>(state, 2, false);
+}
+
+DSA_BENCHMARK(LockFreeSkipList, Lookup40000Ops4Threads)
+{
+    benchmarkOperations<LockFreeSkipList<int, int>>(state, 4, false);
+}
+
+DSA_BENCHMARK(LockFreeSkipList, Lookup40000Ops8Threads)
+{
+    benchmarkOperations<LockFreeSkipList<int, int>>(state, 8, false);
+}
+
+DSA_BENCHMARK(MutexMap, Mixed40000Ops1Thread)
+{
+    benchmarkOperations<MutexMap>(state, 1, true);
+}
+
+DSA_BENCHMARK(MutexMap, Lookup40000Ops1Thread)
+{
+    benchmarkOperations<MutexMap>(state, 1, false);
+}
+
+DSA_BENCHMARK(MutexMap, Lookup40000Ops2Threads)
+{
+    benchmarkOperations<MutexMap>(state, 2, false);
+}
+
+DSA_BENCHMARK(MutexMap, Lookup40000Ops4Threads)
+{
+    benchmarkOperations<MutexMap>(state, 4, false);
+}
+
+DSA_BENCHMARK(MutexMap, Lookup40000Ops8Threads)
+{
+    benchmarkOperations<MutexMap>(state, 8, false);
+}
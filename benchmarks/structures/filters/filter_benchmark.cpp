@@ -0,0 +1,152 @@
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/filters/bloom_filter.h>
+#include <dsa/structures/filters/cuckoo_filter.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::filters::BloomFilter;
+using dsa::structures::filters::CuckooFilter;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr uint64_t KeyCount = 1 << 20;
+    constexpr size_t LookupBatch = 1024;
+    constexpr double FalsePositiveRate = 0.01;
+
+    /**
+     * @brief Inserts even keys, half of probed keys are then present.
+     */
+    template<typename Filter>
+    void fill(Filter& filter)
+    {
+        for (uint64_t i = 0; i < KeyCount; i++)
+        {
+            filter.insert(i * 2);
+        }
+    }
+
+    /**
+     * @brief Creates batch of probe keys spread over the whole key range.
+     */
+    DynamicArray<uint64_t> makeProbes()
+    {
+        DynamicArray<uint64_t> probes(LookupBatch);
+
+        for (size_t i = 0; i < LookupBatch; i++)
+        {
+            probes[i] = (i * 2654435761ULL) % (KeyCount * 2);
+        }
+
+        return probes;
+    }
+
+    /**
+     * @brief Reports size and measured false positive rate of filled filter.
+     */
+    template<typename Filter>
+    void reportAccuracy(dsa::utility::benchmark::State& state, const Filter& filter)
+    {
+        uint64_t falsePositives = 0;
+
+        for (uint64_t i = 0; i < 100000; i++)
+        {
+            falsePositives += filter.contains(i * 2 + 1);
+        }
+
+        state.setCounter("bitsPerKey", filter.getBitsPerKey());
+        state.setCounter("falsePositiveRate", falsePositives / 100000.0);
+    }
+
+    template<typename Filter>
+    void benchmarkContains(dsa::utility::benchmark::State& state, const Filter& filter)
+    {
+        DynamicArray<uint64_t> probes = makeProbes();
+
+        reportAccuracy(state, filter);
+
+        while (state.keepRunning())
+        {
+            size_t positives = 0;
+
+            for (size_t i = 0; i < LookupBatch; i++)
+            {
+                positives += filter.contains(probes[i]);
+            }
+
+            doNotOptimize(positives);
+        }
+    }
+
+    template<typename Filter>
+    void benchmarkContainsMany(dsa::utility::benchmark::State& state, const Filter& filter)
+    {
+        DynamicArray<uint64_t> probes = makeProbes();
+        std::unique_ptr<bool[]> results(new bool[LookupBatch]);
+
+        reportAccuracy(state, filter);
+
+        while (state.keepRunning())
+        {
+            doNotOptimize(filter.containsMany(probes.getData(), LookupBatch, results.get()));
+        }
+    }
+}
+
+DSA_BENCHMARK(BloomFilter, Contains1024Of1M)
+{
+    BloomFilter<uint64_t> filter(KeyCount, FalsePositiveRate);
+
+    fill(filter);
+    benchmarkContains(state, filter);
+}
+
+DSA_BENCHMARK(BloomFilter, ContainsMany1024Of1M)
+{
+    BloomFilter<uint64_t> filter(KeyCount, FalsePositiveRate);
+
+    fill(filter);
+    benchmarkContainsMany(state, filter);
+}
+
+DSA_BENCHMARK(CuckooFilter, Contains1024Of1M)
+{
+    CuckooFilter<uint64_t> filter(KeyCount, FalsePositiveRate);
+
+    fill(filter);
+    benchmarkContains(state, filter);
+}
+
+DSA_BENCHMARK(CuckooFilter, ContainsMany1024Of1M)
+{
+    CuckooFilter<uint64_t> filter(KeyCount, FalsePositiveRate);
+
+    fill(filter);
+    benchmarkContainsMany(state, filter);
+}
+
+DSA_BENCHMARK(UnorderedSet, Contains1024Of1M)
+{
+    std::unordered_set<uint64_t> set;
+    DynamicArray<uint64_t> probes = makeProbes();
+
+    for (uint64_t i = 0; i < KeyCount; i++)
+    {
+        set.insert(i * 2);
+    }
+
+    while (state.keepRunning())
+    {
+        size_t positives = 0;
+
+        for (size_t i = 0; i < LookupBatch; i++)
+        {
+            positives += set.count(probes[i]);
+        }
+
+        doNotOptimize(positives);
+    }
+}
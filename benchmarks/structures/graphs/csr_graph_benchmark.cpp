@@ -0,0 +1,113 @@
+#include <cstdint>
+#include <random>
+#include <dsa/algorithms/graphs/breadth_first_search.h>
+#include <dsa/algorithms/graphs/connected_components.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::algorithms::graphs::breadthFirstSearch;
+using dsa::algorithms::graphs::connectedComponents;
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::graphs::CsrGraph;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t VertexCount = 1 << 18;
+    constexpr size_t EdgeCount = 1 << 20;
+
+    /**
+     * @brief Creates uniformly random edge list.
+     */
+    DynamicArray<CsrGraph::EdgeType> makeEdges()
+    {
+        std::mt19937 random(42);
+        DynamicArray<CsrGraph::EdgeType> edges(EdgeCount);
+
+        for (size_t i = 0; i < EdgeCount; i++)
+        {
+            edges[i] = CsrGraph::EdgeType(random() % VertexCount, random() % VertexCount);
+        }
+
+        return edges;
+    }
+
+    /**
+     * @brief Reports size of graph.
+     */
+    void reportGraph(dsa::utility::benchmark::State& state, const CsrGraph& graph)
+    {
+        state.setCounter("edges", static_cast<double>(graph.getEdgeCount()));
+        state.setCounter("bytesPerEdge", static_cast<double>(graph.getMemoryBytes()) / graph.getEdgeCount());
+    }
+
+    /**
+     * @brief Copies undirected graph into directed one with the same edges, which breadth-first search explores top-down only.
+     */
+    CsrGraph makeSymmetricDirected(const CsrGraph& graph)
+    {
+        DynamicArray<CsrGraph::EdgeType> edges;
+        edges.reserve(graph.getEdgeCount());
+
+        for (size_t v = 0; v < graph.getVertexCount(); v++)
+        {
+            for (size_t i = 0; i < graph.getDegree(v); i++)
+            {
+                edges.addLast(CsrGraph::EdgeType(static_cast<uint32_t>(v), graph.getNeighbors(v)[i]));
+            }
+        }
+
+        return CsrGraph(graph.getVertexCount(), edges);
+    }
+}
+
+DSA_BENCHMARK(CsrGraph, Build1MEdges)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = makeEdges();
+
+    reportGraph(state, CsrGraph(VertexCount, edges));
+
+    while (state.keepRunning())
+    {
+        CsrGraph graph(VertexCount, edges);
+        doNotOptimize(graph);
+    }
+}
+
+DSA_BENCHMARK(CsrGraph, BreadthFirstSearchTopDown1MEdges)
+{
+    CsrGraph graph(VertexCount, makeEdges(), true);
+    CsrGraph directed = makeSymmetricDirected(graph);
+
+    reportGraph(state, graph);
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(breadthFirstSearch(directed, 0));
+    }
+}
+
+DSA_BENCHMARK(CsrGraph, BreadthFirstSearchDirectionOptimizing1MEdges)
+{
+    CsrGraph graph(VertexCount, makeEdges(), true);
+
+    reportGraph(state, graph);
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(breadthFirstSearch(graph, 0));
+    }
+}
+
+DSA_BENCHMARK(CsrGraph, ConnectedComponents1MEdges)
+{
+    CsrGraph graph(VertexCount, makeEdges(), true);
+
+    reportGraph(state, graph);
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(connectedComponents(graph));
+    }
+}
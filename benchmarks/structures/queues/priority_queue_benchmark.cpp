@@ -0,0 +1,81 @@
+#include <functional>
+#include <queue>
+#include <vector>
+#include <dsa/structures/queues/priority_queue.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::queues::PriorityQueue;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    int pseudoRandom(int i)
+    {
+        return static_cast<int>((static_cast<unsigned>(i) * 2654435761u) >> 8);
+    }
+}
+
+DSA_BENCHMARK(PriorityQueue, PushPop1000)
+{
+    PriorityQueue<int> queue;
+    queue.reserve(1000);
+
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            queue.push(pseudoRandom(i));
+        }
+
+        while (!queue.isEmpty())
+        {
+            queue.pop();
+        }
+
+        doNotOptimize(queue.getSize());
+    }
+}
+
+DSA_BENCHMARK(QuaternaryPriorityQueue, PushPop1000)
+{
+    PriorityQueue<int, std::less<int>, 4> queue;
+    queue.reserve(1000);
+
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            queue.push(pseudoRandom(i));
+        }
+
+        while (!queue.isEmpty())
+        {
+            queue.pop();
+        }
+
+        doNotOptimize(queue.getSize());
+    }
+}
+
+DSA_BENCHMARK(StdPriorityQueue, PushPop1000)
+{
+    std::vector<int> storage;
+    storage.reserve(1000);
+
+    std::priority_queue<int, std::vector<int>, std::greater<int>> queue(std::greater<int>(), std::move(storage));
+
+    while (state.keepRunning())
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            queue.push(pseudoRandom(i));
+        }
+
+        while (!queue.empty())
+        {
+            queue.pop();
+        }
+
+        doNotOptimize(queue.size());
+    }
+}
@@ -0,0 +1,113 @@
+#include <map>
+#include <string>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/trees/radix_tree.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::trees::RadixTree;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t KeyCount = 100000;
+
+    /**
+     * @brief Builds URL-like keys sharing long prefixes, in pseudo-random order.
+     */
+    DynamicArray<std::string> makeKeys()
+    {
+        DynamicArray<std::string> keys(KeyCount);
+        uint32_t state = 2463534242u;
+
+        for (size_t i = 0; i < KeyCount; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            keys[i] = "https://example.com/users/" + std::to_string(state % 1000) + "/items/" + std::to_string(state);
+        }
+
+        return keys;
+    }
+}
+
+DSA_BENCHMARK(RadixTree, Lookup100K)
+{
+    DynamicArray<std::string> keys = makeKeys();
+    RadixTree<uint32_t> tree;
+    size_t keyBytes = 0;
+
+    for (size_t i = 0; i < KeyCount; i++)
+    {
+        tree.insert(keys[i], static_cast<uint32_t>(i));
+        keyBytes += keys[i].size();
+    }
+
+    state.setCounter("bytesPerKey", static_cast<double>(tree.getMemoryUsage()) / tree.getSize());
+    state.setCounter("keyBytesPerKey", static_cast<double>(keyBytes) / KeyCount);
+
+    size_t index = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(tree.find(keys[index]));
+        index = index + 1 == KeyCount ? 0 : index + 1;
+    }
+}
+
+DSA_BENCHMARK(RadixTree, StdMapLookup100K)
+{
+    DynamicArray<std::string> keys = makeKeys();
+    std::map<std::string, uint32_t> map;
+
+    for (size_t i = 0; i < KeyCount; i++)
+    {
+        map[keys[i]] = static_cast<uint32_t>(i);
+    }
+
+    size_t index = 0;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(map.find(keys[index]));
+        index = index + 1 == KeyCount ? 0 : index + 1;
+    }
+}
+
+DSA_BENCHMARK(RadixTree, PrefixScan100K)
+{
+    DynamicArray<std::string> keys = makeKeys();
+    RadixTree<uint32_t> tree;
+
+    for (size_t i = 0; i < KeyCount; i++)
+    {
+        tree.insert(keys[i], static_cast<uint32_t>(i));
+    }
+
+    while (state.keepRunning())
+    {
+        size_t count = 0;
+
+        tree.forEachWithPrefix("https://example.com/users/42/", [&count](std::string_view, uint32_t&) { count++; });
+        doNotOptimize(count);
+    }
+}
+
+DSA_BENCHMARK(RadixTree, Insert100K)
+{
+    DynamicArray<std::string> keys = makeKeys();
+
+    while (state.keepRunning())
+    {
+        RadixTree<uint32_t> tree;
+
+        for (size_t i = 0; i < KeyCount; i++)
+        {
+            tree.insert(keys[i], static_cast<uint32_t>(i));
+        }
+
+        doNotOptimize(tree.getSize());
+    }
+}
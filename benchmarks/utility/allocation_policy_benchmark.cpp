@@ -0,0 +1,71 @@
+#include <cstdint>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/allocation_policy.h>
+#include <dsa/utility/benchmark.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::HugePageAllocationPolicy;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr unsigned RandomAccessBits = 23;                           /// Table of 2^23 elements, 64 MiB.
+    constexpr size_t RandomAccessElements = size_t(1) << RandomAccessBits;
+    constexpr size_t ReadsPerOperation = 1024;
+
+    /**
+     * @brief Fills table with its indices so that every page is backed by memory.
+     */
+    template<typename Array>
+    Array& populate(Array& table)
+    {
+        for (size_t i = 0; i < table.getSize(); i++)
+        {
+            table.getData()[i] = i;
+        }
+
+        return table;
+    }
+
+    /**
+     * @brief Sums independent reads at pseudo-random positions of table.
+     */
+    template<typename Array>
+    uint64_t readRandom(Array& table, uint64_t& seed)
+    {
+        const uint64_t* data = table.getData();
+        uint64_t sum = 0;
+
+        for (size_t i = 0; i < ReadsPerOperation; i++)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            sum += data[seed >> (64 - RandomAccessBits)];
+        }
+
+        return sum;
+    }
+}
+
+DSA_BENCHMARK(DynamicArray, RandomRead1024Of64MiB)
+{
+    static DynamicArray<uint64_t> table(RandomAccessElements);
+    static DynamicArray<uint64_t>& populated = populate(table);
+    uint64_t seed = 1;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(readRandom(populated, seed));
+    }
+}
+
+DSA_BENCHMARK(DynamicArrayHugePages, RandomRead1024Of64MiB)
+{
+    static DynamicArray<uint64_t, HugePageAllocationPolicy<uint64_t>> table(RandomAccessElements);
+    static DynamicArray<uint64_t, HugePageAllocationPolicy<uint64_t>>& populated = populate(table);
+    uint64_t seed = 1;
+
+    while (state.keepRunning())
+    {
+        doNotOptimize(readRandom(populated, seed));
+    }
+}
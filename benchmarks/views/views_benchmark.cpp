@@ -0,0 +1,77 @@
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/benchmark.h>
+#include <dsa/views/views.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::benchmark::doNotOptimize;
+
+namespace
+{
+    constexpr size_t PipelineSize = 4096;
+
+    /**
+     * @brief Builds source array of consecutive integers.
+     */
+    DynamicArray<int> makeSource()
+    {
+        DynamicArray<int> source(PipelineSize);
+
+        for (size_t i = 0; i < PipelineSize; i++)
+        {
+            source[i] = static_cast<int>(i);
+        }
+
+        return source;
+    }
+}
+
+DSA_BENCHMARK(Views, MapFilterTakeCollect4096)
+{
+    DynamicArray<int> source = makeSource();
+
+    while (state.keepRunning())
+    {
+        DynamicArray<int> result = source
+            | dsa::views::map([](int value) { return value * 3; })
+            | dsa::views::filter([](int value) { return value % 2 == 0; })
+            | dsa::views::take(PipelineSize / 4)
+            | dsa::views::collect();
+
+        doNotOptimize(result.getData());
+    }
+}
+
+DSA_BENCHMARK(Materialized, MapFilterTake4096)
+{
+    DynamicArray<int> source = makeSource();
+
+    while (state.keepRunning())
+    {
+        DynamicArray<int> mapped;
+        mapped.reserve(PipelineSize);
+
+        for (size_t i = 0; i < source.getSize(); i++)
+        {
+            mapped.addLast(source[i] * 3);
+        }
+
+        DynamicArray<int> filtered;
+        filtered.reserve(PipelineSize);
+
+        for (size_t i = 0; i < mapped.getSize(); i++)
+        {
+            if (mapped[i] % 2 == 0)
+                filtered.addLast(mapped[i]);
+        }
+
+        DynamicArray<int> taken;
+        taken.reserve(PipelineSize / 4);
+
+        for (size_t i = 0; i < filtered.getSize() && i < PipelineSize / 4; i++)
+        {
+            taken.addLast(filtered[i]);
+        }
+
+        doNotOptimize(taken.getData());
+    }
+}
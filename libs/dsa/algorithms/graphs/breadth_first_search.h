@@ -0,0 +1,284 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+#include <dsa/utility/intrinsics.h>
+#include <dsa/utility/parallel.h>
+
+namespace dsa::algorithms::graphs
+{
+    constexpr uint32_t Unreachable = UINT32_MAX;     /// Distance of vertex not reachable from source.
+
+    namespace detail
+    {
+        constexpr size_t ParallelMinimum = 1 << 10;     /// Minimal number of frontier vertices or bitmap words per thread.
+        constexpr uint64_t TopDownRatio = 14;           /// Switch to bottom-up once frontier edges exceed unexplored edges / ratio.
+        constexpr uint64_t BottomUpRatio = 24;          /// Switch back to top-down once frontier shrinks below vertices / ratio.
+
+        /**
+         * @brief Expands frontier queue along outgoing edges, claiming unvisited neighbours by CAS.
+         * @return Sum of out-degrees of claimed vertices.
+         */
+        inline uint64_t topDownStep(const dsa::structures::graphs::CsrGraph& graph, std::atomic<uint32_t>* distances, uint32_t level,
+            dsa::structures::arrays::DynamicArray<uint32_t>& frontier, size_t threadCount)
+        {
+            const uint64_t* offsets = graph.getOffsets();
+            const uint32_t* targets = graph.getTargets();
+            size_t chunks = dsa::utility::getChunkCount(frontier.getSize(), threadCount, ParallelMinimum);
+            dsa::structures::arrays::DynamicArray<dsa::structures::arrays::DynamicArray<uint32_t>> found(chunks);
+            dsa::structures::arrays::DynamicArray<uint64_t> scouts(chunks);
+            const uint32_t* queue = frontier.getData();
+
+            dsa::utility::parallelFor(frontier.getSize(), chunks, [&](size_t begin, size_t end, size_t chunk)
+            {
+                dsa::structures::arrays::DynamicArray<uint32_t>& next = found[chunk];
+                uint64_t scout = 0;
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    uint32_t vertex = queue[i];
+
+                    for (uint64_t e = offsets[vertex]; e < offsets[vertex + 1]; e++)
+                    {
+                        uint32_t neighbor = targets[e];
+                        uint32_t expected = Unreachable;
+
+                        if (distances[neighbor].load(std::memory_order_relaxed) == Unreachable
+                            && distances[neighbor].compare_exchange_strong(expected, level + 1, std::memory_order_relaxed))
+                        {
+                            if (next.getSize() == next.getCapacity())
+                                next.reserve(next.getCapacity() == 0 ? 16 : next.getCapacity() * 2);
+
+                            next.addLast(neighbor);
+                            scout += offsets[neighbor + 1] - offsets[neighbor];
+                        }
+                    }
+                }
+
+                scouts[chunk] = scout;
+            });
+
+            size_t size = 0;
+            uint64_t scout = 0;
+
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+            {
+                size += found[chunk].getSize();
+                scout += scouts[chunk];
+            }
+
+            dsa::structures::arrays::DynamicArray<uint32_t> next(size);
+            size_t position = 0;
+
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+            {
+                std::copy(found[chunk].getData(), found[chunk].getData() + found[chunk].getSize(), next.getData() + position);
+                position += found[chunk].getSize();
+            }
+
+            frontier = std::move(next);
+            return scout;
+        }
+
+        /**
+         * @brief Lets every unvisited vertex search its incoming edges for a parent in frontier bitmap.
+         *
+         * Threads own disjoint ranges of bitmap words, so next bitmap and distances are written without
+         * atomic read-modify-write and every vertex stops at the first parent found.
+         *
+         * @return Number of vertices added to next frontier.
+         */
+        inline size_t bottomUpStep(const dsa::structures::graphs::CsrGraph& incoming, std::atomic<uint32_t>* distances, uint32_t level,
+            const uint64_t* frontier, uint64_t* next, size_t threadCount)
+        {
+            const uint64_t* offsets = incoming.getOffsets();
+            const uint32_t* sources = incoming.getTargets();
+            size_t vertexCount = incoming.getVertexCount();
+            size_t wordCount = (vertexCount + 63) / 64;
+            size_t chunks = dsa::utility::getChunkCount(wordCount, threadCount, ParallelMinimum);
+            dsa::structures::arrays::DynamicArray<size_t> awake(chunks);
+
+            dsa::utility::parallelFor(wordCount, chunks, [&](size_t begin, size_t end, size_t chunk)
+            {
+                size_t count = 0;
+
+                for (size_t word = begin; word < end; word++)
+                {
+                    uint64_t bits = 0;
+                    size_t last = std::min(vertexCount, word * 64 + 64);
+
+                    for (size_t vertex = word * 64; vertex < last; vertex++)
+                    {
+                        if (distances[vertex].load(std::memory_order_relaxed) != Unreachable)
+                            continue;
+
+                        for (uint64_t e = offsets[vertex]; e < offsets[vertex + 1]; e++)
+                        {
+                            uint32_t parent = sources[e];
+
+                            if ((frontier[parent / 64] >> (parent % 64)) & 1)
+                            {
+                                distances[vertex].store(level + 1, std::memory_order_relaxed);
+                                bits |= static_cast<uint64_t>(1) << (vertex % 64);
+                                count++;
+                                break;
+                            }
+                        }
+                    }
+
+                    next[word] = bits;
+                }
+
+                awake[chunk] = count;
+            });
+
+            size_t total = 0;
+
+            for (size_t chunk = 0; chunk < chunks; chunk++)
+            {
+                total += awake[chunk];
+            }
+
+            return total;
+        }
+
+        /**
+         * @brief Breadth-first search switching between top-down and bottom-up steps (Beamer et al.).
+         *
+         * Top-down step costs the out-degree of the frontier. Once the frontier is large, most of its
+         * edges lead to visited vertices and bottom-up step is cheaper: each unvisited vertex only
+         * checks incoming edges until the first one coming from the frontier.
+         *
+         * @param graph Graph to traverse along outgoing edges.
+         * @param incoming Transposed graph for bottom-up steps, nullptr for top-down steps only.
+         */
+        inline dsa::structures::arrays::DynamicArray<uint32_t> directionOptimizingSearch(const dsa::structures::graphs::CsrGraph& graph,
+            const dsa::structures::graphs::CsrGraph* incoming, size_t source, size_t threadCount)
+        {
+            size_t vertexCount = graph.getVertexCount();
+
+            if (source >= vertexCount)
+                throw std::out_of_range("Vertex out of graph");
+
+            if (incoming != nullptr && incoming->getVertexCount() != vertexCount)
+                throw std::invalid_argument("Transposed graph has different number of vertices");
+
+            size_t vertexChunks = dsa::utility::getChunkCount(vertexCount, threadCount, dsa::structures::graphs::CsrGraph::ParallelMinimum);
+            dsa::structures::graphs::GraphArray<std::atomic<uint32_t>> levels(vertexCount);
+            std::atomic<uint32_t>* distances = levels.getData();
+
+            dsa::utility::parallelFor(vertexCount, vertexChunks, [&](size_t begin, size_t end, size_t)
+            {
+                for (size_t v = begin; v < end; v++)
+                {
+                    distances[v].store(Unreachable, std::memory_order_relaxed);
+                }
+            });
+
+            size_t wordCount = (vertexCount + 63) / 64;
+            dsa::structures::arrays::DynamicArray<uint32_t> frontier{static_cast<uint32_t>(source)};
+            dsa::structures::arrays::DynamicArray<uint64_t> current(incoming != nullptr ? wordCount : 0);
+            dsa::structures::arrays::DynamicArray<uint64_t> next(incoming != nullptr ? wordCount : 0);
+            uint64_t edgesToCheck = graph.getEdgeCount();
+            uint64_t scoutCount = graph.getDegree(source);
+            uint32_t level = 0;
+
+            distances[source].store(0, std::memory_order_relaxed);
+
+            while (frontier.getSize() != 0)
+            {
+                if (incoming != nullptr && scoutCount > edgesToCheck / TopDownRatio)
+                {
+                    std::fill(current.getData(), current.getData() + wordCount, 0);
+
+                    for (size_t i = 0; i < frontier.getSize(); i++)
+                    {
+                        current[frontier[i] / 64] |= static_cast<uint64_t>(1) << (frontier[i] % 64);
+                    }
+
+                    size_t awake = frontier.getSize();
+                    size_t previous;
+
+                    do
+                    {
+                        previous = awake;
+                        awake = bottomUpStep(*incoming, distances, level++, current.getData(), next.getData(), threadCount);
+                        std::swap(current, next);
+                    }
+                    while (awake != 0 && (awake >= previous || awake > vertexCount / BottomUpRatio));
+
+                    frontier = dsa::structures::arrays::DynamicArray<uint32_t>();
+                    frontier.reserve(awake);
+
+                    for (size_t word = 0; word < wordCount; word++)
+                    {
+                        for (uint64_t bits = current[word]; bits != 0; bits &= bits - 1)
+                        {
+                            frontier.addLast(static_cast<uint32_t>(word * 64 + dsa::utility::countTrailingZeros(bits)));
+                        }
+                    }
+
+                    scoutCount = 1;
+                }
+                else
+                {
+                    edgesToCheck -= std::min(edgesToCheck, scoutCount);
+                    scoutCount = topDownStep(graph, distances, level++, frontier, threadCount);
+                }
+            }
+
+            dsa::structures::arrays::DynamicArray<uint32_t> result(vertexCount);
+            uint32_t* output = result.getData();
+
+            dsa::utility::parallelFor(vertexCount, vertexChunks, [&](size_t begin, size_t end, size_t)
+            {
+                for (size_t v = begin; v < end; v++)
+                {
+                    output[v] = distances[v].load(std::memory_order_relaxed);
+                }
+            });
+
+            return result;
+        }
+    }
+
+    /**
+     * @brief Computes hop distances from source by parallel breadth-first search.
+     *
+     * Undirected graphs are searched direction-optimizing, since outgoing edges double as incoming
+     * ones. Directed graphs are searched top-down only, pass transposed graph to the other overload
+     * to enable bottom-up steps.
+     *
+     * @param graph Graph to search.
+     * @param source Index of source vertex.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     * @return Distance of every vertex from source, Unreachable for vertices not reached.
+     * @throws std::out_of_range if source is out of graph.
+     */
+    inline dsa::structures::arrays::DynamicArray<uint32_t> breadthFirstSearch(const dsa::structures::graphs::CsrGraph& graph, size_t source, size_t threadCount = 0)
+    {
+        return detail::directionOptimizingSearch(graph, graph.isUndirected() ? &graph : nullptr, source, threadCount);
+    }
+
+    /**
+     * @brief Computes hop distances from source by parallel direction-optimizing breadth-first search of directed graph.
+     * @param graph Graph to search.
+     * @param transposed Graph with reversed edges, see CsrGraph::transpose().
+     * @param source Index of source vertex.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     * @return Distance of every vertex from source, Unreachable for vertices not reached.
+     * @throws std::out_of_range if source is out of graph.
+     * @throws std::invalid_argument if graphs differ in number of vertices.
+     */
+    inline dsa::structures::arrays::DynamicArray<uint32_t> breadthFirstSearch(const dsa::structures::graphs::CsrGraph& graph,
+        const dsa::structures::graphs::CsrGraph& transposed, size_t source, size_t threadCount = 0)
+    {
+        return detail::directionOptimizingSearch(graph, &transposed, source, threadCount);
+    }
+}
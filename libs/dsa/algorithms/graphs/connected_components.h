@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+#include <dsa/utility/hash.h>
+#include <dsa/utility/parallel.h>
+
+namespace dsa::algorithms::graphs
+{
+    namespace detail
+    {
+        constexpr size_t NeighborRounds = 2;        /// Number of first neighbours linked before sampling.
+        constexpr size_t SampleCount = 1024;        /// Number of vertices sampled to find the largest component.
+
+        /**
+         * @brief Merges trees of two vertices, hooking the larger root under the smaller one.
+         *
+         * Parent of every vertex is never larger than the vertex, so roots are the smallest vertices of
+         * their trees and concurrent links cannot form a cycle.
+         */
+        inline void link(std::atomic<uint32_t>* parents, uint32_t first, uint32_t second)
+        {
+            uint32_t firstParent = parents[first].load(std::memory_order_relaxed);
+            uint32_t secondParent = parents[second].load(std::memory_order_relaxed);
+
+            while (firstParent != secondParent)
+            {
+                uint32_t high = std::max(firstParent, secondParent);
+                uint32_t low = std::min(firstParent, secondParent);
+                uint32_t highParent = parents[high].load(std::memory_order_relaxed);
+
+                if (highParent == low)
+                    return;
+
+                if (highParent == high && parents[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed))
+                    return;
+
+                firstParent = parents[parents[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+                secondParent = parents[low].load(std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Points every vertex directly to root of its tree.
+         */
+        inline void compress(std::atomic<uint32_t>* parents, size_t vertexCount, size_t chunks)
+        {
+            dsa::utility::parallelFor(vertexCount, chunks, [&](size_t begin, size_t end, size_t)
+            {
+                for (size_t v = begin; v < end; v++)
+                {
+                    uint32_t parent = parents[v].load(std::memory_order_relaxed);
+                    uint32_t grandparent = parents[parent].load(std::memory_order_relaxed);
+
+                    while (parent != grandparent)
+                    {
+                        parents[v].store(grandparent, std::memory_order_relaxed);
+                        parent = grandparent;
+                        grandparent = parents[parent].load(std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Finds the most frequent label among pseudo-randomly sampled vertices.
+         */
+        inline uint32_t sampleLargestComponent(const std::atomic<uint32_t>* parents, size_t vertexCount)
+        {
+            std::unordered_map<uint32_t, size_t> counts;
+            uint32_t largest = 0;
+            size_t largestCount = 0;
+
+            for (size_t i = 0; i < SampleCount; i++)
+            {
+                uint32_t label = parents[dsa::utility::mixHash(i) % vertexCount].load(std::memory_order_relaxed);
+                size_t count = ++counts[label];
+
+                if (count > largestCount)
+                {
+                    largest = label;
+                    largestCount = count;
+                }
+            }
+
+            return largest;
+        }
+    }
+
+    /**
+     * @brief Labels connected components by parallel lock-free union-find (Afforest, Sutton et al.).
+     *
+     * Every vertex is first linked along its first few edges only, which already merges most of
+     * a typical large component. The component is then found by sampling and its vertices skip
+     * the rest of their edges, as edges of other vertices reaching it are enough to attach them.
+     * Skipping needs every edge stored in both directions, so directed graphs link along all their
+     * edges and get weakly connected components.
+     *
+     * @param graph Graph to label.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     * @return Label of every vertex, the smallest vertex of its component.
+     */
+    inline dsa::structures::arrays::DynamicArray<uint32_t> connectedComponents(const dsa::structures::graphs::CsrGraph& graph, size_t threadCount = 0)
+    {
+        size_t vertexCount = graph.getVertexCount();
+        size_t chunks = dsa::utility::getChunkCount(vertexCount, threadCount, dsa::structures::graphs::CsrGraph::ParallelMinimum);
+        const uint64_t* offsets = graph.getOffsets();
+        const uint32_t* targets = graph.getTargets();
+        dsa::structures::graphs::GraphArray<std::atomic<uint32_t>> labels(vertexCount);
+        std::atomic<uint32_t>* parents = labels.getData();
+
+        dsa::utility::parallelFor(vertexCount, chunks, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t v = begin; v < end; v++)
+            {
+                parents[v].store(static_cast<uint32_t>(v), std::memory_order_relaxed);
+            }
+        });
+
+        for (size_t round = 0; round < detail::NeighborRounds; round++)
+        {
+            dsa::utility::parallelFor(vertexCount, chunks, [&](size_t begin, size_t end, size_t)
+            {
+                for (size_t v = begin; v < end; v++)
+                {
+                    if (offsets[v] + round < offsets[v + 1])
+                        detail::link(parents, static_cast<uint32_t>(v), targets[offsets[v] + round]);
+                }
+            });
+
+            detail::compress(parents, vertexCount, chunks);
+        }
+
+        bool canSkip = graph.isUndirected() && vertexCount != 0;
+        uint32_t largest = canSkip ? detail::sampleLargestComponent(parents, vertexCount) : 0;
+
+        dsa::utility::parallelFor(vertexCount, chunks, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t v = begin; v < end; v++)
+            {
+                if (canSkip && parents[v].load(std::memory_order_relaxed) == largest)
+                    continue;
+
+                for (uint64_t e = offsets[v] + detail::NeighborRounds; e < offsets[v + 1]; e++)
+                {
+                    detail::link(parents, static_cast<uint32_t>(v), targets[e]);
+                }
+            }
+        });
+
+        detail::compress(parents, vertexCount, chunks);
+
+        dsa::structures::arrays::DynamicArray<uint32_t> result(vertexCount);
+        uint32_t* output = result.getData();
+
+        dsa::utility::parallelFor(vertexCount, chunks, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t v = begin; v < end; v++)
+            {
+                output[v] = parents[v].load(std::memory_order_relaxed);
+            }
+        });
+
+        return result;
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <dsa/structures/arrays/static_array.h>
+
+namespace dsa::algorithms::modifying
+{
+    /**
+     * @brief Assigns value to every element.
+     * @tparam T Type of elements.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param value Value to assign.
+     */
+    template<typename T>
+    constexpr void fill(T* data, size_t size, const T& value)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = value;
+        }
+    }
+
+    /**
+     * @brief Assigns consecutive increasing values starting at value.
+     * @tparam T Type of elements, must support prefix increment.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param value Value of first element.
+     */
+    template<typename T>
+    constexpr void iota(T* data, size_t size, T value)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = value;
+            ++value;
+        }
+    }
+
+    /**
+     * @brief Assigns to every element result of generator called with its index.
+     *
+     * Together with constexpr StaticArray this precomputes lookup tables at compile time, e.g.
+     * constexpr auto table = makeTable<uint32_t, 256>(crcOfByte) is stored in read-only data.
+     *
+     * @tparam T Type of elements.
+     * @tparam Generator Callable taking size_t index and returning element.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param generator Generator instance.
+     */
+    template<typename T, typename Generator>
+    constexpr void generate(T* data, size_t size, Generator generator)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = generator(i);
+        }
+    }
+
+    /**
+     * @brief Creates StaticArray whose elements are results of generator called with their indices.
+     * @tparam T Type of elements.
+     * @tparam size Number of elements.
+     * @tparam Generator Callable taking size_t index and returning element.
+     * @param generator Generator instance.
+     * @return Generated array.
+     */
+    template<typename T, size_t size, typename Generator>
+    constexpr dsa::structures::arrays::StaticArray<T, size> makeTable(Generator generator)
+    {
+        dsa::structures::arrays::StaticArray<T, size> table;
+
+        generate(table.getData(), size, generator);
+
+        return table;
+    }
+}
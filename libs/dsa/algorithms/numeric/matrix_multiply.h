@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/parallel.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSA_MATRIX_SSE2 1
+#endif
+
+/**
+ * Kernels over row-major matrices stored contiguously, row i of matrix with leading dimension ld
+ * starts at element i * ld. Used by Matrix and StaticMatrix, usable on any contiguous buffer.
+ */
+namespace dsa::algorithms::numeric
+{
+    namespace detail
+    {
+        constexpr size_t BlockRows = 64;                /// Rows of A and C processed per block, C block stays in L1.
+        constexpr size_t BlockDepth = 128;              /// Columns of A and rows of B per block.
+        constexpr size_t BlockColumns = 256;            /// Columns of B and C per block, B panel stays in L2.
+        constexpr size_t TransposeTile = 32;            /// Side of square tile of blocked transpose.
+        constexpr size_t ParallelFlopsMinimum = 1 << 22;     /// Minimal multiply-adds per thread of parallel multiply.
+
+#if defined(DSA_MATRIX_SSE2)
+        /**
+         * @brief Accumulates 4x8 tile of C in eight SSE registers over depth of A and B.
+         * @param a Pointer to first element of 4 rows of A.
+         * @param lda Leading dimension of A.
+         * @param b Pointer to first element of 8 columns of B.
+         * @param ldb Leading dimension of B.
+         * @param c Pointer to first element of tile of C.
+         * @param ldc Leading dimension of C.
+         * @param depth Number of columns of A and rows of B.
+         */
+        inline void kernel4x8(const float* a, size_t lda, const float* b, size_t ldb, float* c, size_t ldc, size_t depth)
+        {
+            __m128 c00 = _mm_loadu_ps(c), c01 = _mm_loadu_ps(c + 4);
+            __m128 c10 = _mm_loadu_ps(c + ldc), c11 = _mm_loadu_ps(c + ldc + 4);
+            __m128 c20 = _mm_loadu_ps(c + 2 * ldc), c21 = _mm_loadu_ps(c + 2 * ldc + 4);
+            __m128 c30 = _mm_loadu_ps(c + 3 * ldc), c31 = _mm_loadu_ps(c + 3 * ldc + 4);
+
+            for (size_t p = 0; p < depth; p++)
+            {
+                __m128 b0 = _mm_loadu_ps(b + p * ldb);
+                __m128 b1 = _mm_loadu_ps(b + p * ldb + 4);
+                __m128 a0 = _mm_set1_ps(a[p]);
+                __m128 a1 = _mm_set1_ps(a[lda + p]);
+                __m128 a2 = _mm_set1_ps(a[2 * lda + p]);
+                __m128 a3 = _mm_set1_ps(a[3 * lda + p]);
+
+                c00 = _mm_add_ps(c00, _mm_mul_ps(a0, b0));
+                c01 = _mm_add_ps(c01, _mm_mul_ps(a0, b1));
+                c10 = _mm_add_ps(c10, _mm_mul_ps(a1, b0));
+                c11 = _mm_add_ps(c11, _mm_mul_ps(a1, b1));
+                c20 = _mm_add_ps(c20, _mm_mul_ps(a2, b0));
+                c21 = _mm_add_ps(c21, _mm_mul_ps(a2, b1));
+                c30 = _mm_add_ps(c30, _mm_mul_ps(a3, b0));
+                c31 = _mm_add_ps(c31, _mm_mul_ps(a3, b1));
+            }
+
+            _mm_storeu_ps(c, c00);
+            _mm_storeu_ps(c + 4, c01);
+            _mm_storeu_ps(c + ldc, c10);
+            _mm_storeu_ps(c + ldc + 4, c11);
+            _mm_storeu_ps(c + 2 * ldc, c20);
+            _mm_storeu_ps(c + 2 * ldc + 4, c21);
+            _mm_storeu_ps(c + 3 * ldc, c30);
+            _mm_storeu_ps(c + 3 * ldc + 4, c31);
+        }
+#endif
+
+        /**
+         * @brief Accumulates rows x columns block of C by scalar loop, inner loop walks rows of B and C contiguously.
+         */
+        template<typename T>
+        void multiplyScalar(const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc, size_t rows, size_t depth, size_t columns)
+        {
+            for (size_t i = 0; i < rows; i++)
+            {
+                for (size_t p = 0; p < depth; p++)
+                {
+                    T value = a[i * lda + p];
+
+                    for (size_t j = 0; j < columns; j++)
+                    {
+                        c[i * ldc + j] += value * b[p * ldb + j];
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Accumulates product of block of A and block of B into block of C.
+         */
+        template<typename T>
+        void multiplyBlock(const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc, size_t rows, size_t depth, size_t columns)
+        {
+#if defined(DSA_MATRIX_SSE2)
+            if constexpr (std::is_same_v<T, float>)
+            {
+                size_t fullRows = rows / 4 * 4;
+                size_t fullColumns = columns / 8 * 8;
+
+                for (size_t i = 0; i < fullRows; i += 4)
+                {
+                    for (size_t j = 0; j < fullColumns; j += 8)
+                    {
+                        kernel4x8(a + i * lda, lda, b + j, ldb, c + i * ldc + j, ldc, depth);
+                    }
+                }
+
+                multiplyScalar(a, lda, b + fullColumns, ldb, c + fullColumns, ldc, fullRows, depth, columns - fullColumns);
+                multiplyScalar(a + fullRows * lda, lda, b, ldb, c + fullRows * ldc, ldc, rows - fullRows, depth, columns);
+
+                return;
+            }
+#endif
+
+            multiplyScalar(a, lda, b, ldb, c, ldc, rows, depth, columns);
+        }
+    }
+
+    /**
+     * @brief Computes C = A * B of row-major matrices with cache blocking.
+     *
+     * Panel of B of BlockDepth x BlockColumns elements stays in L2 while all row blocks of A pass
+     * over it, and every block of C is updated by register tiles. Float uses SSE2 kernel computing
+     * 4x8 tile of C in registers when available, other types rely on compiler vectorization of the
+     * contiguous inner loop.
+     *
+     * @tparam T Type of elements.
+     * @param a Pointer to A of rows x depth elements.
+     * @param b Pointer to B of depth x columns elements.
+     * @param c Pointer to C of rows x columns elements, must not overlap A or B.
+     * @param rows Number of rows of A and C.
+     * @param depth Number of columns of A and rows of B.
+     * @param columns Number of columns of B and C.
+     */
+    template<typename T>
+    void multiply(const T* a, const T* b, T* c, size_t rows, size_t depth, size_t columns)
+    {
+        std::fill(c, c + rows * columns, T());
+
+        for (size_t jj = 0; jj < columns; jj += detail::BlockColumns)
+        {
+            size_t blockColumns = std::min(detail::BlockColumns, columns - jj);
+
+            for (size_t pp = 0; pp < depth; pp += detail::BlockDepth)
+            {
+                size_t blockDepth = std::min(detail::BlockDepth, depth - pp);
+
+                for (size_t ii = 0; ii < rows; ii += detail::BlockRows)
+                {
+                    size_t blockRows = std::min(detail::BlockRows, rows - ii);
+
+                    detail::multiplyBlock(a + ii * depth + pp, depth, b + pp * columns + jj, columns,
+                        c + ii * columns + jj, columns, blockRows, blockDepth, blockColumns);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Computes C = A * B with multiple threads, each computing contiguous range of rows of C.
+     *
+     * Threads share read-only B and write disjoint rows of C, so no synchronization is needed besides
+     * joining. Products smaller than ParallelFlopsMinimum multiply-adds per thread run sequentially.
+     *
+     * @param a Pointer to A of rows x depth elements.
+     * @param b Pointer to B of depth x columns elements.
+     * @param c Pointer to C of rows x columns elements, must not overlap A or B.
+     * @param rows Number of rows of A and C.
+     * @param depth Number of columns of A and rows of B.
+     * @param columns Number of columns of B and C.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     */
+    template<typename T>
+    void parallelMultiply(const T* a, const T* b, T* c, size_t rows, size_t depth, size_t columns, size_t threadCount = 0)
+    {
+        size_t flops = rows * depth * columns;
+        size_t blocks = std::min(rows, dsa::utility::getChunkCount(flops, threadCount, detail::ParallelFlopsMinimum));
+
+        if (blocks <= 1)
+        {
+            multiply(a, b, c, rows, depth, columns);
+            return;
+        }
+
+        dsa::utility::parallelFor(rows, blocks, [=](size_t begin, size_t end, size_t)
+        {
+            multiply(a + begin * depth, b, c + begin * columns, end - begin, depth, columns);
+        });
+    }
+
+    /**
+     * @brief Transposes row-major matrix tile by tile.
+     *
+     * Naive transpose writes output column by column, touching new cache line on every element.
+     * Tiles of TransposeTile x TransposeTile elements keep both source and destination lines of a
+     * tile in L1 until it is finished.
+     *
+     * @param input Pointer to input of rows x columns elements.
+     * @param rows Number of rows of input.
+     * @param columns Number of columns of input.
+     * @param output Pointer to output of columns x rows elements, must not overlap input.
+     */
+    template<typename T>
+    void transpose(const T* input, size_t rows, size_t columns, T* output)
+    {
+        for (size_t ii = 0; ii < rows; ii += detail::TransposeTile)
+        {
+            size_t rowEnd = std::min(rows, ii + detail::TransposeTile);
+
+            for (size_t jj = 0; jj < columns; jj += detail::TransposeTile)
+            {
+                size_t columnEnd = std::min(columns, jj + detail::TransposeTile);
+
+                for (size_t i = ii; i < rowEnd; i++)
+                {
+                    for (size_t j = jj; j < columnEnd; j++)
+                    {
+                        output[j * rows + i] = input[i * columns + j];
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace dsa::algorithms::numeric
+{
+    /**
+     * @brief Folds elements into single value from left to right.
+     *
+     * constexpr, so checksums and other aggregates of tables can be computed during compilation.
+     *
+     * @tparam T Type of elements.
+     * @tparam Op Binary operation.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param init Initial value of accumulator.
+     * @param op Operation combining accumulator with element.
+     * @return Accumulated value, init for empty range.
+     */
+    template<typename T, typename Op = std::plus<T>>
+    constexpr T reduce(const T* data, size_t size, T init, Op op = Op())
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            init = op(init, data[i]);
+        }
+
+        return init;
+    }
+
+    /**
+     * @brief Counts elements satisfying predicate.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param predicate Callable taking const reference to element and returning bool.
+     * @return Number of matching elements.
+     */
+    template<typename T, typename Predicate>
+    constexpr size_t countIf(const T* data, size_t size, Predicate predicate)
+    {
+        size_t count = 0;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            if (predicate(data[i]))
+                count++;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Finds first smallest element.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param compare Comparator defining order.
+     * @return Index of smallest element, size for empty range.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    constexpr size_t minElement(const T* data, size_t size, Compare compare = Compare())
+    {
+        if (size == 0)
+            return 0;
+
+        size_t best = 0;
+
+        for (size_t i = 1; i < size; i++)
+        {
+            if (compare(data[i], data[best]))
+                best = i;
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Finds first largest element.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param compare Comparator defining order.
+     * @return Index of largest element, size for empty range.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    constexpr size_t maxElement(const T* data, size_t size, Compare compare = Compare())
+    {
+        if (size == 0)
+            return 0;
+
+        size_t best = 0;
+
+        for (size_t i = 1; i < size; i++)
+        {
+            if (compare(data[best], data[i]))
+                best = i;
+        }
+
+        return best;
+    }
+}
@@ -0,0 +1,382 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+#include <dsa/utility/parallel.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSA_SCAN_SSE2 1
+#endif
+
+namespace dsa::algorithms::numeric
+{
+    namespace detail
+    {
+        constexpr size_t ParallelBlockMinimum = 1 << 15;     /// Minimal number of elements per thread of parallel scan.
+
+        /**
+         * @brief Checks whether operation is addition of type T handled by SIMD scan.
+         */
+        template<typename T, typename Op>
+        constexpr bool isSimdScan = (std::is_same_v<Op, std::plus<T>> || std::is_same_v<Op, std::plus<>>)
+            && (std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t> || std::is_same_v<T, float>);
+
+#if defined(DSA_SCAN_SSE2)
+        /**
+         * @brief Scans 32-bit integers four at a time, prefix of each vector is computed in register by two shifted adds.
+         * @param input Pointer to input elements.
+         * @param size Number of elements.
+         * @param output Pointer to output elements, may equal input.
+         * @param carry Sum of all elements preceding input.
+         * @param inclusive Inclusive or exclusive scan.
+         */
+        inline void simdScan(const int32_t* input, size_t size, int32_t* output, int32_t carry, bool inclusive)
+        {
+            __m128i running = _mm_set1_epi32(carry);
+            size_t i = 0;
+
+            for (; i + 4 <= size; i += 4)
+            {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+
+                __m128i result = inclusive ? _mm_add_epi32(x, running) : _mm_add_epi32(_mm_slli_si128(x, 4), running);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+                running = _mm_add_epi32(running, _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3)));
+            }
+
+            uint32_t sum = static_cast<uint32_t>(_mm_cvtsi128_si32(running));
+
+            for (; i < size; i++)
+            {
+                uint32_t value = static_cast<uint32_t>(input[i]);
+
+                if (inclusive)
+                {
+                    sum += value;
+                    output[i] = static_cast<int32_t>(sum);
+                }
+                else
+                {
+                    output[i] = static_cast<int32_t>(sum);
+                    sum += value;
+                }
+            }
+        }
+
+        /**
+         * @brief Scans floats four at a time, prefix of each vector is computed in register by two shifted adds.
+         * @param input Pointer to input elements.
+         * @param size Number of elements.
+         * @param output Pointer to output elements, may equal input.
+         * @param carry Sum of all elements preceding input.
+         * @param inclusive Inclusive or exclusive scan.
+         */
+        inline void simdScan(const float* input, size_t size, float* output, float carry, bool inclusive)
+        {
+            __m128 running = _mm_set1_ps(carry);
+            size_t i = 0;
+
+            for (; i + 4 <= size; i += 4)
+            {
+                __m128 x = _mm_loadu_ps(input + i);
+
+                x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+                x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+
+                __m128 result = inclusive ? _mm_add_ps(x, running) : _mm_add_ps(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)), running);
+
+                _mm_storeu_ps(output + i, result);
+                running = _mm_add_ps(running, _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3)));
+            }
+
+            float sum = _mm_cvtss_f32(running);
+
+            for (; i < size; i++)
+            {
+                float value = input[i];
+
+                if (inclusive)
+                {
+                    sum += value;
+                    output[i] = sum;
+                }
+                else
+                {
+                    output[i] = sum;
+                    sum += value;
+                }
+            }
+        }
+#endif
+
+        /**
+         * @brief Sequential scan of one block.
+         * @param input Pointer to input elements.
+         * @param size Number of elements.
+         * @param output Pointer to output elements, may equal input.
+         * @param carry Combination of all elements preceding input, or initial value of exclusive scan.
+         * @param hasCarry False for inclusive scan of the first block, which starts with its first element.
+         * @param inclusive Inclusive or exclusive scan.
+         * @param op Associative binary operation.
+         */
+        template<typename T, typename Op>
+        void scanBlock(const T* input, size_t size, T* output, T carry, bool hasCarry, bool inclusive, Op& op)
+        {
+            if (size == 0)
+                return;
+
+#if defined(DSA_SCAN_SSE2)
+            if constexpr (isSimdScan<T, Op>)
+            {
+                T start = hasCarry ? carry : T();
+
+                if constexpr (std::is_same_v<T, uint32_t>)
+                    simdScan(reinterpret_cast<const int32_t*>(input), size, reinterpret_cast<int32_t*>(output), static_cast<int32_t>(start), inclusive);
+                else
+                    simdScan(input, size, output, start, inclusive);
+
+                return;
+            }
+#endif
+
+            size_t i = 0;
+            T running = carry;
+
+            if (inclusive)
+            {
+                if (!hasCarry)
+                {
+                    running = input[0];
+                    output[0] = running;
+                    i = 1;
+                }
+
+                for (; i < size; i++)
+                {
+                    running = op(running, input[i]);
+                    output[i] = running;
+                }
+            }
+            else
+            {
+                for (; i < size; i++)
+                {
+                    T value = input[i];
+
+                    output[i] = running;
+                    running = op(running, value);
+                }
+            }
+        }
+
+        /**
+         * @brief Combines all elements of non-empty block.
+         */
+        template<typename T, typename Op>
+        T reduceBlock(const T* input, size_t size, Op& op)
+        {
+            T result = input[0];
+
+            for (size_t i = 1; i < size; i++)
+            {
+                result = op(result, input[i]);
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Two-pass blocked parallel scan.
+         *
+         * First pass reduces every block in parallel, then block totals are scanned sequentially and
+         * second pass scans every block in parallel starting from its carry.
+         */
+        template<typename T, typename Op>
+        void parallelScan(const T* input, size_t size, T* output, T init, bool inclusive, Op& op, size_t threadCount)
+        {
+            size_t blocks = dsa::utility::getChunkCount(size, threadCount, ParallelBlockMinimum);
+
+            if (blocks <= 1)
+            {
+                scanBlock(input, size, output, init, !inclusive, inclusive, op);
+                return;
+            }
+
+            dsa::structures::arrays::DynamicArray<T> totals(blocks);
+
+            dsa::utility::parallelFor(size, blocks, [&](size_t begin, size_t end, size_t block)
+            {
+                totals[block] = reduceBlock(input + begin, end - begin, op);
+            });
+
+            // Totals are turned into carry of every block, block 0 keeps only the initial value.
+            T carry = init;
+
+            for (size_t b = 0; b < blocks; b++)
+            {
+                T total = totals[b];
+
+                totals[b] = carry;
+                carry = (b == 0 && inclusive) ? total : op(carry, total);
+            }
+
+            // Both passes split the input by the same chunk boundaries.
+            dsa::utility::parallelFor(size, blocks, [&](size_t begin, size_t end, size_t block)
+            {
+                bool hasCarry = !inclusive || block != 0;
+
+                scanBlock(input + begin, end - begin, output + begin, totals[block], hasCarry, inclusive, op);
+            });
+        }
+    }
+
+    /**
+     * @brief Computes inclusive prefix scan, output[i] = input[0] op ... op input[i].
+     *
+     * Addition of int32_t, uint32_t and float uses SSE2 when available: four elements are scanned
+     * in register and the running total is carried between vectors. Float results may differ from
+     * strictly sequential summation in rounding.
+     *
+     * @tparam T Type of elements.
+     * @tparam Op Associative binary operation.
+     * @param input Pointer to input elements.
+     * @param size Number of elements.
+     * @param output Pointer to output elements, may equal input.
+     * @param op Operation instance.
+     */
+    template<typename T, typename Op = std::plus<T>>
+    void inclusiveScan(const T* input, size_t size, T* output, Op op = Op())
+    {
+        detail::scanBlock(input, size, output, T(), false, true, op);
+    }
+
+    /**
+     * @brief Computes exclusive prefix scan, output[i] = init op input[0] op ... op input[i - 1].
+     * @tparam T Type of elements.
+     * @tparam Op Associative binary operation.
+     * @param input Pointer to input elements.
+     * @param size Number of elements.
+     * @param output Pointer to output elements, may equal input.
+     * @param init Initial value, output[0] is set to it.
+     * @param op Operation instance.
+     */
+    template<typename T, typename Op = std::plus<T>>
+    void exclusiveScan(const T* input, size_t size, T* output, T init, Op op = Op())
+    {
+        detail::scanBlock(input, size, output, init, true, false, op);
+    }
+
+    /**
+     * @brief Computes inclusive prefix scan with multiple threads.
+     *
+     * Input is split into one block per thread. Blocks are reduced in parallel, block totals are
+     * scanned and then blocks are scanned in parallel from their carry, so every element is read
+     * twice and written once. Small inputs are scanned sequentially.
+     *
+     * @param input Pointer to input elements.
+     * @param size Number of elements.
+     * @param output Pointer to output elements, may equal input.
+     * @param op Operation instance.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     */
+    template<typename T, typename Op = std::plus<T>>
+    void parallelInclusiveScan(const T* input, size_t size, T* output, Op op = Op(), size_t threadCount = 0)
+    {
+        detail::parallelScan(input, size, output, T(), true, op, threadCount);
+    }
+
+    /**
+     * @brief Computes exclusive prefix scan with multiple threads.
+     * @param input Pointer to input elements.
+     * @param size Number of elements.
+     * @param output Pointer to output elements, may equal input.
+     * @param init Initial value, output[0] is set to it.
+     * @param op Operation instance.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     */
+    template<typename T, typename Op = std::plus<T>>
+    void parallelExclusiveScan(const T* input, size_t size, T* output, T init, Op op = Op(), size_t threadCount = 0)
+    {
+        detail::parallelScan(input, size, output, init, false, op, threadCount);
+    }
+
+    /**
+     * @brief Replaces elements of DynamicArray by their inclusive prefix scan.
+     * @param array Array to scan in place.
+     * @param op Operation instance.
+     */
+    template<typename T, typename AllocationPolicy, typename Op = std::plus<T>>
+    void inclusiveScan(dsa::structures::arrays::DynamicArray<T, AllocationPolicy>& array, Op op = Op())
+    {
+        inclusiveScan(array.getData(), array.getSize(), array.getData(), op);
+    }
+
+    /**
+     * @brief Replaces elements of DynamicArray by their exclusive prefix scan.
+     * @param array Array to scan in place.
+     * @param init Initial value.
+     * @param op Operation instance.
+     */
+    template<typename T, typename AllocationPolicy, typename Op = std::plus<T>>
+    void exclusiveScan(dsa::structures::arrays::DynamicArray<T, AllocationPolicy>& array, T init, Op op = Op())
+    {
+        exclusiveScan(array.getData(), array.getSize(), array.getData(), init, op);
+    }
+
+    /**
+     * @brief Replaces elements of StaticArray by their inclusive prefix scan.
+     * @param array Array to scan in place.
+     * @param op Operation instance.
+     */
+    template<typename T, size_t size, size_t Alignment, typename Op = std::plus<T>>
+    void inclusiveScan(dsa::structures::arrays::StaticArray<T, size, Alignment>& array, Op op = Op())
+    {
+        inclusiveScan(array.getData(), size, array.getData(), op);
+    }
+
+    /**
+     * @brief Replaces elements of StaticArray by their exclusive prefix scan.
+     * @param array Array to scan in place.
+     * @param init Initial value.
+     * @param op Operation instance.
+     */
+    template<typename T, size_t size, size_t Alignment, typename Op = std::plus<T>>
+    void exclusiveScan(dsa::structures::arrays::StaticArray<T, size, Alignment>& array, T init, Op op = Op())
+    {
+        exclusiveScan(array.getData(), size, array.getData(), init, op);
+    }
+
+    /**
+     * @brief Replaces elements of DynamicArray by their inclusive prefix scan using multiple threads.
+     * @param array Array to scan in place.
+     * @param op Operation instance.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     */
+    template<typename T, typename AllocationPolicy, typename Op = std::plus<T>>
+    void parallelInclusiveScan(dsa::structures::arrays::DynamicArray<T, AllocationPolicy>& array, Op op = Op(), size_t threadCount = 0)
+    {
+        parallelInclusiveScan(array.getData(), array.getSize(), array.getData(), op, threadCount);
+    }
+
+    /**
+     * @brief Replaces elements of DynamicArray by their exclusive prefix scan using multiple threads.
+     * @param array Array to scan in place.
+     * @param init Initial value.
+     * @param op Operation instance.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     */
+    template<typename T, typename AllocationPolicy, typename Op = std::plus<T>>
+    void parallelExclusiveScan(dsa::structures::arrays::DynamicArray<T, AllocationPolicy>& array, T init, Op op = Op(), size_t threadCount = 0)
+    {
+        parallelExclusiveScan(array.getData(), array.getSize(), array.getData(), init, op, threadCount);
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::algorithms::searching
+{
+    /**
+     * @brief Finds first element that does not compare before key, without data dependent branches.
+     *
+     * The search interval is halved by conditional move instead of jump, so the loop runs exactly
+     * log2(size) iterations regardless of data and never suffers branch mispredictions.
+     *
+     * @tparam T Type of elements.
+     * @tparam Compare Comparator used for sorting.
+     * @param data Pointer to sorted elements.
+     * @param size Number of elements.
+     * @param key Key to search for.
+     * @param compare Comparator instance.
+     * @return Index of lower bound, size if every element compares before key.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    constexpr size_t branchlessLowerBound(const T* data, size_t size, const T& key, Compare compare = Compare())
+    {
+        if (size == 0)
+            return 0;
+
+        const T* base = data;
+
+        while (size > 1)
+        {
+            size_t half = size / 2;
+            base = compare(base[half], key) ? base + half : base;
+            size -= half;
+        }
+
+        return static_cast<size_t>(base - data) + (compare(*base, key) ? 1 : 0);
+    }
+
+    /**
+     * @brief Gets in-order successor of node in Eytzinger layout.
+     * @param k 1-based position of node.
+     * @param size Number of elements.
+     * @return 1-based position of successor, or 0 after the last node.
+     */
+    constexpr size_t eytzingerNext(size_t k, size_t size)
+    {
+        if (2 * k + 1 <= size)
+        {
+            k = 2 * k + 1;
+
+            while (2 * k <= size)
+                k *= 2;
+
+            return k;
+        }
+
+        while (k & 1)
+            k >>= 1;
+
+        return k >> 1;
+    }
+
+    /**
+     * @brief Gets 1-based position of the first node in order of Eytzinger layout.
+     * @param size Number of elements.
+     * @return 1-based position of smallest element, or 0 if there are no elements.
+     */
+    constexpr size_t eytzingerFirst(size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        size_t k = 1;
+
+        while (2 * k <= size)
+            k *= 2;
+
+        return k;
+    }
+
+    /**
+     * @brief Reorders sorted elements into Eytzinger (breadth-first) layout.
+     *
+     * Element at position k (0-indexed) has children at positions 2k + 1 and 2k + 2, so the first
+     * levels visited by every search share a few cache lines and the next levels can be prefetched.
+     *
+     * @tparam T Type of elements.
+     * @param sorted Pointer to sorted elements.
+     * @param output Pointer to output storage of the same size.
+     * @param size Number of elements.
+     */
+    template<typename T>
+    constexpr void eytzingerLayout(T* sorted, T* output, size_t size)
+    {
+        size_t k = eytzingerFirst(size);
+
+        for (size_t i = 0; i < size; i++)
+        {
+            output[k - 1] = std::move(sorted[i]);
+            k = eytzingerNext(k, size);
+        }
+    }
+
+    /**
+     * @brief Finds first element that does not compare before key in Eytzinger layout.
+     *
+     * Descends the implicit tree without branches and prefetches the cache line holding
+     * descendants four levels below, which hides memory latency on tables larger than cache.
+     *
+     * @tparam T Type of elements.
+     * @tparam Compare Comparator used for sorting.
+     * @param tree Pointer to elements in Eytzinger layout.
+     * @param size Number of elements.
+     * @param key Key to search for.
+     * @param compare Comparator instance.
+     * @return 1-based position of lower bound, 0 if every element compares before key.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    size_t eytzingerLowerBound(const T* tree, size_t size, const T& key, Compare compare = Compare())
+    {
+        constexpr size_t prefetchDistance = 16;
+
+        size_t k = 1;
+
+        while (k <= size)
+        {
+            if (prefetchDistance * k <= size)
+                dsa::utility::prefetch(tree + prefetchDistance * k - 1);
+
+            k = 2 * k + (compare(tree[k - 1], key) ? 1 : 0);
+        }
+
+        return k >> (dsa::utility::countTrailingZeros(~static_cast<uint64_t>(k)) + 1);
+    }
+}
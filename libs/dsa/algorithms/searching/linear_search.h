@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+
+namespace dsa::algorithms::searching
+{
+    /**
+     * @brief Finds first element equal to key by scanning elements in order.
+     *
+     * Works on unsorted data and is constexpr, so it can query tables during compilation.
+     *
+     * @tparam T Type of elements.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param key Key to search for.
+     * @return Index of first equal element, size if there is none.
+     */
+    template<typename T>
+    constexpr size_t find(const T* data, size_t size, const T& key)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            if (data[i] == key)
+                return i;
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Finds first element satisfying predicate by scanning elements in order.
+     * @tparam T Type of elements.
+     * @tparam Predicate Callable taking const reference to element and returning bool.
+     * @param data Pointer to elements.
+     * @param size Number of elements.
+     * @param predicate Predicate instance.
+     * @return Index of first matching element, size if there is none.
+     */
+    template<typename T, typename Predicate>
+    constexpr size_t findIf(const T* data, size_t size, Predicate predicate)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            if (predicate(data[i]))
+                return i;
+        }
+
+        return size;
+    }
+}
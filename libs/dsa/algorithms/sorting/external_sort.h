@@ -0,0 +1,531 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <dsa/algorithms/sorting/pdq_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/queues/priority_queue.h>
+
+namespace dsa::algorithms::sorting
+{
+    /**
+     * @brief Sorts more records than fit in memory by spilling sorted runs to temporary files.
+     *
+     * Records are collected into a DynamicArray chunk sized by the memory budget. Every full chunk
+     * is sorted with pdqSort and written to its own temporary file as one run. finish() then merges
+     * runs with a k-way merge driven by PriorityQueue, at most MaxFanIn runs at once. While there are
+     * more runs, groups of them are first merged into longer runs, so the number of open files and
+     * buffers stays bounded for any input size. Every merged run is read through its own buffer of
+     * budget / (runs + 2) bytes, so disk access stays sequential in large blocks. If all records fit
+     * into a single chunk, nothing is written to disk.
+     *
+     * Temporary files are named by a random token of the sorter and created exclusively, so sorters
+     * of concurrent processes sharing a directory never overwrite each other's runs.
+     *
+     * Records are written to disk as raw bytes and must be trivially copyable.
+     *
+     * @tparam T Type of records.
+     * @tparam Compare Comparator defining order.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    class ExternalSorter
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "External sort requires trivially copyable records");
+
+        public:
+            static constexpr size_t MaxFanIn = 64;      /// Maximal number of runs merged at once.
+
+        private:
+            /**
+             * @brief Sorted run stored in temporary file, closed unless being merged.
+             */
+            struct Run
+            {
+                std::string mPath;              /// Path of the file, empty once the run was merged and removed.
+                size_t mSize = 0;               /// Number of records in the run.
+            };
+
+            /**
+             * @brief Smallest not yet merged record of a run.
+             */
+            struct MergeEntry
+            {
+                T mValue;               /// Record value.
+                size_t mRun;            /// Index of run the record belongs to.
+            };
+
+            /**
+             * @brief Orders merge entries by their records.
+             */
+            struct MergeCompare
+            {
+                Compare mCompare;       /// Record comparator.
+
+                bool operator()(const MergeEntry& first, const MergeEntry& second) const
+                {
+                    return this->mCompare(first.mValue, second.mValue);
+                }
+            };
+
+            size_t mMemoryBudget;                                       /// Memory for buffered records in bytes.
+            std::filesystem::path mDirectory;                           /// Directory of temporary files.
+            Compare mCompare;                                           /// Comparator instance.
+            dsa::structures::arrays::DynamicArray<T> mBuffer;           /// Chunk of records not yet written.
+            size_t mBuffered;                                           /// Number of records in chunk.
+            dsa::structures::arrays::DynamicArray<Run> mRuns;           /// Runs written to disk.
+            size_t mMerged;                                             /// Number of leading runs already merged into later ones.
+            std::string mToken;                                         /// Random part of temporary file names.
+            size_t mFileCount;                                          /// Number of temporary files created.
+
+        public:
+            /**
+             * @brief Constructs sorter.
+             * @param memoryBudget Maximal size of record buffers in bytes.
+             * @param directory Directory for temporary files, system temporary directory if empty.
+             * @param compare Comparator instance.
+             */
+            explicit ExternalSorter(size_t memoryBudget, std::filesystem::path directory = std::filesystem::path(), const Compare& compare = Compare())
+                : mMemoryBudget(memoryBudget), mDirectory(std::move(directory)), mCompare(compare), mBuffer(), mBuffered(0), mRuns(), mMerged(0), mToken(), mFileCount(0)
+            {
+                if (this->mDirectory.empty())
+                    this->mDirectory = std::filesystem::temp_directory_path();
+
+                std::random_device device;
+                uint64_t token = (static_cast<uint64_t>(device()) << 32) ^ device();
+                char text[17];
+
+                std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(token));
+                this->mToken = text;
+            }
+
+            ExternalSorter(const ExternalSorter&) = delete;
+            ExternalSorter& operator=(const ExternalSorter&) = delete;
+
+            /**
+             * @brief Destructor. Closes and removes temporary files.
+             */
+            ~ExternalSorter()
+            {
+                this->removeRuns();
+            }
+
+            /**
+             * @brief Adds record, spilling buffered records to disk when the chunk is full.
+             * @param record Record to add.
+             * @throws std::runtime_error if temporary file cannot be written.
+             */
+            void add(const T& record)
+            {
+                if (this->mBuffer.getSize() == 0)
+                    this->mBuffer = dsa::structures::arrays::DynamicArray<T>(this->getChunkCapacity());
+
+                if (this->mBuffered == this->mBuffer.getSize())
+                    this->spill();
+
+                this->mBuffer.getData()[this->mBuffered++] = record;
+            }
+
+            /**
+             * @brief Adds binary records read from stream until its end.
+             * @param input Stream of raw records.
+             * @throws std::runtime_error if stream ends inside a record or temporary file cannot be written.
+             */
+            void addAll(std::istream& input)
+            {
+                T record;
+
+                while (input.read(reinterpret_cast<char*>(&record), sizeof(T)))
+                {
+                    this->add(record);
+                }
+
+                if (input.gcount() != 0)
+                    throw std::runtime_error("Input stream ends inside a record");
+            }
+
+            /**
+             * @brief Returns the number of runs written to disk so far.
+             * @return Number of runs.
+             */
+            size_t getRunCount() const
+            {
+                return this->mRuns.getSize() - this->mMerged;
+            }
+
+            /**
+             * @brief Emits all added records in sorted order and resets the sorter.
+             * @param output Callable invoked with const reference to every record in order.
+             * @throws std::runtime_error if temporary file cannot be read.
+             */
+            template<typename Output>
+            void finish(Output output)
+            {
+                if (this->mRuns.getSize() == 0)
+                {
+                    T* buffer = this->mBuffer.getData();
+
+                    pdqSort(buffer, buffer + this->mBuffered, this->mCompare);
+
+                    for (size_t i = 0; i < this->mBuffered; i++)
+                    {
+                        output(static_cast<const T&>(buffer[i]));
+                    }
+                }
+                else
+                {
+                    this->spillLast();
+                    this->reduceRuns();
+                    this->mergeRange(this->mMerged, this->mRuns.getSize(), output);
+                }
+
+                this->reset();
+            }
+
+            /**
+             * @brief Writes all added records in sorted order to stream as raw records and resets the sorter.
+             * @param output Stream for sorted records.
+             * @throws std::runtime_error if temporary file cannot be read or output fails.
+             */
+            void finishToStream(std::ostream& output)
+            {
+                if (this->mRuns.getSize() == 0)
+                {
+                    T* buffer = this->mBuffer.getData();
+
+                    pdqSort(buffer, buffer + this->mBuffered, this->mCompare);
+                    output.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(this->mBuffered * sizeof(T)));
+                }
+                else
+                {
+                    this->spillLast();
+                    this->reduceRuns();
+
+                    // Output block takes the share of the budget left over by buffers of merged runs.
+                    dsa::structures::arrays::DynamicArray<T> block(this->getMergeBufferCapacity(this->getRunCount()));
+                    size_t blockSize = 0;
+
+                    auto flush = [&]()
+                    {
+                        output.write(reinterpret_cast<const char*>(block.getData()), static_cast<std::streamsize>(blockSize * sizeof(T)));
+                        blockSize = 0;
+                    };
+
+                    this->mergeRange(this->mMerged, this->mRuns.getSize(), [&](const T& record)
+                    {
+                        block.getData()[blockSize++] = record;
+
+                        if (blockSize == block.getSize())
+                            flush();
+                    });
+
+                    flush();
+                }
+
+                this->reset();
+
+                if (!output)
+                    throw std::runtime_error("Cannot write sorted records to output stream");
+            }
+
+        private:
+            /**
+             * @brief Number of records of one chunk given by memory budget.
+             * @return Chunk capacity, at least 1.
+             */
+            size_t getChunkCapacity() const
+            {
+                return std::max<size_t>(1, this->mMemoryBudget / sizeof(T));
+            }
+
+            /**
+             * @brief Number of runs merged at once, limited so that every merged run gets a buffer.
+             * @return Fan-in between 2 and MaxFanIn.
+             */
+            size_t getFanIn() const
+            {
+                return std::max<size_t>(2, std::min(MaxFanIn, this->getChunkCapacity() - std::min<size_t>(this->getChunkCapacity(), 2)));
+            }
+
+            /**
+             * @brief Number of records of buffer of every run, budget is shared by merged runs and output.
+             * @param runCount Number of merged runs.
+             * @return Buffer capacity, at least 1.
+             */
+            size_t getMergeBufferCapacity(size_t runCount) const
+            {
+                return std::max<size_t>(1, this->mMemoryBudget / (runCount + 2) / sizeof(T));
+            }
+
+            /**
+             * @brief Sorts buffered records and writes them as new run.
+             */
+            void spill()
+            {
+                T* buffer = this->mBuffer.getData();
+
+                pdqSort(buffer, buffer + this->mBuffered, this->mCompare);
+
+                this->writeRun(buffer, this->mBuffered);
+                this->mBuffered = 0;
+            }
+
+            /**
+             * @brief Writes buffered records as the last run and releases the chunk, so merging gets the whole budget.
+             */
+            void spillLast()
+            {
+                if (this->mBuffered != 0)
+                    this->spill();
+
+                this->mBuffer = dsa::structures::arrays::DynamicArray<T>();
+            }
+
+            /**
+             * @brief Creates new empty temporary file and registers it as run.
+             *
+             * File is created exclusively and creation fails instead of reusing a file of the same name.
+             *
+             * @return Index of the new run.
+             * @throws std::runtime_error if file cannot be created.
+             */
+            size_t createRun()
+            {
+                Run run;
+                std::string name = "dsa-external-sort-" + this->mToken + "-" + std::to_string(this->mFileCount++) + ".tmp";
+
+                run.mPath = (this->mDirectory / name).string();
+
+                std::FILE* file = std::fopen(run.mPath.c_str(), "wbx");
+
+                if (file == nullptr)
+                    throw std::runtime_error("Cannot create temporary file for external sort");
+
+                std::fclose(file);
+
+                try
+                {
+                    this->mRuns.addLast(run);
+                }
+                catch (...)
+                {
+                    std::error_code error;
+                    std::filesystem::remove(run.mPath, error);
+                    throw;
+                }
+
+                return this->mRuns.getSize() - 1;
+            }
+
+            /**
+             * @brief Writes sorted records to new temporary file.
+             * @param records Pointer to sorted records.
+             * @param count Number of records.
+             */
+            void writeRun(const T* records, size_t count)
+            {
+                size_t run = this->createRun();
+                std::ofstream file(this->mRuns[run].mPath, std::ios::binary);
+
+                this->mRuns[run].mSize = count;
+
+                if (!file.write(reinterpret_cast<const char*>(records), static_cast<std::streamsize>(count * sizeof(T))).flush())
+                    throw std::runtime_error("Cannot write temporary file for external sort");
+            }
+
+            /**
+             * @brief Merges groups of runs into longer runs while there are more than fan-in, so the rest can be merged at once.
+             */
+            void reduceRuns()
+            {
+                size_t fanIn = this->getFanIn();
+
+                while (this->getRunCount() > fanIn)
+                {
+                    size_t first = this->mMerged;
+                    size_t last = first + fanIn;
+                    size_t run = this->createRun();
+                    std::ofstream file(this->mRuns[run].mPath, std::ios::binary);
+                    dsa::structures::arrays::DynamicArray<T> block(this->getMergeBufferCapacity(fanIn));
+                    size_t blockSize = 0;
+
+                    auto flush = [&]()
+                    {
+                        if (!file.write(reinterpret_cast<const char*>(block.getData()), static_cast<std::streamsize>(blockSize * sizeof(T))))
+                            throw std::runtime_error("Cannot write temporary file for external sort");
+
+                        this->mRuns[run].mSize += blockSize;
+                        blockSize = 0;
+                    };
+
+                    this->mergeRange(first, last, [&](const T& record)
+                    {
+                        block.getData()[blockSize++] = record;
+
+                        if (blockSize == block.getSize())
+                            flush();
+                    });
+
+                    flush();
+
+                    if (!file.flush())
+                        throw std::runtime_error("Cannot write temporary file for external sort");
+
+                    for (size_t i = first; i < last; i++)
+                    {
+                        this->removeRun(i);
+                    }
+
+                    this->mMerged = last;
+                }
+            }
+
+            /**
+             * @brief Merges consecutive runs into output.
+             * @param first Index of first run.
+             * @param last Index past last run.
+             * @param output Callable invoked with every record in order.
+             */
+            template<typename Output>
+            void mergeRange(size_t first, size_t last, Output&& output)
+            {
+                size_t runCount = last - first;
+                size_t bufferCapacity = this->getMergeBufferCapacity(runCount);
+
+                dsa::structures::arrays::DynamicArray<T> buffers(runCount * bufferCapacity);
+                dsa::structures::arrays::DynamicArray<std::ifstream> files(runCount);
+                dsa::structures::arrays::DynamicArray<size_t> positions(runCount);
+                dsa::structures::arrays::DynamicArray<size_t> lengths(runCount);
+                dsa::structures::queues::PriorityQueue<MergeEntry, MergeCompare> queue(MergeCompare{this->mCompare});
+
+                queue.reserve(runCount);
+
+                for (size_t run = 0; run < runCount; run++)
+                {
+                    files[run].open(this->mRuns[first + run].mPath, std::ios::binary);
+
+                    if (!files[run].is_open())
+                        throw std::runtime_error("Cannot open temporary file for external sort");
+
+                    if (this->refill(files[run], buffers.getData() + run * bufferCapacity, bufferCapacity, lengths[run]))
+                        queue.push(MergeEntry{buffers.getData()[run * bufferCapacity], run});
+
+                    positions[run] = 1;
+                }
+
+                while (!queue.isEmpty())
+                {
+                    MergeEntry entry = queue.top();
+                    size_t run = entry.mRun;
+                    T* buffer = buffers.getData() + run * bufferCapacity;
+
+                    queue.pop();
+                    output(static_cast<const T&>(entry.mValue));
+
+                    if (positions[run] == lengths[run])
+                    {
+                        if (!this->refill(files[run], buffer, bufferCapacity, lengths[run]))
+                            continue;
+
+                        positions[run] = 0;
+                    }
+
+                    queue.push(MergeEntry{buffer[positions[run]++], run});
+                }
+            }
+
+            /**
+             * @brief Reads next block of run into its buffer.
+             * @param file Open file of run.
+             * @param buffer Buffer of run.
+             * @param capacity Capacity of buffer in records.
+             * @param length Set to number of records read.
+             * @return True if at least one record was read.
+             */
+            bool refill(std::ifstream& file, T* buffer, size_t capacity, size_t& length)
+            {
+                file.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(capacity * sizeof(T)));
+                length = static_cast<size_t>(file.gcount()) / sizeof(T);
+
+                if (file.bad())
+                    throw std::runtime_error("Cannot read temporary file for external sort");
+
+                return length != 0;
+            }
+
+            /**
+             * @brief Removes temporary file of run.
+             * @param run Index of run.
+             */
+            void removeRun(size_t run)
+            {
+                if (this->mRuns[run].mPath.empty())
+                    return;
+
+                std::error_code error;
+                std::filesystem::remove(this->mRuns[run].mPath, error);
+
+                this->mRuns[run].mPath.clear();
+            }
+
+            /**
+             * @brief Releases buffered records and removes all temporary files.
+             */
+            void reset()
+            {
+                this->mBuffer = dsa::structures::arrays::DynamicArray<T>();
+                this->mBuffered = 0;
+                this->removeRuns();
+            }
+
+            /**
+             * @brief Removes all temporary files.
+             */
+            void removeRuns()
+            {
+                for (size_t i = 0; i < this->mRuns.getSize(); i++)
+                {
+                    this->removeRun(i);
+                }
+
+                this->mRuns = dsa::structures::arrays::DynamicArray<Run>();
+                this->mMerged = 0;
+            }
+    };
+
+    /**
+     * @brief Sorts stream of raw records into output stream using bounded memory.
+     * @tparam T Type of records.
+     * @tparam Compare Comparator defining order.
+     * @param input Stream of raw records.
+     * @param output Stream for sorted records.
+     * @param memoryBudget Maximal size of record buffers in bytes.
+     * @param directory Directory for temporary files, system temporary directory if empty.
+     * @param compare Comparator instance.
+     * @return Number of runs spilled to disk.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    size_t externalSort(std::istream& input, std::ostream& output, size_t memoryBudget, const std::filesystem::path& directory = std::filesystem::path(), const Compare& compare = Compare())
+    {
+        ExternalSorter<T, Compare> sorter(memoryBudget, directory, compare);
+
+        sorter.addAll(input);
+
+        size_t runs = sorter.getRunCount();
+
+        sorter.finishToStream(output);
+
+        return runs;
+    }
+}
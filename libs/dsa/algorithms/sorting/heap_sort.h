@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+
+namespace dsa::algorithms::sorting
+{
+    namespace detail
+    {
+        /**
+         * @brief Moves element at root down the max-heap until both children do not compare after it.
+         * @param begin Iterator to first element of heap.
+         * @param root Position of element to sift.
+         * @param size Number of elements in heap.
+         * @param compare Comparator instance.
+         */
+        template<typename Iterator, typename Compare>
+        constexpr void siftDown(Iterator begin, ptrdiff_t root, ptrdiff_t size, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            T value = std::move(begin[root]);
+
+            while (true)
+            {
+                ptrdiff_t child = 2 * root + 1;
+
+                if (child >= size)
+                    break;
+
+                if (child + 1 < size && compare(begin[child], begin[child + 1]))
+                    child++;
+
+                if (!compare(value, begin[child]))
+                    break;
+
+                begin[root] = std::move(begin[child]);
+                root = child;
+            }
+
+            begin[root] = std::move(value);
+        }
+    }
+
+    /**
+     * @brief Sorts range with heapsort.
+     *
+     * Builds max-heap in place and repeatedly moves its top behind the heap. Runs in O(n log n)
+     * for every input without extra memory or recursion and is constexpr, so it sorts tables
+     * during compilation. At runtime pdqSort is faster on almost every input and uses heapSort
+     * only as its worst case fallback. The sort is not stable.
+     *
+     * @tparam Iterator Random access iterator or pointer.
+     * @tparam Compare Comparator defining order.
+     * @param begin Iterator to first element.
+     * @param end Iterator past the last element.
+     * @param compare Comparator instance.
+     */
+    template<typename Iterator, typename Compare>
+    constexpr void heapSort(Iterator begin, Iterator end, Compare compare)
+    {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+
+        ptrdiff_t size = end - begin;
+
+        for (ptrdiff_t root = size / 2; root > 0; root--)
+        {
+            detail::siftDown(begin, root - 1, size, compare);
+        }
+
+        for (ptrdiff_t last = size - 1; last > 0; last--)
+        {
+            T top = std::move(begin[0]);
+            begin[0] = std::move(begin[last]);
+            begin[last] = std::move(top);
+
+            detail::siftDown(begin, 0, last, compare);
+        }
+    }
+
+    /**
+     * @brief Sorts range in ascending order with heapsort.
+     * @param begin Iterator to first element.
+     * @param end Iterator past the last element.
+     */
+    template<typename Iterator>
+    constexpr void heapSort(Iterator begin, Iterator end)
+    {
+        heapSort(begin, end, std::less<typename std::iterator_traits<Iterator>::value_type>());
+    }
+
+    /**
+     * @brief Sorts DynamicArray with heapsort.
+     * @param array Array to sort.
+     * @param compare Comparator instance.
+     */
+    template<typename T, typename AllocationPolicy, typename Compare = std::less<T>>
+    void heapSort(dsa::structures::arrays::DynamicArray<T, AllocationPolicy>& array, Compare compare = Compare())
+    {
+        heapSort(array.getData(), array.getData() + array.getSize(), compare);
+    }
+
+    /**
+     * @brief Sorts StaticArray with heapsort, usable in constant expressions.
+     * @param array Array to sort.
+     * @param compare Comparator instance.
+     */
+    template<typename T, size_t size, size_t Alignment, typename Compare = std::less<T>>
+    constexpr void heapSort(dsa::structures::arrays::StaticArray<T, size, Alignment>& array, Compare compare = Compare())
+    {
+        heapSort(array.getData(), array.getData() + size, compare);
+    }
+}
@@ -0,0 +1,608 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <dsa/algorithms/sorting/heap_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+
+namespace dsa::algorithms::sorting
+{
+    namespace detail
+    {
+        constexpr ptrdiff_t InsertionSortThreshold = 24;    /// Ranges smaller than this are insertion sorted.
+        constexpr ptrdiff_t NintherThreshold = 128;         /// Ranges larger than this use pseudomedian of nine as pivot.
+        constexpr size_t PartialInsertionSortLimit = 8;     /// Moves allowed before partial insertion sort gives up.
+        constexpr size_t BlockSize = 64;                    /// Number of elements classified per block in branchless partition.
+        constexpr size_t CacheLineSize = 64;                /// Alignment of offset buffers.
+
+        /**
+         * @brief Sorts range by insertion sort.
+         * @param begin Iterator to first element.
+         * @param end Iterator past the last element.
+         * @param compare Comparator instance.
+         */
+        template<typename Iterator, typename Compare>
+        void insertionSort(Iterator begin, Iterator end, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            if (begin == end)
+                return;
+
+            for (Iterator current = begin + 1; current != end; ++current)
+            {
+                Iterator sift = current;
+                Iterator siftPrevious = current - 1;
+
+                if (compare(*sift, *siftPrevious))
+                {
+                    T value = std::move(*sift);
+
+                    do
+                    {
+                        *sift-- = std::move(*siftPrevious);
+                    } while (sift != begin && compare(value, *--siftPrevious));
+
+                    *sift = std::move(value);
+                }
+            }
+        }
+
+        /**
+         * @brief Sorts range by insertion sort, element before begin must not compare after any element of range.
+         * @param begin Iterator to first element.
+         * @param end Iterator past the last element.
+         * @param compare Comparator instance.
+         */
+        template<typename Iterator, typename Compare>
+        void unguardedInsertionSort(Iterator begin, Iterator end, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            if (begin == end)
+                return;
+
+            for (Iterator current = begin + 1; current != end; ++current)
+            {
+                Iterator sift = current;
+                Iterator siftPrevious = current - 1;
+
+                if (compare(*sift, *siftPrevious))
+                {
+                    T value = std::move(*sift);
+
+                    do
+                    {
+                        *sift-- = std::move(*siftPrevious);
+                    } while (compare(value, *--siftPrevious));
+
+                    *sift = std::move(value);
+                }
+            }
+        }
+
+        /**
+         * @brief Attempts insertion sort, gives up after PartialInsertionSortLimit element moves.
+         * @param begin Iterator to first element.
+         * @param end Iterator past the last element.
+         * @param compare Comparator instance.
+         * @return True if range is sorted.
+         */
+        template<typename Iterator, typename Compare>
+        bool partialInsertionSort(Iterator begin, Iterator end, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            if (begin == end)
+                return true;
+
+            size_t moves = 0;
+
+            for (Iterator current = begin + 1; current != end; ++current)
+            {
+                Iterator sift = current;
+                Iterator siftPrevious = current - 1;
+
+                if (compare(*sift, *siftPrevious))
+                {
+                    T value = std::move(*sift);
+
+                    do
+                    {
+                        *sift-- = std::move(*siftPrevious);
+                    } while (sift != begin && compare(value, *--siftPrevious));
+
+                    *sift = std::move(value);
+                    moves += static_cast<size_t>(current - sift);
+                }
+
+                if (moves > PartialInsertionSortLimit)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Sorts two elements.
+         */
+        template<typename Iterator, typename Compare>
+        void sort2(Iterator a, Iterator b, Compare& compare)
+        {
+            if (compare(*b, *a))
+                std::iter_swap(a, b);
+        }
+
+        /**
+         * @brief Sorts three elements.
+         */
+        template<typename Iterator, typename Compare>
+        void sort3(Iterator a, Iterator b, Iterator c, Compare& compare)
+        {
+            sort2(a, b, compare);
+            sort2(b, c, compare);
+            sort2(a, b, compare);
+        }
+
+        /**
+         * @brief Swaps elements misplaced on left side with elements misplaced on right side.
+         * @param first Base of left offsets.
+         * @param last Base of right offsets.
+         * @param offsetsLeft Offsets of misplaced elements from first.
+         * @param offsetsRight Offsets of misplaced elements before last.
+         * @param count Number of pairs to swap.
+         * @param useSwaps Use plain swaps, needed to keep descending input O(n log n).
+         */
+        template<typename Iterator>
+        void swapOffsets(Iterator first, Iterator last, const unsigned char* offsetsLeft, const unsigned char* offsetsRight, size_t count, bool useSwaps)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            if (useSwaps)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    std::iter_swap(first + offsetsLeft[i], last - offsetsRight[i]);
+                }
+            }
+            else if (count > 0)
+            {
+                Iterator left = first + offsetsLeft[0];
+                Iterator right = last - offsetsRight[0];
+                T value = std::move(*left);
+
+                *left = std::move(*right);
+
+                for (size_t i = 1; i < count; i++)
+                {
+                    left = first + offsetsLeft[i];
+                    *right = std::move(*left);
+                    right = last - offsetsRight[i];
+                    *left = std::move(*right);
+                }
+
+                *right = std::move(value);
+            }
+        }
+
+        /**
+         * @brief Aligns pointer up to cache line.
+         */
+        inline unsigned char* alignToCacheLine(unsigned char* pointer)
+        {
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(pointer);
+            address = (address + CacheLineSize - 1) & ~static_cast<std::uintptr_t>(CacheLineSize - 1);
+
+            return reinterpret_cast<unsigned char*>(address);
+        }
+
+        /**
+         * @brief Partitions range around pivot *begin, elements equal to pivot go right.
+         *
+         * Elements are classified in blocks into offset buffers without branches, then misplaced
+         * elements are swapped in bulk (BlockQuicksort scheme).
+         *
+         * @return Pivot position and whether range was already partitioned.
+         */
+        template<typename Iterator, typename Compare>
+        std::pair<Iterator, bool> partitionRightBranchless(Iterator begin, Iterator end, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            T pivot = std::move(*begin);
+            Iterator first = begin;
+            Iterator last = end;
+
+            while (compare(*++first, pivot));
+
+            if (first - 1 == begin)
+                while (first < last && !compare(*--last, pivot));
+            else
+                while (!compare(*--last, pivot));
+
+            bool alreadyPartitioned = first >= last;
+
+            if (!alreadyPartitioned)
+            {
+                std::iter_swap(first, last);
+                ++first;
+
+                unsigned char offsetsLeftStorage[BlockSize + CacheLineSize];
+                unsigned char offsetsRightStorage[BlockSize + CacheLineSize];
+                unsigned char* offsetsLeft = alignToCacheLine(offsetsLeftStorage);
+                unsigned char* offsetsRight = alignToCacheLine(offsetsRightStorage);
+
+                Iterator offsetsLeftBase = first;
+                Iterator offsetsRightBase = last;
+                size_t countLeft = 0;
+                size_t countRight = 0;
+                size_t startLeft = 0;
+                size_t startRight = 0;
+
+                while (first < last)
+                {
+                    size_t unknown = static_cast<size_t>(last - first);
+                    size_t leftSplit = countLeft == 0 ? (countRight == 0 ? unknown / 2 : unknown) : 0;
+                    size_t rightSplit = countRight == 0 ? unknown - leftSplit : 0;
+
+                    leftSplit = std::min(leftSplit, BlockSize);
+                    rightSplit = std::min(rightSplit, BlockSize);
+
+                    for (size_t i = 0; i < leftSplit; i++)
+                    {
+                        offsetsLeft[countLeft] = static_cast<unsigned char>(i);
+                        countLeft += !compare(*first, pivot);
+                        ++first;
+                    }
+
+                    for (size_t i = 0; i < rightSplit; i++)
+                    {
+                        offsetsRight[countRight] = static_cast<unsigned char>(i + 1);
+                        countRight += compare(*--last, pivot);
+                    }
+
+                    size_t count = std::min(countLeft, countRight);
+
+                    swapOffsets(offsetsLeftBase, offsetsRightBase, offsetsLeft + startLeft, offsetsRight + startRight, count, countLeft == countRight);
+
+                    countLeft -= count;
+                    countRight -= count;
+                    startLeft += count;
+                    startRight += count;
+
+                    if (countLeft == 0)
+                    {
+                        startLeft = 0;
+                        offsetsLeftBase = first;
+                    }
+
+                    if (countRight == 0)
+                    {
+                        startRight = 0;
+                        offsetsRightBase = last;
+                    }
+                }
+
+                if (countLeft != 0)
+                {
+                    offsetsLeft += startLeft;
+
+                    while (countLeft--)
+                        std::iter_swap(offsetsLeftBase + offsetsLeft[countLeft], --last);
+
+                    first = last;
+                }
+
+                if (countRight != 0)
+                {
+                    offsetsRight += startRight;
+
+                    while (countRight--)
+                    {
+                        std::iter_swap(offsetsRightBase - offsetsRight[countRight], first);
+                        ++first;
+                    }
+
+                    last = first;
+                }
+            }
+
+            Iterator pivotPosition = first - 1;
+
+            *begin = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+
+            return std::make_pair(pivotPosition, alreadyPartitioned);
+        }
+
+        /**
+         * @brief Partitions range around pivot *begin, elements equal to pivot go right.
+         * @return Pivot position and whether range was already partitioned.
+         */
+        template<typename Iterator, typename Compare>
+        std::pair<Iterator, bool> partitionRight(Iterator begin, Iterator end, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            T pivot = std::move(*begin);
+            Iterator first = begin;
+            Iterator last = end;
+
+            while (compare(*++first, pivot));
+
+            if (first - 1 == begin)
+                while (first < last && !compare(*--last, pivot));
+            else
+                while (!compare(*--last, pivot));
+
+            bool alreadyPartitioned = first >= last;
+
+            while (first < last)
+            {
+                std::iter_swap(first, last);
+
+                while (compare(*++first, pivot));
+                while (!compare(*--last, pivot));
+            }
+
+            Iterator pivotPosition = first - 1;
+
+            *begin = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+
+            return std::make_pair(pivotPosition, alreadyPartitioned);
+        }
+
+        /**
+         * @brief Partitions range around pivot *begin, elements equal to pivot go left.
+         *
+         * Used when pivot equals an element preceding the range, then all elements equal to pivot
+         * are already in final position and only the right part has to be sorted further.
+         *
+         * @return Pivot position.
+         */
+        template<typename Iterator, typename Compare>
+        Iterator partitionLeft(Iterator begin, Iterator end, Compare& compare)
+        {
+            using T = typename std::iterator_traits<Iterator>::value_type;
+
+            T pivot = std::move(*begin);
+            Iterator first = begin;
+            Iterator last = end;
+
+            while (compare(pivot, *--last));
+
+            if (last + 1 == end)
+                while (first < last && !compare(pivot, *++first));
+            else
+                while (!compare(pivot, *++first));
+
+            while (first < last)
+            {
+                std::iter_swap(first, last);
+
+                while (compare(pivot, *--last));
+                while (!compare(pivot, *++first));
+            }
+
+            Iterator pivotPosition = last;
+
+            *begin = std::move(*pivotPosition);
+            *pivotPosition = std::move(pivot);
+
+            return pivotPosition;
+        }
+
+        /**
+         * @brief Main loop of pattern-defeating quicksort.
+         * @tparam Branchless Use branchless block partitioning.
+         * @param begin Iterator to first element.
+         * @param end Iterator past the last element.
+         * @param compare Comparator instance.
+         * @param badAllowed Number of unbalanced partitions allowed before falling back to heapsort.
+         * @param leftmost True if there is no element before begin.
+         */
+        template<bool Branchless, typename Iterator, typename Compare>
+        void pdqSortLoop(Iterator begin, Iterator end, Compare& compare, int badAllowed, bool leftmost)
+        {
+            while (true)
+            {
+                ptrdiff_t size = end - begin;
+
+                if (size < InsertionSortThreshold)
+                {
+                    if (leftmost)
+                        insertionSort(begin, end, compare);
+                    else
+                        unguardedInsertionSort(begin, end, compare);
+
+                    return;
+                }
+
+                ptrdiff_t half = size / 2;
+
+                if (size > NintherThreshold)
+                {
+                    sort3(begin, begin + half, end - 1, compare);
+                    sort3(begin + 1, begin + (half - 1), end - 2, compare);
+                    sort3(begin + 2, begin + (half + 1), end - 3, compare);
+                    sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+                    std::iter_swap(begin, begin + half);
+                }
+                else
+                {
+                    sort3(begin + half, begin, end - 1, compare);
+                }
+
+                // Pivot equal to preceding element means many equal keys, put all of them left at once.
+                if (!leftmost && !compare(*(begin - 1), *begin))
+                {
+                    begin = partitionLeft(begin, end, compare) + 1;
+                    continue;
+                }
+
+                std::pair<Iterator, bool> partition = Branchless ? partitionRightBranchless(begin, end, compare) : partitionRight(begin, end, compare);
+                Iterator pivotPosition = partition.first;
+                bool alreadyPartitioned = partition.second;
+
+                ptrdiff_t leftSize = pivotPosition - begin;
+                ptrdiff_t rightSize = end - (pivotPosition + 1);
+                bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+                if (highlyUnbalanced)
+                {
+                    if (--badAllowed == 0)
+                    {
+                        heapSort(begin, end, compare);
+                        return;
+                    }
+
+                    // Break patterns that produced bad pivot by swapping a few elements around.
+                    if (leftSize >= InsertionSortThreshold)
+                    {
+                        std::iter_swap(begin, begin + leftSize / 4);
+                        std::iter_swap(pivotPosition - 1, pivotPosition - leftSize / 4);
+
+                        if (leftSize > NintherThreshold)
+                        {
+                            std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+                            std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+                            std::iter_swap(pivotPosition - 2, pivotPosition - (leftSize / 4 + 1));
+                            std::iter_swap(pivotPosition - 3, pivotPosition - (leftSize / 4 + 2));
+                        }
+                    }
+
+                    if (rightSize >= InsertionSortThreshold)
+                    {
+                        std::iter_swap(pivotPosition + 1, pivotPosition + (1 + rightSize / 4));
+                        std::iter_swap(end - 1, end - rightSize / 4);
+
+                        if (rightSize > NintherThreshold)
+                        {
+                            std::iter_swap(pivotPosition + 2, pivotPosition + (2 + rightSize / 4));
+                            std::iter_swap(pivotPosition + 3, pivotPosition + (3 + rightSize / 4));
+                            std::iter_swap(end - 2, end - (1 + rightSize / 4));
+                            std::iter_swap(end - 3, end - (2 + rightSize / 4));
+                        }
+                    }
+                }
+                else if (alreadyPartitioned
+                    && partialInsertionSort(begin, pivotPosition, compare)
+                    && partialInsertionSort(pivotPosition + 1, end, compare))
+                {
+                    return;
+                }
+
+                pdqSortLoop<Branchless>(begin, pivotPosition, compare, badAllowed, leftmost);
+
+                begin = pivotPosition + 1;
+                leftmost = false;
+            }
+        }
+
+        /**
+         * @brief Computes floor of binary logarithm.
+         */
+        inline int log2(size_t value)
+        {
+            int result = 0;
+
+            while (value >>= 1)
+                result++;
+
+            return result;
+        }
+
+        /**
+         * @brief Checks whether branchless partitioning is profitable for comparator and element type.
+         */
+        template<typename T, typename Compare>
+        constexpr bool isBranchlessProfitable = std::is_arithmetic_v<T>
+            && (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::greater<T>>
+                || std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::greater<>>);
+    }
+
+    /**
+     * @brief Sorts range with pattern-defeating quicksort.
+     *
+     * Quicksort with median-of-three (pseudomedian-of-nine for large ranges) pivot, insertion sort
+     * for small ranges and heapsort fallback after too many unbalanced partitions, so worst case is
+     * O(n log n). Sorted, reversed and few-unique inputs are detected and finish in linear time.
+     * For arithmetic types with default comparators the partition step classifies elements in
+     * blocks without branches. The sort is not stable.
+     *
+     * @tparam Iterator Random access iterator or pointer.
+     * @tparam Compare Comparator defining order.
+     * @param begin Iterator to first element.
+     * @param end Iterator past the last element.
+     * @param compare Comparator instance.
+     */
+    template<typename Iterator, typename Compare>
+    void pdqSort(Iterator begin, Iterator end, Compare compare)
+    {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+
+        if (begin == end)
+            return;
+
+        detail::pdqSortLoop<detail::isBranchlessProfitable<T, Compare>>(begin, end, compare, detail::log2(static_cast<size_t>(end - begin)), true);
+    }
+
+    /**
+     * @brief Sorts range in ascending order with pattern-defeating quicksort.
+     * @param begin Iterator to first element.
+     * @param end Iterator past the last element.
+     */
+    template<typename Iterator>
+    void pdqSort(Iterator begin, Iterator end)
+    {
+        pdqSort(begin, end, std::less<typename std::iterator_traits<Iterator>::value_type>());
+    }
+
+    /**
+     * @brief Sorts range with pattern-defeating quicksort, always using branchless partitioning.
+     *
+     * Branchless partitioning is faster for cheap comparators whose outcome is unpredictable
+     * and slower for expensive ones, choose explicitly when the default heuristic is not right.
+     *
+     * @param begin Iterator to first element.
+     * @param end Iterator past the last element.
+     * @param compare Comparator instance.
+     */
+    template<typename Iterator, typename Compare>
+    void pdqSortBranchless(Iterator begin, Iterator end, Compare compare)
+    {
+        if (begin == end)
+            return;
+
+        detail::pdqSortLoop<true>(begin, end, compare, detail::log2(static_cast<size_t>(end - begin)), true);
+    }
+
+    /**
+     * @brief Sorts DynamicArray with pattern-defeating quicksort.
+     * @param array Array to sort.
+     * @param compare Comparator instance.
+     */
+    template<typename T, typename AllocationPolicy, typename Compare = std::less<T>>
+    void pdqSort(dsa::structures::arrays::DynamicArray<T, AllocationPolicy>& array, Compare compare = Compare())
+    {
+        pdqSort(array.getData(), array.getData() + array.getSize(), compare);
+    }
+
+    /**
+     * @brief Sorts StaticArray with pattern-defeating quicksort.
+     * @param array Array to sort.
+     * @param compare Comparator instance.
+     */
+    template<typename T, size_t size, size_t Alignment, typename Compare = std::less<T>>
+    void pdqSort(dsa::structures::arrays::StaticArray<T, size, Alignment>& array, Compare compare = Compare())
+    {
+        pdqSort(array.getData(), array.getData() + size, compare);
+    }
+}
@@ -0,0 +1,661 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::structures::arrays
+{
+    /**
+     * @brief Operations shared by packed bit arrays.
+     *
+     * Bits are packed 64 per word, bit i is stored in word i / 64 at position i % 64. Bits past
+     * the size of array in the last word are always kept zero, so whole-word operations such as
+     * popcount never need masking. Bulk operations are plain loops over words which the compiler
+     * turns into SIMD instructions.
+     *
+     * @tparam Derived Bit array type providing getWords(), getWordCount() and getSize().
+     */
+    template<typename Derived>
+    class BitArrayOperations
+    {
+        public:
+            static constexpr size_t BitsPerWord = 64;
+
+        public:
+            /**
+             * @brief Gets value of bit at specific index.
+             * @param index Index of bit.
+             * @return True if bit is set.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            bool test(size_t index) const
+            {
+                this->checkIndex(index);
+
+                return (this->words()[index / BitsPerWord] >> (index % BitsPerWord)) & 1;
+            }
+
+            /**
+             * @brief Gets value of bit at specific index using operator[].
+             * @param index Index of bit.
+             * @return True if bit is set.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            bool operator[](size_t index) const
+            {
+                return this->test(index);
+            }
+
+            /**
+             * @brief Sets bit at specific index to given value.
+             * @param index Index of bit.
+             * @param value Value of bit.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void set(size_t index, bool value = true)
+            {
+                this->checkIndex(index);
+
+                uint64_t mask = uint64_t(1) << (index % BitsPerWord);
+                uint64_t& word = this->words()[index / BitsPerWord];
+
+                word = value ? (word | mask) : (word & ~mask);
+            }
+
+            /**
+             * @brief Clears bit at specific index.
+             * @param index Index of bit.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void reset(size_t index)
+            {
+                this->set(index, false);
+            }
+
+            /**
+             * @brief Inverts bit at specific index.
+             * @param index Index of bit.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void flip(size_t index)
+            {
+                this->checkIndex(index);
+
+                this->words()[index / BitsPerWord] ^= uint64_t(1) << (index % BitsPerWord);
+            }
+
+            /**
+             * @brief Sets all bits.
+             */
+            void setAll()
+            {
+                uint64_t* words = this->words();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] = ~uint64_t(0);
+                }
+
+                this->clearTail();
+            }
+
+            /**
+             * @brief Clears all bits.
+             */
+            void resetAll()
+            {
+                uint64_t* words = this->words();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] = 0;
+                }
+            }
+
+            /**
+             * @brief Inverts all bits.
+             */
+            void flipAll()
+            {
+                uint64_t* words = this->words();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] = ~words[i];
+                }
+
+                this->clearTail();
+            }
+
+            /**
+             * @brief Counts set bits.
+             * @return Number of set bits.
+             */
+            size_t popcount() const
+            {
+                const uint64_t* words = this->words();
+                size_t wordCount = this->wordCount();
+                size_t count = 0;
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    count += dsa::utility::popcount(words[i]);
+                }
+
+                return count;
+            }
+
+            /**
+             * @brief Checks whether any bit is set.
+             * @return True if at least one bit is set.
+             */
+            bool any() const
+            {
+                const uint64_t* words = this->words();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    if (words[i] != 0)
+                        return true;
+                }
+
+                return false;
+            }
+
+            /**
+             * @brief Checks whether no bit is set.
+             * @return True if all bits are cleared.
+             */
+            bool none() const
+            {
+                return !this->any();
+            }
+
+            /**
+             * @brief Checks whether all bits are set.
+             * @return True if all bits are set.
+             */
+            bool all() const
+            {
+                return this->popcount() == this->derived().getSize();
+            }
+
+            /**
+             * @brief Finds index of first set bit.
+             * @return Index of first set bit, getSize() if no bit is set.
+             */
+            size_t findFirstSet() const
+            {
+                return this->findFromWord(0, ~uint64_t(0));
+            }
+
+            /**
+             * @brief Finds index of first set bit after given index.
+             * @param index Index to search after.
+             * @return Index of next set bit, getSize() if no following bit is set.
+             */
+            size_t findNextSet(size_t index) const
+            {
+                index++;
+
+                if (index >= this->derived().getSize())
+                    return this->derived().getSize();
+
+                return this->findFromWord(index / BitsPerWord, ~uint64_t(0) << (index % BitsPerWord));
+            }
+
+            /**
+             * @brief Bitwise and assignment operator.
+             * @param other Bit array of same size.
+             * @return Reference to this bit array.
+             * @throws std::invalid_argument if sizes differ.
+             */
+            Derived& operator&=(const Derived& other)
+            {
+                this->checkSize(other);
+
+                uint64_t* words = this->words();
+                const uint64_t* otherWords = other.getWords();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] &= otherWords[i];
+                }
+
+                return this->derived();
+            }
+
+            /**
+             * @brief Bitwise or assignment operator.
+             * @param other Bit array of same size.
+             * @return Reference to this bit array.
+             * @throws std::invalid_argument if sizes differ.
+             */
+            Derived& operator|=(const Derived& other)
+            {
+                this->checkSize(other);
+
+                uint64_t* words = this->words();
+                const uint64_t* otherWords = other.getWords();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] |= otherWords[i];
+                }
+
+                return this->derived();
+            }
+
+            /**
+             * @brief Bitwise xor assignment operator.
+             * @param other Bit array of same size.
+             * @return Reference to this bit array.
+             * @throws std::invalid_argument if sizes differ.
+             */
+            Derived& operator^=(const Derived& other)
+            {
+                this->checkSize(other);
+
+                uint64_t* words = this->words();
+                const uint64_t* otherWords = other.getWords();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] ^= otherWords[i];
+                }
+
+                return this->derived();
+            }
+
+            /**
+             * @brief Clears bits that are set in other bit array (and not).
+             * @param other Bit array of same size.
+             * @return Reference to this bit array.
+             * @throws std::invalid_argument if sizes differ.
+             */
+            Derived& subtract(const Derived& other)
+            {
+                this->checkSize(other);
+
+                uint64_t* words = this->words();
+                const uint64_t* otherWords = other.getWords();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    words[i] &= ~otherWords[i];
+                }
+
+                return this->derived();
+            }
+
+            /**
+             * @brief Bitwise and operator.
+             * @param other Bit array of same size.
+             * @return New bit array.
+             */
+            Derived operator&(const Derived& other) const
+            {
+                Derived result = this->derived();
+                result &= other;
+                return result;
+            }
+
+            /**
+             * @brief Bitwise or operator.
+             * @param other Bit array of same size.
+             * @return New bit array.
+             */
+            Derived operator|(const Derived& other) const
+            {
+                Derived result = this->derived();
+                result |= other;
+                return result;
+            }
+
+            /**
+             * @brief Bitwise xor operator.
+             * @param other Bit array of same size.
+             * @return New bit array.
+             */
+            Derived operator^(const Derived& other) const
+            {
+                Derived result = this->derived();
+                result ^= other;
+                return result;
+            }
+
+            /**
+             * @brief Bitwise not operator.
+             * @return New bit array with all bits inverted.
+             */
+            Derived operator~() const
+            {
+                Derived result = this->derived();
+                result.flipAll();
+                return result;
+            }
+
+            /**
+             * @brief Equals operator.
+             * @param other Bit array to compare with.
+             * @return True if sizes and all bits equal.
+             */
+            bool operator==(const Derived& other) const
+            {
+                if (this->derived().getSize() != other.getSize())
+                    return false;
+
+                const uint64_t* words = this->words();
+                const uint64_t* otherWords = other.getWords();
+                size_t wordCount = this->wordCount();
+
+                for (size_t i = 0; i < wordCount; i++)
+                {
+                    if (words[i] != otherWords[i])
+                        return false;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Not equals operator.
+             * @param other Bit array to compare with.
+             * @return True if sizes or any bit differ.
+             */
+            bool operator!=(const Derived& other) const
+            {
+                return !(*this == other);
+            }
+
+            /**
+             * @brief Outputs bits to stream, starting with bit at index 0.
+             * @param os Output stream.
+             * @param array Bit array to output.
+             * @return Reference to output stream.
+             */
+            friend std::ostream& operator<<(std::ostream& os, const Derived& array)
+            {
+                for (size_t i = 0; i < array.getSize(); i++)
+                {
+                    os << (array.test(i) ? '1' : '0');
+                }
+
+                return os;
+            }
+
+        protected:
+            /**
+             * @brief Clears unused bits of last word.
+             */
+            void clearTail()
+            {
+                size_t used = this->derived().getSize() % BitsPerWord;
+
+                if (used != 0)
+                    this->words()[this->wordCount() - 1] &= (uint64_t(1) << used) - 1;
+            }
+
+        private:
+            /**
+             * @brief Casts this instance to derived bit array.
+             * @return Reference to derived bit array.
+             */
+            Derived& derived()
+            {
+                return static_cast<Derived&>(*this);
+            }
+
+            /**
+             * @brief Casts this instance to derived bit array.
+             * @return Const reference to derived bit array.
+             */
+            const Derived& derived() const
+            {
+                return static_cast<const Derived&>(*this);
+            }
+
+            /**
+             * @brief Gets packed words of derived bit array.
+             * @return Pointer to first word.
+             */
+            uint64_t* words()
+            {
+                return this->derived().getWords();
+            }
+
+            /**
+             * @brief Gets packed words of derived bit array.
+             * @return Const pointer to first word.
+             */
+            const uint64_t* words() const
+            {
+                return this->derived().getWords();
+            }
+
+            /**
+             * @brief Gets number of packed words of derived bit array.
+             * @return Number of words.
+             */
+            size_t wordCount() const
+            {
+                return this->derived().getWordCount();
+            }
+
+            /**
+             * @brief Checks that index is within bounds.
+             * @param index Index of bit.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void checkIndex(size_t index) const
+            {
+                if (index >= this->derived().getSize())
+                    throw std::out_of_range("Index out of array bounds");
+            }
+
+            /**
+             * @brief Checks that other bit array has the same size.
+             * @param other Other bit array.
+             * @throws std::invalid_argument if sizes differ.
+             */
+            void checkSize(const Derived& other) const
+            {
+                if (this->derived().getSize() != other.getSize())
+                    throw std::invalid_argument("Bit array sizes do not match");
+            }
+
+            /**
+             * @brief Finds first set bit starting at given word.
+             * @param wordIndex Index of first word to search.
+             * @param firstMask Mask applied to the first searched word.
+             * @return Index of set bit, getSize() if none is found.
+             */
+            size_t findFromWord(size_t wordIndex, uint64_t firstMask) const
+            {
+                const uint64_t* words = this->words();
+                size_t count = this->wordCount();
+
+                if (wordIndex >= count)
+                    return this->derived().getSize();
+
+                uint64_t word = words[wordIndex] & firstMask;
+
+                while (word == 0)
+                {
+                    if (++wordIndex >= count)
+                        return this->derived().getSize();
+
+                    word = words[wordIndex];
+                }
+
+                return wordIndex * BitsPerWord + dsa::utility::countTrailingZeros(word);
+            }
+    };
+
+    /**
+     * @brief Packed array of bits with size set at runtime.
+     *
+     * Stores 64 bits per word in DynamicArray, using eight times less memory than array of bool and
+     * processing 64 bits per instruction in bulk operations.
+     */
+    class BitArray : public BitArrayOperations<BitArray>
+    {
+        private:
+            DynamicArray<uint64_t> mWords;      /// Packed words.
+            size_t mSize;                       /// Number of bits.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty bit array.
+             */
+            BitArray() : mWords(), mSize(0) {}
+
+            /**
+             * @brief Constructs bit array with given number of bits.
+             * @param size Number of bits.
+             * @param value Initial value of all bits.
+             */
+            explicit BitArray(size_t size, bool value = false) : mWords((size + BitsPerWord - 1) / BitsPerWord), mSize(size)
+            {
+                if (value)
+                    this->setAll();
+            }
+
+            /**
+             * @brief Changes number of bits, newly added bits are cleared.
+             * @param size New number of bits.
+             */
+            void resize(size_t size)
+            {
+                size_t wordCount = (size + BitsPerWord - 1) / BitsPerWord;
+
+                if (wordCount != this->mWords.getSize())
+                {
+                    DynamicArray<uint64_t> words(wordCount);
+                    size_t kept = wordCount < this->mWords.getSize() ? wordCount : this->mWords.getSize();
+
+                    for (size_t i = 0; i < kept; i++)
+                    {
+                        words.getData()[i] = this->mWords.getData()[i];
+                    }
+
+                    this->mWords = std::move(words);
+                }
+
+                this->mSize = size;
+                this->clearTail();
+            }
+
+            /**
+             * @brief Returns the number of bits.
+             * @return Number of bits.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns the number of packed words.
+             * @return Number of words.
+             */
+            size_t getWordCount() const
+            {
+                return this->mWords.getSize();
+            }
+
+            /**
+             * @brief Returns pointer to packed words.
+             * @return Pointer to first word.
+             */
+            uint64_t* getWords()
+            {
+                return this->mWords.getData();
+            }
+
+            /**
+             * @brief Returns const pointer to packed words.
+             * @return Const pointer to first word.
+             */
+            const uint64_t* getWords() const
+            {
+                return this->mWords.getData();
+            }
+    };
+
+    /**
+     * @brief Packed array of bits with size set at compile time.
+     *
+     * Words are stored inline, so the array never allocates.
+     *
+     * @tparam size Number of bits.
+     */
+    template<size_t size>
+    class StaticBitArray : public BitArrayOperations<StaticBitArray<size>>
+    {
+        public:
+            static constexpr size_t WordCount = (size + 63) / 64;
+
+        private:
+            uint64_t mWords[WordCount == 0 ? 1 : WordCount];      /// Packed words.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes all bits to given value.
+             * @param value Initial value of all bits.
+             */
+            explicit StaticBitArray(bool value = false) : mWords()
+            {
+                if (value)
+                    this->setAll();
+            }
+
+            /**
+             * @brief Returns the number of bits.
+             * @return Number of bits.
+             */
+            constexpr size_t getSize() const
+            {
+                return size;
+            }
+
+            /**
+             * @brief Returns the number of packed words.
+             * @return Number of words.
+             */
+            constexpr size_t getWordCount() const
+            {
+                return WordCount;
+            }
+
+            /**
+             * @brief Returns pointer to packed words.
+             * @return Pointer to first word.
+             */
+            uint64_t* getWords()
+            {
+                return this->mWords;
+            }
+
+            /**
+             * @brief Returns const pointer to packed words.
+             * @return Const pointer to first word.
+             */
+            const uint64_t* getWords() const
+            {
+                return this->mWords;
+            }
+    };
+}
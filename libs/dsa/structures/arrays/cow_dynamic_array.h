@@ -0,0 +1,475 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+
+namespace dsa::structures::arrays
+{
+    /**
+     * @brief Copy-on-write variant of DynamicArray.
+     *
+     * Copies share a single reference counted DynamicArray, so copying is O(1) regardless of size.
+     * The first mutating call (non-const accessors, set, add and remove methods, non-const
+     * iteration) on an array whose buffer is shared makes a private deep copy first.
+     * Reference count is atomic, so copies can be handed to other threads and read or modified
+     * there independently. A single instance must still not be used from several threads at once.
+     *
+     * Once a mutable reference or iterator has been handed out (non-const get, operator[], first,
+     * last, begin or end), storage is marked unshareable and later copies of the array deep-copy
+     * it, so writes through the reference never reach a copy. Storage stays unshareable until it
+     * is replaced by assignment, so arrays copied often should be modified by set() to keep
+     * copying O(1).
+     *
+     * @tparam T Type of elements stored in the array.
+     */
+    template<typename T>
+    class CowDynamicArray
+    {
+        private:
+            /**
+             * @brief Reference counted storage shared between copies.
+             */
+            struct SharedArray
+            {
+                std::atomic<size_t> mReferences;    /// Number of arrays sharing this storage.
+                bool mShareable;                    /// False once a mutable reference to elements was handed out.
+                DynamicArray<T> mArray;             /// Shared elements.
+
+                /**
+                 * @brief Constructs shareable storage with single reference.
+                 * @param array Elements to take over.
+                 */
+                explicit SharedArray(DynamicArray<T>&& array) : mReferences(1), mShareable(true), mArray(std::move(array)) {}
+            };
+
+            SharedArray* pShared;       /// Pointer to shared storage, nullptr if the array is empty.
+
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using ConstReferenceType = const T&;
+            using PointerType = T*;
+            using Iterator = typename DynamicArray<T>::Iterator;
+            using ConstIterator = const T*;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty array.
+             */
+            CowDynamicArray() : pShared(nullptr) {}
+
+            /**
+             * @brief Constructs the array from an initializer list.
+             * @param list Initializer list of elements to populate the array.
+             */
+            CowDynamicArray(std::initializer_list<T> list) : CowDynamicArray(DynamicArray<T>(list)) {}
+
+            /**
+             * @brief Constructs the array by taking over elements of DynamicArray.
+             * @param array Array to take elements from.
+             */
+            explicit CowDynamicArray(DynamicArray<T> array) : pShared(nullptr)
+            {
+                if (array.getSize() != 0)
+                    this->pShared = new SharedArray(std::move(array));
+            }
+
+            /**
+             * @brief Copy constructor. Shares storage with another CowDynamicArray in O(1) unless it is unshareable.
+             * @param other The CowDynamicArray to copy from.
+             */
+            CowDynamicArray(const CowDynamicArray<ValueType>& other) : pShared(share(other.pShared)) {}
+
+            /**
+             * @brief Move constructor. Transfers ownership of shared storage from another CowDynamicArray.
+             * @param other The CowDynamicArray to move from.
+             */
+            CowDynamicArray(CowDynamicArray<ValueType>&& other) noexcept : pShared(other.pShared)
+            {
+                other.pShared = nullptr;
+            }
+
+            /**
+             * @brief Destructor. Releases reference to shared storage.
+             */
+            ~CowDynamicArray()
+            {
+                this->release();
+            }
+
+            /**
+             * @brief Copy assignment operator. Shares storage with another CowDynamicArray in O(1) unless it is unshareable.
+             * @param other The CowDynamicArray to copy from.
+             * @return Reference to this CowDynamicArray.
+             */
+            CowDynamicArray<ValueType>& operator=(const CowDynamicArray<ValueType>& other)
+            {
+                if (this->pShared == other.pShared)
+                    return *this;
+
+                SharedArray* shared = share(other.pShared);
+
+                this->release();
+                this->pShared = shared;
+
+                return *this;
+            }
+
+            /**
+             * @brief Move assignment operator.
+             * @param other The CowDynamicArray to move from.
+             * @return Reference to this CowDynamicArray.
+             */
+            CowDynamicArray<ValueType>& operator=(CowDynamicArray<ValueType>&& other) noexcept
+            {
+                if (this == &other)
+                    return *this;
+
+                this->release();
+                this->pShared = other.pShared;
+                other.pShared = nullptr;
+
+                return *this;
+            }
+
+            /**
+             * @brief Assignment operator from an initializer list.
+             * @param list Initializer list of elements to assign.
+             * @return Reference to this CowDynamicArray.
+             */
+            CowDynamicArray<ValueType>& operator=(const std::initializer_list<ValueType>& list)
+            {
+                *this = CowDynamicArray<ValueType>(list);
+                return *this;
+            }
+
+            /**
+             * @brief Returns a reference to the element at the specified index, detaching shared storage and marking it unshareable.
+             * @param index Index of the element to access.
+             * @return Reference to the element.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ReferenceType get(const size_t index)
+            {
+                if (index >= this->getSize())
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->unshareableArray().get(index);
+            }
+
+            /**
+             * @brief Returns a const reference to the element at the specified index.
+             * @param index Index of the element to access.
+             * @return Const reference to the element.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ConstReferenceType get(const size_t index) const
+            {
+                if (index >= this->getSize())
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->pShared->mArray.get(index);
+            }
+
+            /**
+             * @brief Array subscript operator, detaching shared storage.
+             * @param index Index of the element to access.
+             * @return Reference to the element.
+             */
+            ReferenceType operator[](const size_t index)
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Array subscript operator (const version).
+             * @param index Index of the element to access.
+             * @return Const reference to the element.
+             */
+            ConstReferenceType operator[](const size_t index) const
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Returns the number of elements in the array.
+             * @return Number of elements.
+             */
+            size_t getSize() const
+            {
+                return this->pShared != nullptr ? this->pShared->mArray.getSize() : 0;
+            }
+
+            /**
+             * @brief Returns the number of arrays sharing storage with this array.
+             * @return Reference count of storage, 0 if the array is empty.
+             */
+            size_t getReferenceCount() const
+            {
+                return this->pShared != nullptr ? this->pShared->mReferences.load(std::memory_order_acquire) : 0;
+            }
+
+            /**
+             * @brief Checks whether storage is shared with another array.
+             * @return True if mutation would copy the elements.
+             */
+            bool isShared() const
+            {
+                return this->getReferenceCount() > 1;
+            }
+
+            /**
+             * @brief Checks whether copies of the array can share its storage.
+             * @return False if a mutable reference or iterator to elements was handed out.
+             */
+            bool isShareable() const
+            {
+                return this->pShared == nullptr || this->pShared->mShareable;
+            }
+
+            /**
+             * @brief Returns const pointer to the underlying contiguous storage.
+             * @return Const pointer to first element, nullptr if the array is empty.
+             */
+            const ValueType* getData() const
+            {
+                return this->pShared != nullptr ? this->pShared->mArray.getData() : nullptr;
+            }
+
+            /**
+             * @brief Returns a reference to the first element, detaching shared storage.
+             * @return Reference to the first element.
+             * @throws std::out_of_range if the array is empty.
+             */
+            ReferenceType first()
+            {
+                return this->get(0);
+            }
+
+            /**
+             * @brief Returns a const reference to the first element.
+             * @return Const reference to the first element.
+             * @throws std::out_of_range if the array is empty.
+             */
+            ConstReferenceType first() const
+            {
+                return this->get(0);
+            }
+
+            /**
+             * @brief Returns a reference to the last element, detaching shared storage.
+             * @return Reference to the last element.
+             * @throws std::out_of_range if the array is empty.
+             */
+            ReferenceType last()
+            {
+                return this->get(this->getSize() - 1);
+            }
+
+            /**
+             * @brief Returns a const reference to the last element.
+             * @return Const reference to the last element.
+             * @throws std::out_of_range if the array is empty.
+             */
+            ConstReferenceType last() const
+            {
+                return this->get(this->getSize() - 1);
+            }
+
+            /**
+             * @brief Sets the value at the specified index.
+             * @param index Index of the element to set.
+             * @param value Value to assign.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void set(size_t index, ValueType value)
+            {
+                if (index >= this->getSize())
+                    throw std::out_of_range("Index out of array bounds");
+
+                this->mutableArray().set(index, std::move(value));
+            }
+
+            /**
+             * @brief Adds an element to the end of the array.
+             * @param value Value to add.
+             */
+            void addLast(ValueType value)
+            {
+                this->mutableArray().addLast(std::move(value));
+            }
+
+            /**
+             * @brief Adds an element to the beginning of the array.
+             * @param value Value to add.
+             */
+            void addFirst(ValueType value)
+            {
+                this->mutableArray().addFirst(std::move(value));
+            }
+
+            /**
+             * @brief Removes the last element from the array.
+             * @throws std::runtime_error if the array is empty.
+             */
+            void removeLast()
+            {
+                if (this->getSize() == 0)
+                    throw std::runtime_error("Cannot remove item when no item is present in array");
+
+                this->mutableArray().removeLast();
+            }
+
+            /**
+             * @brief Removes the first element from the array.
+             * @throws std::runtime_error if the array is empty.
+             */
+            void removeFirst()
+            {
+                if (this->getSize() == 0)
+                    throw std::runtime_error("Cannot remove item when no item is present in array");
+
+                this->mutableArray().removeFirst();
+            }
+
+            /**
+             * @brief Removes the element at the specified index.
+             * @param index Index of the element to remove.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void removeAt(size_t index)
+            {
+                if (index >= this->getSize())
+                    throw std::out_of_range("Index out of array bounds");
+
+                this->mutableArray().removeAt(index);
+            }
+
+            /**
+             * @brief Outputs the contents of the array to a stream.
+             * @param os Output stream.
+             * @param array The CowDynamicArray to output.
+             * @return Reference to the output stream.
+             */
+            friend std::ostream& operator<<(std::ostream& os, const CowDynamicArray<ValueType>& array)
+            {
+                if (array.pShared != nullptr)
+                    os << array.pShared->mArray;
+
+                return os;
+            }
+
+            /**
+             * @brief Returns iterator to first element, detaching shared storage and marking it unshareable.
+             * @return Instance of DynamicArrayIterator.
+             */
+            Iterator begin()
+            {
+                if (this->pShared == nullptr)
+                    return Iterator(nullptr);
+
+                return this->unshareableArray().begin();
+            }
+
+            /**
+             * @brief Returns iterator past the last element, detaching shared storage and marking it unshareable.
+             * @return Instance of DynamicArrayIterator.
+             */
+            Iterator end()
+            {
+                if (this->pShared == nullptr)
+                    return Iterator(nullptr);
+
+                return this->unshareableArray().end();
+            }
+
+            /**
+             * @brief Returns read-only iterator to first element without detaching.
+             * @return Const pointer to first element.
+             */
+            ConstIterator begin() const
+            {
+                return this->getData();
+            }
+
+            /**
+             * @brief Returns read-only iterator past the last element without detaching.
+             * @return Const pointer past the last element.
+             */
+            ConstIterator end() const
+            {
+                return this->getData() + this->getSize();
+            }
+
+        private:
+            /**
+             * @brief Gets array that can be modified, making private copy of shared storage first.
+             * @return Reference to array owned only by this instance.
+             */
+            DynamicArray<T>& mutableArray()
+            {
+                if (this->pShared == nullptr)
+                {
+                    this->pShared = new SharedArray(DynamicArray<T>());
+                }
+                else if (this->pShared->mReferences.load(std::memory_order_acquire) != 1)
+                {
+                    SharedArray* copy = new SharedArray(DynamicArray<T>(this->pShared->mArray));
+
+                    this->release();
+                    this->pShared = copy;
+                }
+
+                return this->pShared->mArray;
+            }
+
+            /**
+             * @brief Gets array that can be modified and marks it unshareable, as references to its elements escape.
+             * @return Reference to array owned only by this instance.
+             */
+            DynamicArray<T>& unshareableArray()
+            {
+                DynamicArray<T>& array = this->mutableArray();
+
+                this->pShared->mShareable = false;
+
+                return array;
+            }
+
+            /**
+             * @brief Gets storage for a copy, adding reference to shareable storage or deep-copying unshareable one.
+             * @param shared Storage of copied array, may be nullptr.
+             * @return Storage for the copy.
+             */
+            static SharedArray* share(SharedArray* shared)
+            {
+                if (shared == nullptr)
+                    return nullptr;
+
+                if (!shared->mShareable)
+                    return new SharedArray(DynamicArray<T>(shared->mArray));
+
+                shared->mReferences.fetch_add(1, std::memory_order_relaxed);
+
+                return shared;
+            }
+
+            /**
+             * @brief Drops reference to shared storage, deleting it when this was the last reference.
+             */
+            void release()
+            {
+                if (this->pShared == nullptr)
+                    return;
+
+                if (this->pShared->mReferences.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    delete this->pShared;
+
+                this->pShared = nullptr;
+            }
+    };
+}
@@ -1,6 +1,13 @@
+#pragma once
+
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <iostream>
+#include <dsa/utility/allocation_policy.h>
+#include <dsa/utility/instrumentation.h>
+#include <dsa/utility/memory.h>
 
 namespace dsa::structures::arrays
 {
@@ -122,56 +129,69 @@ namespace dsa::structures::arrays
      *
      * Provides basic dynamic array functionality such as adding, removing, and accessing elements.
      * Elements are stored in a contiguous memory block and the array resizes as needed.
+     * Removing elements shifts the remaining ones in place and keeps the buffer, so its capacity
+     * can be larger than its size and later additions reuse the spare slots.
+     * Buffers are obtained from AllocationPolicy, e.g. HugePageAllocationPolicy for very large arrays.
      *
      * @tparam T Type of elements stored in the array.
+     * @tparam AllocationPolicy Policy allocating and releasing element buffers.
      */
-    template<typename T>
+    template<typename T, typename AllocationPolicy = dsa::utility::DefaultAllocationPolicy<T>>
     class DynamicArray
     {
         private:
             T* pElements;      /// Pointer to the array elements.
             size_t mSize;      /// Number of elements in the array.
+            size_t mCapacity;  /// Number of elements the buffer can hold.
 
         public:
             using ValueType = T;
             using ReferenceType = T&;
             using ConstReferenceType = const T&;
             using PointerType = T*;
-            using Iterator = DynamicArrayIterator<DynamicArray<T>>;
+            using Iterator = DynamicArrayIterator<DynamicArray<T, AllocationPolicy>>;
 
         public:
             /**
              * @brief Default constructor. Initializes an empty array.
              */
-            DynamicArray() : pElements(nullptr), mSize(0) {}
+            DynamicArray() : pElements(nullptr), mSize(0), mCapacity(0) {}
+
+            /**
+             * @brief Constructs the array with given number of value-initialized elements.
+             * @param size Number of elements.
+             */
+            explicit DynamicArray(size_t size) : pElements(size != 0 ? allocate(size) : nullptr), mSize(size), mCapacity(size)
+            {
+                if constexpr (!AllocationPolicy::ValueInitializes)
+                {
+                    for (size_t i = 0; i < this->mSize; i++)
+                    {
+                        this->pElements[i] = ValueType();
+                    }
+                }
+            }
 
             /**
              * @brief Constructs the array from an initializer list.
              * @param array Initializer list of elements to populate the array.
              */
-            DynamicArray(std::initializer_list<T> array) : pElements(new ValueType[array.size()]), mSize(array.size())
+            DynamicArray(std::initializer_list<T> array) : pElements(array.size() != 0 ? allocate(array.size()) : nullptr), mSize(array.size()), mCapacity(array.size())
             {
-                size_t i = 0;
-
-                for (ValueType it : array)
-                {
-                    if (i >= this->mSize)
-                        break;
+                DSA_INSTRUMENT_COPIES(DynamicArray, this->mSize);
 
-                    this->pElements[i++] = it;
-                }
+                dsa::utility::copyElements(array.begin(), this->mSize, this->pElements);
             }
 
             /**
              * @brief Copy constructor. Creates a deep copy of another DynamicArray.
              * @param other The DynamicArray to copy from.
              */
-            DynamicArray(const DynamicArray<ValueType>& other) : pElements(new ValueType[other.mSize]), mSize(other.mSize)
+            DynamicArray(const DynamicArray<ValueType, AllocationPolicy>& other) : pElements(other.mSize != 0 ? allocate(other.mSize) : nullptr), mSize(other.mSize), mCapacity(other.mSize)
             {
-                for (size_t i = 0; i < this->mSize; i++)
-                {
-                    this->pElements[i] = other.pElements[i];
-                }
+                DSA_INSTRUMENT_COPIES(DynamicArray, this->mSize);
+
+                dsa::utility::copyElements(other.pElements, this->mSize, this->pElements);
             }
 
             /**
@@ -179,11 +199,8 @@ namespace dsa::structures::arrays
              */
             ~DynamicArray()
             {
-                if (this->mSize != 0)
-                {
-                    delete[] this->pElements;
-                    this->pElements = nullptr;
-                }
+                deallocate(this->pElements, this->mCapacity);
+                this->pElements = nullptr;
             }
 
             /**
@@ -194,9 +211,10 @@ namespace dsa::structures::arrays
              *
              * @param other The DynamicArray to move from.
              */
-            DynamicArray(DynamicArray<ValueType>&& other) noexcept : pElements(other.pElements), mSize(other.mSize)
+            DynamicArray(DynamicArray<ValueType, AllocationPolicy>&& other) noexcept : pElements(other.pElements), mSize(other.mSize), mCapacity(other.mCapacity)
             {
                 other.mSize = 0;
+                other.mCapacity = 0;
                 other.pElements = nullptr;
             }
 
@@ -257,6 +275,45 @@ namespace dsa::structures::arrays
                 return this->mSize;
             }
 
+            /**
+             * @brief Returns the number of elements the array can hold without reallocation.
+             * @return Capacity of the buffer.
+             */
+            constexpr size_t getCapacity() const
+            {
+                return this->mCapacity;
+            }
+
+            /**
+             * @brief Ensures the buffer can hold at least given number of elements.
+             * @param capacity Requested capacity, smaller values are ignored.
+             */
+            void reserve(size_t capacity)
+            {
+                if (capacity <= this->mCapacity)
+                    return;
+
+                this->reallocate(capacity);
+            }
+
+            /**
+             * @brief Returns pointer to the underlying contiguous storage.
+             * @return Pointer to first element, nullptr if the array is empty.
+             */
+            PointerType getData()
+            {
+                return this->pElements;
+            }
+
+            /**
+             * @brief Returns const pointer to the underlying contiguous storage.
+             * @return Const pointer to first element, nullptr if the array is empty.
+             */
+            const ValueType* getData() const
+            {
+                return this->pElements;
+            }
+
             /**
              * @brief Returns a reference to the first element.
              * @return Reference to the first element.
@@ -317,30 +374,11 @@ namespace dsa::structures::arrays
              */
             void addLast(ValueType value)
             {
-                if (this->mSize == 0)
-                {
-                    this->pElements = new ValueType[1];
-                    this->pElements[0] = value;
-                    this->mSize++;
-
-                    return;
-                }
-
-                PointerType temp;
-                temp = new ValueType[this->mSize + 1];
-
-                for (size_t i = 0; i < this->mSize; i++)
-                {
-                    temp[i] = this->pElements[i];
-                }
-
-                temp[this->mSize] = value;
+                if (this->mSize == this->mCapacity)
+                    this->reallocate(this->getGrowthCapacity());
 
+                this->pElements[this->mSize] = std::move(value);
                 this->mSize++;
-
-                delete[] this->pElements;
-
-                this->pElements = temp;
             }
 
             /**
@@ -349,34 +387,37 @@ namespace dsa::structures::arrays
              */
             void addFirst(ValueType value)
             {
-                if (this->mSize == 0)
+                if (this->mSize == this->mCapacity)
                 {
-                    this->pElements = new ValueType[1];
-                    this->pElements[0] = value;
-                    this->mSize++;
+                    size_t capacity = this->getGrowthCapacity();
+                    PointerType temp = allocate(capacity);
 
-                    return;
-                }
+                    if (this->mSize != 0)
+                    {
+                        DSA_INSTRUMENT_REALLOCATION(DynamicArray);
+                        DSA_INSTRUMENT_MOVES(DynamicArray, this->mSize);
+                    }
 
-                PointerType temp;
-                temp = new ValueType[this->mSize + 1];
+                    dsa::utility::moveElements(this->pElements, this->mSize, temp + 1);
 
-                temp[0] = value;
+                    deallocate(this->pElements, this->mCapacity);
 
-                for (size_t i = 0; i < this->mSize; i++)
+                    this->pElements = temp;
+                    this->mCapacity = capacity;
+                }
+                else
                 {
-                    temp[i + 1] = this->pElements[i];
+                    DSA_INSTRUMENT_MOVES(DynamicArray, this->mSize);
+
+                    dsa::utility::shiftElements(this->pElements, this->mSize, this->pElements + 1);
                 }
 
+                this->pElements[0] = std::move(value);
                 this->mSize++;
-
-                delete[] this->pElements;
-
-                this->pElements = temp;
             }
 
             /**
-             * @brief Removes the last element from the array.
+             * @brief Removes the last element from the array. Keeps the buffer.
              * @throws std::runtime_error if the array is empty.
              */
             void removeLast()
@@ -384,32 +425,12 @@ namespace dsa::structures::arrays
                 if (this->mSize == 0)
                     throw std::runtime_error("Cannot remove item when no item is present in array");
 
-                if (this->mSize == 1)
-                {
-                    delete[] this->pElements;
-                    this->pElements = nullptr;
-                    this->mSize--;
-
-                    return;
-                }
-
-                PointerType temp;
-                temp = new ValueType[this->mSize - 1];
-
-                for (size_t i = 0; i < this->mSize - 1; i++)
-                {
-                    temp[i] = this->pElements[i];
-                }
-
-                delete[] this->pElements;
-
-                this->pElements = temp;
-
                 this->mSize--;
+                this->releaseSlots(this->mSize, this->mSize + 1);
             }
 
             /**
-             * @brief Removes the first element from the array.
+             * @brief Removes the first element from the array by shifting remaining elements in place.
              * @throws std::runtime_error if the array is empty.
              */
             void removeFirst()
@@ -417,69 +438,82 @@ namespace dsa::structures::arrays
                 if (this->mSize == 0)
                     throw std::runtime_error("Cannot remove item when no item is present in array");
 
-                if (this->mSize == 1)
-                {
-                    delete[] this->pElements;
-                    this->pElements = nullptr;
-                    this->mSize--;
-
-                    return;
-                }
-
-                PointerType temp;
-                temp = new ValueType[this->mSize - 1];
+                this->removeAt(0);
+            }
 
-                for (size_t i = 0; i < this->mSize - 1; i++)
-                {
-                    temp[i] = this->pElements[i + 1];
-                }
+            /**
+             * @brief Removes the element at the specified index by shifting following elements in place.
+             * @param index Index of the element to remove.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void removeAt(size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
 
-                delete[] this->pElements;
+                DSA_INSTRUMENT_MOVES(DynamicArray, this->mSize - index - 1);
 
-                this->pElements = temp;
+                dsa::utility::shiftElements(this->pElements + index + 1, this->mSize - index - 1, this->pElements + index);
 
                 this->mSize--;
+                this->releaseSlots(this->mSize, this->mSize + 1);
             }
 
             /**
-             * @brief Removes the element at the specified index.
+             * @brief Removes the element at the specified index in O(1) by moving the last element into its place.
+             *
+             * Order of remaining elements is not preserved.
+             *
              * @param index Index of the element to remove.
              * @throws std::out_of_range if index is out of bounds.
              */
-            void removeAt(size_t index)
+            void swapRemove(size_t index)
             {
                 if (index >= this->mSize)
                     throw std::out_of_range("Index out of array bounds");
 
-                if (this->mSize == 1)
+                if (index != this->mSize - 1)
                 {
-                    delete[] this->pElements;
-                    this->pElements = nullptr;
-                    this->mSize--;
+                    DSA_INSTRUMENT_MOVES(DynamicArray, 1);
 
-                    return;
+                    this->pElements[index] = std::move(this->pElements[this->mSize - 1]);
                 }
 
-                PointerType temp;
-                temp = new ValueType[this->mSize - 1];
+                this->mSize--;
+                this->releaseSlots(this->mSize, this->mSize + 1);
+            }
+
+            /**
+             * @brief Removes all elements matching predicate in a single pass, preserving order of the rest.
+             * @param predicate Callable taking const reference to element, returns true if element should be removed.
+             * @return Number of removed elements.
+             */
+            template<typename Predicate>
+            size_t removeIf(Predicate predicate)
+            {
+                size_t kept = 0;
 
                 for (size_t i = 0; i < this->mSize; i++)
                 {
-                    if (i == index)
+                    if (predicate(static_cast<ConstReferenceType>(this->pElements[i])))
                         continue;
 
-                    if (i < index)
-                        temp[i] = this->pElements[i];
+                    if (kept != i)
+                    {
+                        DSA_INSTRUMENT_MOVES(DynamicArray, 1);
+
+                        this->pElements[kept] = std::move(this->pElements[i]);
+                    }
 
-                    if (i > index)
-                        temp[i - 1] = this->pElements[i];
+                    kept++;
                 }
 
-                delete[] this->pElements;
+                size_t removed = this->mSize - kept;
 
-                this->pElements = temp;
+                this->releaseSlots(kept, this->mSize);
+                this->mSize = kept;
 
-                this->mSize--;
+                return removed;
             }
 
             /**
@@ -487,20 +521,20 @@ namespace dsa::structures::arrays
              * @param other The DynamicArray to copy from.
              * @return Reference to this DynamicArray.
              */
-            DynamicArray<ValueType>& operator=(const DynamicArray<ValueType>& other)
+            DynamicArray<ValueType, AllocationPolicy>& operator=(const DynamicArray<ValueType, AllocationPolicy>& other)
             {
                 if (this == &other)
                     return *this;
 
-                delete[] this->pElements;
+                deallocate(this->pElements, this->mCapacity);
 
                 this->mSize = other.mSize;
-                this->pElements = new ValueType[this->mSize]();
+                this->mCapacity = other.mSize;
+                this->pElements = this->mSize != 0 ? allocate(this->mSize) : nullptr;
 
-                for (size_t i = 0; i < this->mSize; i++)
-                {
-                    this->pElements[i] = other.pElements[i];
-                }
+                DSA_INSTRUMENT_COPIES(DynamicArray, this->mSize);
+
+                dsa::utility::copyElements(other.pElements, this->mSize, this->pElements);
 
                 return *this;
             }
@@ -510,17 +544,19 @@ namespace dsa::structures::arrays
              * @param other The DynamicArray to move from.
              * @return Reference to this DynamicArray.
              */
-            DynamicArray<ValueType>& operator=(DynamicArray<ValueType>&& other) noexcept
+            DynamicArray<ValueType, AllocationPolicy>& operator=(DynamicArray<ValueType, AllocationPolicy>&& other) noexcept
             {
                 if (this == &other)
                     return *this;
 
-                delete[] this->pElements;
+                deallocate(this->pElements, this->mCapacity);
 
                 this->mSize = other.mSize;
+                this->mCapacity = other.mCapacity;
                 this->pElements = other.pElements;
 
                 other.mSize = 0;
+                other.mCapacity = 0;
                 other.pElements = nullptr;
 
                 return *this;
@@ -531,32 +567,28 @@ namespace dsa::structures::arrays
              * @param list Initializer list of elements to assign.
              * @return Reference to this DynamicArray.
              */
-            DynamicArray<ValueType>& operator=(const std::initializer_list<ValueType>& list)
+            DynamicArray<ValueType, AllocationPolicy>& operator=(const std::initializer_list<ValueType>& list)
             {
                 if (list.size() == 0)
                 {
-                    delete[] this->pElements;
+                    deallocate(this->pElements, this->mCapacity);
                     this->pElements = nullptr;
                     this->mSize = 0;
+                    this->mCapacity = 0;
 
                     return *this;
                 }
 
-                delete[] this->pElements;
+                deallocate(this->pElements, this->mCapacity);
 
                 this->mSize = list.size();
+                this->mCapacity = list.size();
 
-                this->pElements = new ValueType[this->mSize];
+                this->pElements = allocate(this->mSize);
 
-                size_t i = 0;
-
-                for (ValueType it : list)
-                {
-                    if (i >= this->mSize)
-                        break;
+                DSA_INSTRUMENT_COPIES(DynamicArray, this->mSize);
 
-                    this->pElements[i++] = it;
-                }
+                dsa::utility::copyElements(list.begin(), this->mSize, this->pElements);
 
                 return *this;
             }
@@ -567,7 +599,7 @@ namespace dsa::structures::arrays
              * @param array The DynamicArray to output.
              * @return Reference to the output stream.
              */
-            friend std::ostream& operator<<(std::ostream& os, const DynamicArray<ValueType>& array)
+            friend std::ostream& operator<<(std::ostream& os, const DynamicArray<ValueType, AllocationPolicy>& array)
             {
                 for (size_t i = 0; i < array.mSize; i++)
                 {
@@ -594,5 +626,91 @@ namespace dsa::structures::arrays
             {
                 return Iterator(this->pElements + this->mSize);
             }
+
+        private:
+            /**
+             * @brief Gets capacity of full array after adding an element, see AllocationPolicy::GrowsGeometrically.
+             * @return New capacity.
+             */
+            size_t getGrowthCapacity() const
+            {
+                if constexpr (AllocationPolicy::GrowsGeometrically)
+                    return this->mCapacity == 0 ? 1 : this->mCapacity * 2;
+                else
+                    return this->mSize + 1;
+            }
+
+            /**
+             * @brief Moves elements into new buffer of given capacity.
+             * @param capacity New capacity, must not be smaller than size.
+             */
+            void reallocate(size_t capacity)
+            {
+                PointerType temp = allocate(capacity);
+
+                if (this->mSize != 0)
+                {
+                    DSA_INSTRUMENT_REALLOCATION(DynamicArray);
+                    DSA_INSTRUMENT_MOVES(DynamicArray, this->mSize);
+                }
+
+                dsa::utility::moveElements(this->pElements, this->mSize, temp);
+
+                deallocate(this->pElements, this->mCapacity);
+
+                this->pElements = temp;
+                this->mCapacity = capacity;
+            }
+
+            /**
+             * @brief Resets slots vacated by removal so they do not keep resources alive.
+             * @param from Index of first vacated slot.
+             * @param to Index past the last vacated slot.
+             */
+            void releaseSlots(size_t from, size_t to)
+            {
+                if constexpr (!std::is_trivially_copyable_v<ValueType>)
+                {
+                    for (size_t i = from; i < to; i++)
+                    {
+                        this->pElements[i] = ValueType();
+                    }
+                }
+            }
+
+            /**
+             * @brief Allocates buffer for given number of elements.
+             * @param count Number of elements.
+             * @return Pointer to allocated buffer.
+             */
+            static PointerType allocate(size_t count)
+            {
+                DSA_INSTRUMENT_ALLOCATION(DynamicArray, count * sizeof(ValueType));
+
+                return AllocationPolicy::allocate(count);
+            }
+
+            /**
+             * @brief Releases buffer allocated by allocate().
+             * @param elements Pointer to buffer, may be nullptr.
+             * @param count Number of elements in buffer.
+             */
+            static void deallocate(PointerType elements, size_t count)
+            {
+                if (elements == nullptr)
+                    return;
+
+                DSA_INSTRUMENT_DEALLOCATION(DynamicArray, count * sizeof(ValueType));
+
+                AllocationPolicy::deallocate(elements, count);
+            }
     };
+
+    /**
+     * @brief DynamicArray whose buffer starts at given alignment, e.g. 32 or 64 bytes for aligned SIMD loads.
+     * @tparam T Type of elements stored in the array.
+     * @tparam Alignment Alignment of buffer in bytes.
+     */
+    template<typename T, size_t Alignment>
+    using AlignedDynamicArray = DynamicArray<T, dsa::utility::AlignedAllocationPolicy<T, Alignment>>;
 }
@@ -0,0 +1,437 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+
+/**
+ * Element-wise arithmetic on DynamicArray and StaticArray by expression templates. Operators +, -, *
+ * and / between arrays, expressions and scalars do not compute anything, they build a lightweight
+ * expression object describing the computation. Only evaluate(), assign() or compound assignment
+ * walk the expression, in one loop that computes every element of a + b * c at once without
+ * temporary arrays, which compilers vectorize.
+ *
+ * Sizes of StaticArrays are checked at compile time, sizes involving DynamicArray when expression is
+ * built. Expressions refer to their operands, so they must be evaluated before operands are destroyed.
+ */
+namespace dsa::structures::arrays
+{
+    constexpr size_t DynamicExtent = std::numeric_limits<size_t>::max();        /// Size known only at runtime.
+    constexpr size_t ScalarExtent = std::numeric_limits<size_t>::max() - 1;     /// Operand broadcast to every size.
+
+    /**
+     * @brief Base of expression types, marks operands of element-wise operators.
+     */
+    struct ExpressionBase {};
+
+    /**
+     * @brief Leaf expression reading elements of array.
+     * @tparam T Type of elements.
+     * @tparam Extent Compile-time size or DynamicExtent.
+     */
+    template<typename T, size_t Extent>
+    class ArrayOperand : public ExpressionBase
+    {
+        private:
+            const T* pElements;     /// Pointer to elements of array.
+            size_t mSize;           /// Number of elements.
+
+        public:
+            using ValueType = T;
+            static constexpr size_t StaticExtent = Extent;
+
+        public:
+            ArrayOperand(const T* elements, size_t size) : pElements(elements), mSize(size) {}
+
+            const T& operator[](const size_t index) const
+            {
+                return this->pElements[index];
+            }
+
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+    };
+
+    /**
+     * @brief Leaf expression repeating one value for every index.
+     * @tparam T Type of value.
+     */
+    template<typename T>
+    class ScalarOperand : public ExpressionBase
+    {
+        private:
+            T mValue;               /// Broadcast value.
+
+        public:
+            using ValueType = T;
+            static constexpr size_t StaticExtent = ScalarExtent;
+
+        public:
+            explicit ScalarOperand(T value) : mValue(value) {}
+
+            const T& operator[](const size_t) const
+            {
+                return this->mValue;
+            }
+
+            size_t getSize() const
+            {
+                return 0;
+            }
+    };
+
+    /**
+     * @brief Expression applying operation to elements of two expressions at the same index.
+     * @tparam Left Left operand expression.
+     * @tparam Right Right operand expression.
+     * @tparam Op Binary operation.
+     */
+    template<typename Left, typename Right, typename Op>
+    class BinaryExpression : public ExpressionBase
+    {
+        static_assert(Left::StaticExtent == Right::StaticExtent
+            || Left::StaticExtent == DynamicExtent || Right::StaticExtent == DynamicExtent
+            || Left::StaticExtent == ScalarExtent || Right::StaticExtent == ScalarExtent,
+            "Sizes of StaticArray operands do not match");
+
+        private:
+            Left mLeft;             /// Left operand.
+            Right mRight;           /// Right operand.
+
+        public:
+            using ValueType = std::decay_t<std::invoke_result_t<Op, const typename Left::ValueType&, const typename Right::ValueType&>>;
+            static constexpr size_t StaticExtent = Left::StaticExtent == ScalarExtent ? Right::StaticExtent
+                : Right::StaticExtent == ScalarExtent ? Left::StaticExtent
+                : Left::StaticExtent == DynamicExtent ? Right::StaticExtent
+                : Left::StaticExtent;
+
+        public:
+            /**
+             * @brief Constructs expression.
+             * @param left Left operand.
+             * @param right Right operand.
+             * @throws std::runtime_error if runtime sizes of operands differ.
+             */
+            BinaryExpression(Left left, Right right) : mLeft(std::move(left)), mRight(std::move(right))
+            {
+                if constexpr (Left::StaticExtent != ScalarExtent && Right::StaticExtent != ScalarExtent)
+                {
+                    if (this->mLeft.getSize() != this->mRight.getSize())
+                        throw std::runtime_error("Sizes of array operands do not match");
+                }
+            }
+
+            ValueType operator[](const size_t index) const
+            {
+                return Op()(this->mLeft[index], this->mRight[index]);
+            }
+
+            size_t getSize() const
+            {
+                return Left::StaticExtent == ScalarExtent ? this->mRight.getSize() : this->mLeft.getSize();
+            }
+    };
+
+    /**
+     * @brief Expression negating elements of operand.
+     * @tparam Operand Operand expression.
+     */
+    template<typename Operand>
+    class NegateExpression : public ExpressionBase
+    {
+        private:
+            Operand mOperand;       /// Negated operand.
+
+        public:
+            using ValueType = std::decay_t<decltype(-std::declval<const typename Operand::ValueType&>())>;
+            static constexpr size_t StaticExtent = Operand::StaticExtent;
+
+        public:
+            explicit NegateExpression(Operand operand) : mOperand(std::move(operand)) {}
+
+            ValueType operator[](const size_t index) const
+            {
+                return -this->mOperand[index];
+            }
+
+            size_t getSize() const
+            {
+                return this->mOperand.getSize();
+            }
+    };
+
+    namespace detail
+    {
+        template<typename Type>
+        struct IsArray : std::false_type {};
+
+        template<typename T, typename AllocationPolicy>
+        struct IsArray<DynamicArray<T, AllocationPolicy>> : std::true_type {};
+
+        template<typename T, size_t size, size_t Alignment>
+        struct IsArray<StaticArray<T, size, Alignment>> : std::true_type {};
+
+        template<typename Type>
+        constexpr bool IsExpressionOrArray = std::is_base_of_v<ExpressionBase, Type> || IsArray<Type>::value;
+
+        template<typename Type>
+        constexpr bool IsOperand = IsExpressionOrArray<Type> || std::is_arithmetic_v<Type>;
+
+        template<typename Left, typename Right>
+        using EnableIfOperands = std::enable_if_t<(IsExpressionOrArray<Left> || IsExpressionOrArray<Right>) && IsOperand<Left> && IsOperand<Right>>;
+
+        template<typename T, typename AllocationPolicy>
+        ArrayOperand<T, DynamicExtent> toOperand(const DynamicArray<T, AllocationPolicy>& array)
+        {
+            return ArrayOperand<T, DynamicExtent>(array.getData(), array.getSize());
+        }
+
+        template<typename T, size_t size, size_t Alignment>
+        ArrayOperand<T, size> toOperand(const StaticArray<T, size, Alignment>& array)
+        {
+            return ArrayOperand<T, size>(array.getData(), size);
+        }
+
+        template<typename Type, typename = std::enable_if_t<std::is_base_of_v<ExpressionBase, Type>>>
+        const Type& toOperand(const Type& expression)
+        {
+            return expression;
+        }
+
+        template<typename Type, typename = std::enable_if_t<std::is_arithmetic_v<Type>>, typename = void>
+        ScalarOperand<Type> toOperand(Type value)
+        {
+            return ScalarOperand<Type>(value);
+        }
+
+        template<typename Type>
+        using OperandOf = std::decay_t<decltype(toOperand(std::declval<const Type&>()))>;
+
+        template<typename Op, typename Left, typename Right>
+        BinaryExpression<OperandOf<Left>, OperandOf<Right>, Op> combine(const Left& left, const Right& right)
+        {
+            return BinaryExpression<OperandOf<Left>, OperandOf<Right>, Op>(toOperand(left), toOperand(right));
+        }
+
+        /**
+         * @brief Writes elements of expression into destination in one loop.
+         * @param destination Pointer to destination elements.
+         * @param size Number of elements of destination.
+         * @param expression Expression to evaluate.
+         * @param op Operation combining old destination element with expression element.
+         */
+        template<typename T, typename Expression, typename Op>
+        void evaluateInto(T* destination, size_t size, const Expression& expression, Op op)
+        {
+            if constexpr (Expression::StaticExtent != ScalarExtent)
+            {
+                if (expression.getSize() != size)
+                    throw std::runtime_error("Sizes of array operands do not match");
+            }
+
+            for (size_t i = 0; i < size; i++)
+            {
+                destination[i] = op(destination[i], expression[i]);
+            }
+        }
+
+        /**
+         * @brief Checks at compile time that expression fits array whose size is known at compile time.
+         */
+        template<typename Array, typename Expression>
+        constexpr void checkExtents()
+        {
+            constexpr size_t arrayExtent = OperandOf<Array>::StaticExtent;
+            constexpr size_t expressionExtent = OperandOf<Expression>::StaticExtent;
+
+            static_assert(expressionExtent >= ScalarExtent || arrayExtent == DynamicExtent || expressionExtent == arrayExtent,
+                "Sizes of StaticArray operands do not match");
+        }
+
+        /**
+         * @brief Operation returning its right argument, used by plain assignment.
+         */
+        struct Second
+        {
+            template<typename First, typename Value>
+            Value&& operator()(const First&, Value&& value) const
+            {
+                return std::forward<Value>(value);
+            }
+        };
+    }
+
+    /**
+     * @brief Builds expression of element-wise sum, scalars are broadcast.
+     * @param left Array, expression or scalar.
+     * @param right Array, expression or scalar.
+     * @return Unevaluated expression.
+     * @throws std::runtime_error if runtime sizes do not match.
+     */
+    template<typename Left, typename Right, typename = detail::EnableIfOperands<Left, Right>>
+    auto operator+(const Left& left, const Right& right)
+    {
+        return detail::combine<std::plus<>>(left, right);
+    }
+
+    /**
+     * @brief Builds expression of element-wise difference, scalars are broadcast.
+     * @param left Array, expression or scalar.
+     * @param right Array, expression or scalar.
+     * @return Unevaluated expression.
+     * @throws std::runtime_error if runtime sizes do not match.
+     */
+    template<typename Left, typename Right, typename = detail::EnableIfOperands<Left, Right>>
+    auto operator-(const Left& left, const Right& right)
+    {
+        return detail::combine<std::minus<>>(left, right);
+    }
+
+    /**
+     * @brief Builds expression of element-wise product, scalars are broadcast.
+     * @param left Array, expression or scalar.
+     * @param right Array, expression or scalar.
+     * @return Unevaluated expression.
+     * @throws std::runtime_error if runtime sizes do not match.
+     */
+    template<typename Left, typename Right, typename = detail::EnableIfOperands<Left, Right>>
+    auto operator*(const Left& left, const Right& right)
+    {
+        return detail::combine<std::multiplies<>>(left, right);
+    }
+
+    /**
+     * @brief Builds expression of element-wise quotient, scalars are broadcast.
+     * @param left Array, expression or scalar.
+     * @param right Array, expression or scalar.
+     * @return Unevaluated expression.
+     * @throws std::runtime_error if runtime sizes do not match.
+     */
+    template<typename Left, typename Right, typename = detail::EnableIfOperands<Left, Right>>
+    auto operator/(const Left& left, const Right& right)
+    {
+        return detail::combine<std::divides<>>(left, right);
+    }
+
+    /**
+     * @brief Builds expression of element-wise negation.
+     * @param operand Array or expression.
+     * @return Unevaluated expression.
+     */
+    template<typename Operand, typename = std::enable_if_t<detail::IsExpressionOrArray<Operand>>>
+    auto operator-(const Operand& operand)
+    {
+        return NegateExpression<detail::OperandOf<Operand>>(detail::toOperand(operand));
+    }
+
+    /**
+     * @brief Evaluates expression into new array.
+     * @param expression Expression or array.
+     * @return StaticArray if size is known at compile time, DynamicArray otherwise.
+     */
+    template<typename Expression, typename = std::enable_if_t<detail::IsExpressionOrArray<Expression>>>
+    auto evaluate(const Expression& expression)
+    {
+        using Operand = detail::OperandOf<Expression>;
+        using ValueType = typename Operand::ValueType;
+
+        const Operand& operand = detail::toOperand(expression);
+
+        if constexpr (Operand::StaticExtent != DynamicExtent)
+        {
+            StaticArray<ValueType, Operand::StaticExtent> result;
+
+            detail::evaluateInto(result.getData(), Operand::StaticExtent, operand, detail::Second());
+
+            return result;
+        }
+        else
+        {
+            DynamicArray<ValueType> result(operand.getSize());
+
+            detail::evaluateInto(result.getData(), result.getSize(), operand, detail::Second());
+
+            return result;
+        }
+    }
+
+    /**
+     * @brief Evaluates expression into existing array without allocation.
+     * @param destination Array to overwrite, may be operand of expression.
+     * @param expression Expression of the same size.
+     * @throws std::runtime_error if sizes do not match.
+     */
+    template<typename Array, typename Expression, typename = std::enable_if_t<detail::IsArray<Array>::value && detail::IsOperand<Expression>>>
+    void assign(Array& destination, const Expression& expression)
+    {
+        detail::checkExtents<Array, Expression>();
+        detail::evaluateInto(destination.getData(), destination.getSize(), detail::toOperand(expression), detail::Second());
+    }
+
+    /**
+     * @brief Adds expression to array element-wise, in one loop without allocation.
+     * @param destination Array to update.
+     * @param expression Expression, array or scalar.
+     * @return Reference to destination.
+     * @throws std::runtime_error if sizes do not match.
+     */
+    template<typename Array, typename Expression, typename = std::enable_if_t<detail::IsArray<Array>::value && detail::IsOperand<Expression>>>
+    Array& operator+=(Array& destination, const Expression& expression)
+    {
+        detail::checkExtents<Array, Expression>();
+        detail::evaluateInto(destination.getData(), destination.getSize(), detail::toOperand(expression), std::plus<>());
+        return destination;
+    }
+
+    /**
+     * @brief Subtracts expression from array element-wise, in one loop without allocation.
+     * @param destination Array to update.
+     * @param expression Expression, array or scalar.
+     * @return Reference to destination.
+     * @throws std::runtime_error if sizes do not match.
+     */
+    template<typename Array, typename Expression, typename = std::enable_if_t<detail::IsArray<Array>::value && detail::IsOperand<Expression>>>
+    Array& operator-=(Array& destination, const Expression& expression)
+    {
+        detail::checkExtents<Array, Expression>();
+        detail::evaluateInto(destination.getData(), destination.getSize(), detail::toOperand(expression), std::minus<>());
+        return destination;
+    }
+
+    /**
+     * @brief Multiplies array by expression element-wise, in one loop without allocation.
+     * @param destination Array to update.
+     * @param expression Expression, array or scalar.
+     * @return Reference to destination.
+     * @throws std::runtime_error if sizes do not match.
+     */
+    template<typename Array, typename Expression, typename = std::enable_if_t<detail::IsArray<Array>::value && detail::IsOperand<Expression>>>
+    Array& operator*=(Array& destination, const Expression& expression)
+    {
+        detail::checkExtents<Array, Expression>();
+        detail::evaluateInto(destination.getData(), destination.getSize(), detail::toOperand(expression), std::multiplies<>());
+        return destination;
+    }
+
+    /**
+     * @brief Divides array by expression element-wise, in one loop without allocation.
+     * @param destination Array to update.
+     * @param expression Expression, array or scalar.
+     * @return Reference to destination.
+     * @throws std::runtime_error if sizes do not match.
+     */
+    template<typename Array, typename Expression, typename = std::enable_if_t<detail::IsArray<Array>::value && detail::IsOperand<Expression>>>
+    Array& operator/=(Array& destination, const Expression& expression)
+    {
+        detail::checkExtents<Array, Expression>();
+        detail::evaluateInto(destination.getData(), destination.getSize(), detail::toOperand(expression), std::divides<>());
+        return destination;
+    }
+}
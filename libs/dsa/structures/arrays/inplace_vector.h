@@ -0,0 +1,475 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/instrumentation.h>
+#include <dsa/utility/memory.h>
+
+namespace dsa::structures::arrays
+{
+    /**
+     * @brief Variable size array with fixed capacity stored inline, without heap allocation.
+     *
+     * Offers the DynamicArray API over uninitialized storage for N elements that lives inside the
+     * object itself, so the array can be placed on stack or inside another object. Only slots below
+     * the size hold constructed elements. Adding to a full array throws.
+     *
+     * @tparam T Type of elements stored in the array.
+     * @tparam N Capacity of the array.
+     */
+    template<typename T, size_t N>
+    class InplaceVector
+    {
+        private:
+            alignas(T) unsigned char mStorage[N == 0 ? 1 : N * sizeof(T)];  /// Uninitialized storage of elements.
+            size_t mSize;                                                   /// Number of constructed elements.
+
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using ConstReferenceType = const T&;
+            using PointerType = T*;
+            using Iterator = DynamicArrayIterator<InplaceVector<T, N>>;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty array.
+             */
+            InplaceVector() : mSize(0) {}
+
+            /**
+             * @brief Constructs the array from an initializer list.
+             * @param list Initializer list of elements.
+             * @throws std::runtime_error if list is longer than capacity.
+             */
+            InplaceVector(std::initializer_list<T> list) : mSize(0)
+            {
+                if (list.size() > N)
+                    throw std::runtime_error("Entered array size exceeds capacity");
+
+                DSA_INSTRUMENT_COPIES(InplaceVector, list.size());
+
+                for (const T& value : list)
+                {
+                    new (this->getSlot(this->mSize)) T(value);
+                    this->mSize++;
+                }
+            }
+
+            /**
+             * @brief Copy constructor.
+             * @param other The InplaceVector to copy from.
+             */
+            InplaceVector(const InplaceVector<T, N>& other) : mSize(0)
+            {
+                DSA_INSTRUMENT_COPIES(InplaceVector, other.mSize);
+
+                this->copyFrom(other);
+            }
+
+            /**
+             * @brief Move constructor. Moves elements of other array, which keeps its size.
+             * @param other The InplaceVector to move from.
+             */
+            InplaceVector(InplaceVector<T, N>&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : mSize(0)
+            {
+                DSA_INSTRUMENT_MOVES(InplaceVector, other.mSize);
+
+                for (size_t i = 0; i < other.mSize; i++)
+                {
+                    new (this->getSlot(i)) T(std::move(other.getData()[i]));
+                    this->mSize++;
+                }
+            }
+
+            /**
+             * @brief Destructor. Destroys constructed elements.
+             */
+            ~InplaceVector()
+            {
+                this->clear();
+            }
+
+            /**
+             * @brief Copy assignment operator.
+             * @param other The InplaceVector to copy from.
+             * @return Reference to this InplaceVector.
+             */
+            InplaceVector<T, N>& operator=(const InplaceVector<T, N>& other)
+            {
+                if (this == &other)
+                    return *this;
+
+                DSA_INSTRUMENT_COPIES(InplaceVector, other.mSize);
+
+                this->clear();
+                this->copyFrom(other);
+
+                return *this;
+            }
+
+            /**
+             * @brief Move assignment operator.
+             * @param other The InplaceVector to move from.
+             * @return Reference to this InplaceVector.
+             */
+            InplaceVector<T, N>& operator=(InplaceVector<T, N>&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            {
+                if (this == &other)
+                    return *this;
+
+                DSA_INSTRUMENT_MOVES(InplaceVector, other.mSize);
+
+                this->clear();
+
+                for (size_t i = 0; i < other.mSize; i++)
+                {
+                    new (this->getSlot(i)) T(std::move(other.getData()[i]));
+                    this->mSize++;
+                }
+
+                return *this;
+            }
+
+            /**
+             * @brief Returns a reference to the element at the specified index.
+             * @param index Index of the element to access.
+             * @return Reference to the element.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ReferenceType get(const size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->getData()[index];
+            }
+
+            /**
+             * @brief Returns a const reference to the element at the specified index.
+             * @param index Index of the element to access.
+             * @return Const reference to the element.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ConstReferenceType get(const size_t index) const
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->getData()[index];
+            }
+
+            /**
+             * @brief Array subscript operator.
+             * @param index Index of the element to access.
+             * @return Reference to the element.
+             */
+            ReferenceType operator[](const size_t index)
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Array subscript operator (const version).
+             * @param index Index of the element to access.
+             * @return Const reference to the element.
+             */
+            ConstReferenceType operator[](const size_t index) const
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Returns the number of elements in the array.
+             * @return Number of elements.
+             */
+            constexpr size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns the maximal number of elements.
+             * @return Capacity N.
+             */
+            static constexpr size_t getCapacity()
+            {
+                return N;
+            }
+
+            /**
+             * @brief Checks whether the array is empty.
+             * @return True if the array has no elements.
+             */
+            bool isEmpty() const
+            {
+                return this->mSize == 0;
+            }
+
+            /**
+             * @brief Checks whether the array is full.
+             * @return True if size equals capacity.
+             */
+            bool isFull() const
+            {
+                return this->mSize == N;
+            }
+
+            /**
+             * @brief Returns pointer to the inline storage.
+             *
+             * Pointer is laundered only when the first element is alive, as std::launder requires.
+             *
+             * @return Pointer to first element.
+             */
+            PointerType getData()
+            {
+                T* data = reinterpret_cast<T*>(this->mStorage);
+
+                return this->mSize != 0 ? std::launder(data) : data;
+            }
+
+            /**
+             * @brief Returns const pointer to the inline storage.
+             * @return Const pointer to first element.
+             */
+            const ValueType* getData() const
+            {
+                const T* data = reinterpret_cast<const T*>(this->mStorage);
+
+                return this->mSize != 0 ? std::launder(data) : data;
+            }
+
+            /**
+             * @brief Returns a reference to the first element.
+             * @return Reference to the first element.
+             * @throws std::out_of_range if the array is empty.
+             */
+            ReferenceType first()
+            {
+                return this->get(0);
+            }
+
+            /**
+             * @brief Returns a reference to the last element.
+             * @return Reference to the last element.
+             * @throws std::out_of_range if the array is empty.
+             */
+            ReferenceType last()
+            {
+                return this->get(this->mSize - 1);
+            }
+
+            /**
+             * @brief Sets the value at the specified index.
+             * @param index Index of the element to set.
+             * @param value Value to assign.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void set(size_t index, ValueType value)
+            {
+                this->get(index) = std::move(value);
+            }
+
+            /**
+             * @brief Adds an element to the end of the array.
+             * @param value Value to add.
+             * @throws std::runtime_error if the array is full.
+             */
+            void addLast(ValueType value)
+            {
+                if (this->mSize == N)
+                    throw std::runtime_error("Cannot add item when array is full");
+
+                new (this->getSlot(this->mSize)) T(std::move(value));
+                this->mSize++;
+            }
+
+            /**
+             * @brief Constructs an element in place at the end of the array.
+             * @param args Arguments passed to constructor of element.
+             * @return Reference to the new element.
+             * @throws std::runtime_error if the array is full.
+             */
+            template<typename... Args>
+            ReferenceType emplaceLast(Args&&... args)
+            {
+                if (this->mSize == N)
+                    throw std::runtime_error("Cannot add item when array is full");
+
+                T* element = new (this->getSlot(this->mSize)) T(std::forward<Args>(args)...);
+                this->mSize++;
+
+                return *element;
+            }
+
+            /**
+             * @brief Removes the last element from the array.
+             * @throws std::runtime_error if the array is empty.
+             */
+            void removeLast()
+            {
+                if (this->mSize == 0)
+                    throw std::runtime_error("Cannot remove item when no item is present in array");
+
+                this->mSize--;
+                this->getData()[this->mSize].~T();
+            }
+
+            /**
+             * @brief Removes the first element from the array.
+             * @throws std::runtime_error if the array is empty.
+             */
+            void removeFirst()
+            {
+                if (this->mSize == 0)
+                    throw std::runtime_error("Cannot remove item when no item is present in array");
+
+                this->removeAt(0);
+            }
+
+            /**
+             * @brief Removes the element at the specified index by shifting following elements.
+             * @param index Index of the element to remove.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void removeAt(size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                T* data = this->getData();
+
+                dsa::utility::shiftElements(data + index + 1, this->mSize - index - 1, data + index);
+                this->removeLast();
+            }
+
+            /**
+             * @brief Removes the element at the specified index in O(1) by moving the last element into its place.
+             * @param index Index of the element to remove.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void swapRemove(size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                if (index != this->mSize - 1)
+                    this->getData()[index] = std::move(this->getData()[this->mSize - 1]);
+
+                this->removeLast();
+            }
+
+            /**
+             * @brief Removes all elements matching predicate in a single pass, preserving order of the rest.
+             * @param predicate Callable taking const reference to element, returns true if element should be removed.
+             * @return Number of removed elements.
+             */
+            template<typename Predicate>
+            size_t removeIf(Predicate predicate)
+            {
+                T* data = this->getData();
+                size_t kept = 0;
+
+                for (size_t i = 0; i < this->mSize; i++)
+                {
+                    if (predicate(static_cast<ConstReferenceType>(data[i])))
+                        continue;
+
+                    if (kept != i)
+                        data[kept] = std::move(data[i]);
+
+                    kept++;
+                }
+
+                size_t removed = this->mSize - kept;
+
+                while (this->mSize > kept)
+                {
+                    this->removeLast();
+                }
+
+                return removed;
+            }
+
+            /**
+             * @brief Destroys all elements.
+             */
+            void clear()
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < this->mSize; i++)
+                    {
+                        this->getData()[i].~T();
+                    }
+                }
+
+                this->mSize = 0;
+            }
+
+            /**
+             * @brief Outputs the contents of the array to a stream.
+             * @param os Output stream.
+             * @param array The InplaceVector to output.
+             * @return Reference to the output stream.
+             */
+            friend std::ostream& operator<<(std::ostream& os, const InplaceVector<T, N>& array)
+            {
+                for (size_t i = 0; i < array.mSize; i++)
+                {
+                    os << "Index: " << i << " | Value: " << array.getData()[i] << std::endl;
+                }
+
+                return os;
+            }
+
+            /**
+             * @brief Returns iterator to the first element.
+             * @return Instance of DynamicArrayIterator.
+             */
+            Iterator begin()
+            {
+                return Iterator(this->getData());
+            }
+
+            /**
+             * @brief Returns iterator past the last element.
+             * @return Instance of DynamicArrayIterator.
+             */
+            Iterator end()
+            {
+                return Iterator(this->getData() + this->mSize);
+            }
+
+        private:
+            /**
+             * @brief Gets storage of element slot as placement new target, no element has to live there.
+             * @param index Index of slot.
+             * @return Pointer to slot storage.
+             */
+            T* getSlot(size_t index)
+            {
+                return reinterpret_cast<T*>(this->mStorage) + index;
+            }
+
+            /**
+             * @brief Copy constructs elements of other array into empty storage.
+             * @param other Array to copy from.
+             */
+            void copyFrom(const InplaceVector<T, N>& other)
+            {
+                for (size_t i = 0; i < other.mSize; i++)
+                {
+                    new (this->getSlot(i)) T(other.getData()[i]);
+                    this->mSize++;
+                }
+            }
+    };
+}
@@ -0,0 +1,517 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/intrinsics.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSA_PACKED_SSE2 1
+#endif
+
+namespace dsa::structures::arrays
+{
+    /**
+     * @brief Read-only array of 32-bit unsigned integers compressed by blocks.
+     *
+     * Values are split into blocks of BlockSize. Every block stores only differences from a base
+     * value using the minimal number of bits that fits the largest of them:
+     * - frame of reference: value minus the minimum of the block, random access in O(1),
+     * - delta: value minus the value four positions earlier, chosen for non-decreasing blocks when
+     *   it needs fewer bits, random access sums up to BlockSize / 4 deltas.
+     *
+     * Block is laid out in four interleaved lanes, value i goes to lane i % 4 and lanes advance in
+     * lockstep word by word. One 128-bit load thus brings the next packed word of all four lanes,
+     * so SSE2 decodes four values per shift and mask, and the delta of value i - 4 makes prefix sum
+     * of deltas a single vector add per four values. Decoding falls back to the same scheme in
+     * scalar code without SSE2.
+     */
+    class PackedIntArray
+    {
+        public:
+            static constexpr size_t BlockSize = 128;    /// Number of values per block.
+            static constexpr size_t Lanes = 4;          /// Number of interleaved lanes of block.
+
+            /**
+             * @brief Encoding of block.
+             */
+            enum class Encoding : uint8_t
+            {
+                FrameOfReference,   /// Values stored as difference from the minimum of block.
+                Delta               /// Values stored as difference from the value Lanes positions earlier.
+            };
+
+        private:
+            /**
+             * @brief Header of block, locates its packed words.
+             */
+            struct BlockHeader
+            {
+                uint32_t mBase = 0;                                 /// Minimum of block, or its first value for delta.
+                uint32_t mOffset = 0;                               /// Index of first packed word of block.
+                uint8_t mBitWidth = 0;                              /// Bits per packed value, 0 to 32.
+                Encoding mEncoding = Encoding::FrameOfReference;    /// Encoding of block.
+            };
+
+            DynamicArray<BlockHeader> mHeaders;     /// Header of every block.
+            DynamicArray<uint32_t> mWords;          /// Packed words of all blocks.
+            size_t mSize;                           /// Number of values.
+
+        public:
+            using ValueType = uint32_t;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty array.
+             */
+            PackedIntArray() : mHeaders(), mWords(), mSize(0) {}
+
+            /**
+             * @brief Compresses values.
+             * @param values Pointer to values.
+             * @param size Number of values.
+             */
+            PackedIntArray(const uint32_t* values, size_t size) : mHeaders(), mWords(), mSize(0)
+            {
+                this->encode(values, size);
+            }
+
+            /**
+             * @brief Compresses values of array.
+             * @param values Array of values.
+             */
+            explicit PackedIntArray(const DynamicArray<uint32_t>& values) : mHeaders(), mWords(), mSize(0)
+            {
+                this->encode(values.getData(), values.getSize());
+            }
+
+            /**
+             * @brief Compresses values of initializer list.
+             * @param values Initializer list of values.
+             */
+            PackedIntArray(std::initializer_list<uint32_t> values) : mHeaders(), mWords(), mSize(0)
+            {
+                this->encode(values.begin(), values.size());
+            }
+
+            /**
+             * @brief Decodes value at specific index.
+             * @param index Index of value.
+             * @return Value.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ValueType get(const size_t index) const
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                const BlockHeader& header = this->mHeaders[index / BlockSize];
+                const uint32_t* words = this->mWords.getData() + header.mOffset;
+                size_t position = index % BlockSize;
+                size_t lane = position % Lanes;
+                size_t step = position / Lanes;
+
+                if (header.mEncoding == Encoding::FrameOfReference)
+                    return header.mBase + extract(words, lane, step, header.mBitWidth);
+
+                uint32_t value = header.mBase;
+
+                for (size_t k = 0; k <= step; k++)
+                {
+                    value += extract(words, lane, k, header.mBitWidth);
+                }
+
+                return value;
+            }
+
+            /**
+             * @brief Decodes value at specific index using operator[].
+             * @param index Index of value.
+             * @return Value.
+             */
+            ValueType operator[](const size_t index) const
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Returns the number of values.
+             * @return Number of values.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Checks whether the array is empty.
+             * @return True if the array has no values.
+             */
+            bool isEmpty() const
+            {
+                return this->mSize == 0;
+            }
+
+            /**
+             * @brief Returns the number of blocks.
+             * @return Number of blocks, the last one may be partial.
+             */
+            size_t getBlockCount() const
+            {
+                return this->mHeaders.getSize();
+            }
+
+            /**
+             * @brief Returns encoding chosen for block.
+             * @param block Index of block.
+             * @return Encoding of block.
+             * @throws std::out_of_range if block is out of bounds.
+             */
+            Encoding getEncoding(size_t block) const
+            {
+                return this->mHeaders.get(block).mEncoding;
+            }
+
+            /**
+             * @brief Returns bits per value of block.
+             * @param block Index of block.
+             * @return Bit width of block, 0 to 32.
+             * @throws std::out_of_range if block is out of bounds.
+             */
+            unsigned getBitWidth(size_t block) const
+            {
+                return this->mHeaders.get(block).mBitWidth;
+            }
+
+            /**
+             * @brief Returns memory used by headers and packed words.
+             * @return Compressed size in bytes.
+             */
+            size_t getCompressedBytes() const
+            {
+                return this->mHeaders.getSize() * sizeof(BlockHeader) + this->mWords.getSize() * sizeof(uint32_t);
+            }
+
+            /**
+             * @brief Returns ratio of uncompressed to compressed size.
+             * @return Compression ratio, 1 for empty array.
+             */
+            double getCompressionRatio() const
+            {
+                size_t compressed = this->getCompressedBytes();
+
+                return compressed != 0 ? static_cast<double>(this->mSize * sizeof(uint32_t)) / compressed : 1.0;
+            }
+
+            /**
+             * @brief Decodes whole block.
+             * @param block Index of block.
+             * @param output Pointer to at least BlockSize values, the whole block is written even if partial.
+             * @return Number of valid values of block.
+             * @throws std::out_of_range if block is out of bounds.
+             */
+            size_t decodeBlock(size_t block, uint32_t* output) const
+            {
+                const BlockHeader& header = this->mHeaders.get(block);
+
+                decodeWords(this->mWords.getData() + header.mOffset, header, output);
+
+                return block + 1 == this->mHeaders.getSize() ? this->mSize - block * BlockSize : BlockSize;
+            }
+
+            /**
+             * @brief Decodes all values.
+             * @param output Pointer to getSize() values.
+             */
+            void decode(uint32_t* output) const
+            {
+                size_t fullBlocks = this->mSize / BlockSize;
+
+                for (size_t block = 0; block < fullBlocks; block++)
+                {
+                    this->decodeBlock(block, output + block * BlockSize);
+                }
+
+                if (fullBlocks != this->mHeaders.getSize())
+                {
+                    uint32_t buffer[BlockSize];
+                    size_t count = this->decodeBlock(fullBlocks, buffer);
+
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        output[fullBlocks * BlockSize + i] = buffer[i];
+                    }
+                }
+            }
+
+            /**
+             * @brief Decodes all values into new array.
+             * @return Array of getSize() values.
+             */
+            DynamicArray<uint32_t> decode() const
+            {
+                DynamicArray<uint32_t> result(this->mSize);
+
+                this->decode(result.getData());
+
+                return result;
+            }
+
+            /**
+             * @brief Calls function for every value in order, decoding block by block.
+             * @param function Callable taking value.
+             */
+            template<typename Function>
+            void forEach(Function function) const
+            {
+                uint32_t buffer[BlockSize];
+
+                for (size_t block = 0; block < this->mHeaders.getSize(); block++)
+                {
+                    size_t count = this->decodeBlock(block, buffer);
+
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        function(buffer[i]);
+                    }
+                }
+            }
+
+        private:
+            /**
+             * @brief Returns number of bits needed to store value.
+             */
+            static unsigned bitWidth(uint32_t value)
+            {
+                return value == 0 ? 0 : 64 - dsa::utility::countLeadingZeros(value);
+            }
+
+            /**
+             * @brief Reads packed value of lane at given step.
+             * @param words Pointer to first word of block.
+             * @param lane Index of lane.
+             * @param step Index of value within lane.
+             * @param width Bits per value.
+             * @return Unpacked value.
+             */
+            static uint32_t extract(const uint32_t* words, size_t lane, size_t step, unsigned width)
+            {
+                if (width == 0)
+                    return 0;
+
+                size_t bit = step * width;
+                size_t word = bit / 32;
+                unsigned shift = bit % 32;
+                uint64_t value = words[word * Lanes + lane] >> shift;
+
+                if (shift + width > 32)
+                    value |= static_cast<uint64_t>(words[(word + 1) * Lanes + lane]) << (32 - shift);
+
+                return static_cast<uint32_t>(value & ((uint64_t(1) << width) - 1));
+            }
+
+            /**
+             * @brief Compresses values block by block, choosing encoding of every block.
+             *
+             * Encodings are chosen in a first pass, so packed words are allocated once at their final size.
+             *
+             * @param values Pointer to values.
+             * @param size Number of values.
+             */
+            void encode(const uint32_t* values, size_t size)
+            {
+                size_t blocks = (size + BlockSize - 1) / BlockSize;
+                size_t wordCount = 0;
+
+                this->mSize = size;
+                this->mHeaders = DynamicArray<BlockHeader>(blocks);
+
+                uint32_t block[BlockSize];
+
+                for (size_t b = 0; b < blocks; b++)
+                {
+                    BlockHeader& header = this->mHeaders[b];
+
+                    loadBlock(values, size, b, block);
+                    chooseEncoding(block, header);
+
+                    header.mOffset = static_cast<uint32_t>(wordCount);
+                    wordCount += Lanes * header.mBitWidth;
+                }
+
+                this->mWords = DynamicArray<uint32_t>(wordCount);
+
+                for (size_t b = 0; b < blocks; b++)
+                {
+                    const BlockHeader& header = this->mHeaders[b];
+
+                    loadBlock(values, size, b, block);
+
+                    // Values are rewritten in place to their packed differences, back to front so delta still sees originals.
+                    for (size_t i = BlockSize; i-- > 0;)
+                    {
+                        if (header.mEncoding == Encoding::FrameOfReference)
+                            block[i] -= header.mBase;
+                        else
+                            block[i] -= i < Lanes ? header.mBase : block[i - Lanes];
+                    }
+
+                    pack(block, header.mBitWidth, this->mWords.getData() + header.mOffset);
+                }
+            }
+
+            /**
+             * @brief Copies values of block into buffer.
+             * @param values Pointer to values.
+             * @param size Number of values.
+             * @param index Index of block.
+             * @param block Buffer of BlockSize values.
+             */
+            static void loadBlock(const uint32_t* values, size_t size, size_t index, uint32_t* block)
+            {
+                size_t count = std::min(BlockSize, size - index * BlockSize);
+
+                // Partial block is padded by its last value, which adds no delta and no range.
+                for (size_t i = 0; i < BlockSize; i++)
+                {
+                    block[i] = values[index * BlockSize + (i < count ? i : count - 1)];
+                }
+            }
+
+            /**
+             * @brief Picks encoding, base and bit width of block.
+             * @param block Pointer to BlockSize values.
+             * @param header Header to fill.
+             */
+            static void chooseEncoding(const uint32_t* block, BlockHeader& header)
+            {
+                uint32_t minimum = block[0];
+                uint32_t maximum = block[0];
+                bool sorted = true;
+
+                for (size_t i = 1; i < BlockSize; i++)
+                {
+                    minimum = std::min(minimum, block[i]);
+                    maximum = std::max(maximum, block[i]);
+                    sorted = sorted && block[i - 1] <= block[i];
+                }
+
+                header.mBase = minimum;
+                header.mBitWidth = static_cast<uint8_t>(bitWidth(maximum - minimum));
+                header.mEncoding = Encoding::FrameOfReference;
+
+                if (!sorted)
+                    return;
+
+                uint32_t largestDelta = 0;
+
+                for (size_t i = Lanes; i < BlockSize; i++)
+                {
+                    largestDelta = std::max(largestDelta, block[i] - block[i - Lanes]);
+                }
+
+                // First value of every lane is stored relative to the first value of block, which is its minimum.
+                largestDelta = std::max(largestDelta, block[Lanes - 1] - block[0]);
+
+                if (bitWidth(largestDelta) < header.mBitWidth)
+                {
+                    header.mBitWidth = static_cast<uint8_t>(bitWidth(largestDelta));
+                    header.mEncoding = Encoding::Delta;
+                }
+            }
+
+            /**
+             * @brief Packs block of values into interleaved lanes.
+             * @param values Pointer to BlockSize values fitting into width bits.
+             * @param width Bits per value.
+             * @param words Pointer to Lanes * width zeroed words.
+             */
+            static void pack(const uint32_t* values, unsigned width, uint32_t* words)
+            {
+                if (width == 0)
+                    return;
+
+                for (size_t i = 0; i < BlockSize; i++)
+                {
+                    size_t lane = i % Lanes;
+                    size_t bit = (i / Lanes) * width;
+                    size_t word = bit / 32;
+                    unsigned shift = bit % 32;
+
+                    words[word * Lanes + lane] |= values[i] << shift;
+
+                    if (shift + width > 32)
+                        words[(word + 1) * Lanes + lane] |= values[i] >> (32 - shift);
+                }
+            }
+
+            /**
+             * @brief Decodes block of packed words.
+             * @param words Pointer to first word of block.
+             * @param header Header of block.
+             * @param output Pointer to BlockSize values.
+             */
+            static void decodeWords(const uint32_t* words, const BlockHeader& header, uint32_t* output)
+            {
+                unsigned width = header.mBitWidth;
+                bool delta = header.mEncoding == Encoding::Delta;
+
+#if defined(DSA_PACKED_SSE2)
+                const __m128i* input = reinterpret_cast<const __m128i*>(words);
+                __m128i base = _mm_set1_epi32(static_cast<int>(header.mBase));
+                __m128i mask = _mm_set1_epi32(width == 32 ? -1 : static_cast<int>((1u << width) - 1));
+                __m128i current = width != 0 ? _mm_loadu_si128(input) : _mm_setzero_si128();
+                size_t word = 0;
+                unsigned shift = 0;
+
+                for (size_t step = 0; step < BlockSize / Lanes; step++)
+                {
+                    __m128i value = _mm_srl_epi32(current, _mm_cvtsi32_si128(static_cast<int>(shift)));
+
+                    shift += width;
+
+                    if (shift >= 32)
+                    {
+                        shift -= 32;
+                        word++;
+
+                        if (word < width)
+                            current = _mm_loadu_si128(input + word);
+
+                        if (shift > 0)
+                            value = _mm_or_si128(value, _mm_sll_epi32(current, _mm_cvtsi32_si128(static_cast<int>(width - shift))));
+                    }
+
+                    value = _mm_and_si128(value, mask);
+
+                    // Delta of value i is relative to value i - 4, so running base of lanes is updated by one add.
+                    if (delta)
+                        base = _mm_add_epi32(base, value);
+                    else
+                        value = _mm_add_epi32(base, value);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + step * Lanes), delta ? base : value);
+                }
+#else
+                for (size_t lane = 0; lane < Lanes; lane++)
+                {
+                    uint32_t running = header.mBase;
+
+                    for (size_t step = 0; step < BlockSize / Lanes; step++)
+                    {
+                        uint32_t value = extract(words, lane, step, width);
+
+                        if (delta)
+                            running += value;
+
+                        output[step * Lanes + lane] = delta ? running : header.mBase + value;
+                    }
+                }
+#endif
+            }
+    };
+}
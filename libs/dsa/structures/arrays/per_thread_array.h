@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <dsa/utility/allocation_policy.h>
+
+namespace dsa::structures::arrays
+{
+    /**
+     * @brief Fixed number of slots, each owned by one thread and padded to its own cache line.
+     *
+     * Threads updating neighbouring elements of a packed array write to the same cache line, which
+     * then bounces between cores on every write (false sharing). Here every slot is aligned to
+     * CacheLineSize and occupies whole cache lines, so threads never invalidate each other's slots.
+     * Results of all threads are combined afterwards by reduce().
+     *
+     * Element type does not have to be copyable, e.g. std::atomic counters are allowed.
+     *
+     * @tparam T Type of per-thread value.
+     */
+    template<typename T>
+    class PerThreadArray
+    {
+        private:
+            /**
+             * @brief Value padded to whole cache lines.
+             */
+            struct alignas(dsa::utility::CacheLineSize) Slot
+            {
+                T mValue{};     /// Value owned by one thread.
+            };
+
+            Slot* pSlots;       /// Pointer to cache line aligned slots.
+            size_t mSize;       /// Number of slots.
+
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using ConstReferenceType = const T&;
+
+        public:
+            /**
+             * @brief Constructs array with given number of value-initialized slots.
+             * @param size Number of slots, usually number of threads.
+             */
+            explicit PerThreadArray(size_t size) : pSlots(size != 0 ? new Slot[size] : nullptr), mSize(size) {}
+
+            PerThreadArray(const PerThreadArray&) = delete;
+            PerThreadArray& operator=(const PerThreadArray&) = delete;
+
+            /**
+             * @brief Move constructor. Transfers slots from other array, which is left empty.
+             * @param other The PerThreadArray to move from.
+             */
+            PerThreadArray(PerThreadArray<T>&& other) noexcept : pSlots(other.pSlots), mSize(other.mSize)
+            {
+                other.pSlots = nullptr;
+                other.mSize = 0;
+            }
+
+            /**
+             * @brief Destructor. Releases slots.
+             */
+            ~PerThreadArray()
+            {
+                delete[] this->pSlots;
+            }
+
+            /**
+             * @brief Gets value of slot.
+             * @param index Index of slot.
+             * @throws std::out_of_range if index is out of array bounds.
+             * @return Reference to value of slot.
+             */
+            ReferenceType get(const size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->pSlots[index].mValue;
+            }
+
+            /**
+             * @brief Gets const value of slot.
+             * @param index Index of slot.
+             * @throws std::out_of_range if index is out of array bounds.
+             * @return Const reference to value of slot.
+             */
+            ConstReferenceType get(const size_t index) const
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->pSlots[index].mValue;
+            }
+
+            /**
+             * @brief Gets value of slot using operator[].
+             * @param index Index of slot.
+             * @return Reference to value of slot.
+             */
+            ReferenceType operator[](const size_t index)
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Gets const value of slot using operator[].
+             * @param index Index of slot.
+             * @return Const reference to value of slot.
+             */
+            ConstReferenceType operator[](const size_t index) const
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Gets number of slots.
+             * @return Number of slots.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Combines values of all slots, call after threads finished writing.
+             * @tparam Result Type of accumulated value.
+             * @tparam Op Operation combining accumulator with slot value.
+             * @param init Initial value of accumulator.
+             * @param op Operation instance.
+             * @return Accumulated value.
+             */
+            template<typename Result, typename Op = std::plus<>>
+            Result reduce(Result init, Op op = Op()) const
+            {
+                for (size_t i = 0; i < this->mSize; i++)
+                {
+                    init = op(std::move(init), this->pSlots[i].mValue);
+                }
+
+                return init;
+            }
+    };
+}
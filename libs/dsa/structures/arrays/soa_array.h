@@ -0,0 +1,655 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace dsa::structures::arrays
+{
+    /**
+     * @brief Non-owning view of a single SoAArray column.
+     *
+     * Elements of the column are stored contiguously, so loops over a column touch only the bytes
+     * of that field and can be vectorized by the compiler.
+     *
+     * @tparam T Type of column elements (const qualified for read-only columns).
+     */
+    template<typename T>
+    class SoAColumn
+    {
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using PointerType = T*;
+
+        private:
+            PointerType pElements;      /// Pointer to first element of column.
+            size_t mSize;               /// Number of elements in column.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes view over column elements.
+             * @param elements Pointer to first element of column.
+             * @param size Number of elements in column.
+             */
+            SoAColumn(PointerType elements, size_t size) : pElements(elements), mSize(size) {}
+
+            /**
+             * @brief Returns a reference to the element at the specified index.
+             * @param index Index of the element to access.
+             * @return Reference to the element.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ReferenceType get(const size_t index) const
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return this->pElements[index];
+            }
+
+            /**
+             * @brief Array subscript operator. Does not check bounds so that column scans stay vectorizable.
+             * @param index Index of the element to access.
+             * @return Reference to the element.
+             */
+            ReferenceType operator[](const size_t index) const
+            {
+                return this->pElements[index];
+            }
+
+            /**
+             * @brief Returns pointer to first element of column.
+             * @return Pointer to column data.
+             */
+            PointerType getData() const
+            {
+                return this->pElements;
+            }
+
+            /**
+             * @brief Returns the number of elements in the column.
+             * @return Number of elements.
+             */
+            constexpr size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns pointer to first element of column.
+             * @return Pointer to first element.
+             */
+            PointerType begin() const
+            {
+                return this->pElements;
+            }
+
+            /**
+             * @brief Returns pointer past the last element of column.
+             * @return Pointer past the last element.
+             */
+            PointerType end() const
+            {
+                return this->pElements + this->mSize;
+            }
+    };
+
+    /**
+     * @brief Proxy to single row of SoAArray.
+     *
+     * Row does not own any data, it only refers to fields at the same index in every column.
+     *
+     * @tparam SoAArray Type of structure-of-arrays container (const qualified for read-only rows).
+     */
+    template<typename SoAArray>
+    class SoAArrayRow
+    {
+        public:
+            using TupleType = typename std::remove_const_t<SoAArray>::TupleType;
+
+            template<size_t I>
+            using FieldType = std::conditional_t<std::is_const_v<SoAArray>,
+                const std::tuple_element_t<I, TupleType>,
+                std::tuple_element_t<I, TupleType>>;
+
+        private:
+            SoAArray* pArray;       /// Pointer to array owning the row.
+            size_t mIndex;          /// Index of row in array.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes proxy to row at specific index.
+             * @param array Array owning the row.
+             * @param index Index of row.
+             */
+            SoAArrayRow(SoAArray* array, size_t index) : pArray(array), mIndex(index) {}
+
+            /**
+             * @brief Gets field of row.
+             * @tparam I Index of field.
+             * @return Reference to field value.
+             */
+            template<size_t I>
+            FieldType<I>& get() const
+            {
+                return this->pArray->template column<I>()[this->mIndex];
+            }
+
+            /**
+             * @brief Sets field of row.
+             * @tparam I Index of field.
+             * @param value Value to assign.
+             */
+            template<size_t I>
+            void set(std::tuple_element_t<I, TupleType> value) const
+            {
+                static_assert(!std::is_const_v<SoAArray>, "Cannot set field of read-only row");
+
+                this->template get<I>() = std::move(value);
+            }
+
+            /**
+             * @brief Gets index of row in array.
+             * @return Index of row.
+             */
+            size_t getIndex() const
+            {
+                return this->mIndex;
+            }
+
+            /**
+             * @brief Copies all fields of row into tuple.
+             * @return Tuple of field values.
+             */
+            TupleType toTuple() const
+            {
+                return this->toTuple(std::make_index_sequence<std::tuple_size_v<TupleType>>{});
+            }
+
+        private:
+            template<size_t... I>
+            TupleType toTuple(std::index_sequence<I...>) const
+            {
+                return TupleType(this->template get<I>()...);
+            }
+    };
+
+    /**
+     * @brief Iterator class for SoAArray. Dereferences to row proxies.
+     * @tparam SoAArray Type of structure-of-arrays container.
+     */
+    template<typename SoAArray>
+    class SoAArrayIterator
+    {
+        public:
+            using RowType = SoAArrayRow<SoAArray>;      /// Type of row proxy.
+
+        private:
+            SoAArray* pArray;                           /// Pointer to iterated array.
+            size_t mIndex;                              /// Index of current row.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes iterator to row at specific index.
+             * @param array Iterated array.
+             * @param index Index of row.
+             */
+            SoAArrayIterator(SoAArray* array, size_t index) : pArray(array), mIndex(index) {}
+
+            /**
+             * @brief Postfix increment operator. Moves to next row.
+             * @return Reference to this instance of SoAArrayIterator.
+             */
+            SoAArrayIterator& operator++()
+            {
+                this->mIndex++;
+                return *this;
+            }
+
+            /**
+             * @brief Prefix increment operator. Moves to next row.
+             * @return Instance of iterator.
+             */
+            SoAArrayIterator operator++(int)
+            {
+                SoAArrayIterator iterator = *this;
+                ++(*this);
+                return iterator;
+            }
+
+            /**
+             * @brief Gets proxy to current row.
+             * @return Row proxy.
+             */
+            RowType operator*() const
+            {
+                return RowType(this->pArray, this->mIndex);
+            }
+
+            /**
+             * @brief Equals operator.
+             * @param other Other instance of SoAArrayIterator to compare with.
+             * @return True if iterators point to same row.
+             */
+            bool operator==(const SoAArrayIterator& other) const
+            {
+                return this->pArray == other.pArray && this->mIndex == other.mIndex;
+            }
+
+            /**
+             * @brief Not equals operator.
+             * @param other Other instance of SoAArrayIterator to compare with.
+             * @return True if iterators point to different rows.
+             */
+            bool operator!=(const SoAArrayIterator& other) const
+            {
+                return !(*this == other);
+            }
+    };
+
+    /**
+     * @brief Structure-of-arrays container.
+     *
+     * Stores every field of a record in its own contiguous column, so iterating a single field
+     * only pulls that field through the cache. Rows are accessed through lightweight proxies and
+     * whole columns through SoAColumn views.
+     *
+     * @tparam Fields Types of record fields, one column per field.
+     */
+    template<typename... Fields>
+    class SoAArray
+    {
+        static_assert(sizeof...(Fields) > 0, "SoAArray requires at least one field");
+
+        public:
+            using TupleType = std::tuple<Fields...>;
+            using Row = SoAArrayRow<SoAArray<Fields...>>;
+            using ConstRow = SoAArrayRow<const SoAArray<Fields...>>;
+            using Iterator = SoAArrayIterator<SoAArray<Fields...>>;
+            using ConstIterator = SoAArrayIterator<const SoAArray<Fields...>>;
+
+            template<size_t I>
+            using FieldType = std::tuple_element_t<I, TupleType>;
+
+            static constexpr size_t FieldCount = sizeof...(Fields);
+
+        private:
+            std::tuple<Fields*...> mColumns;        /// Pointers to column arrays.
+            size_t mSize;                           /// Number of rows in the array.
+            size_t mCapacity;                       /// Number of rows columns can hold without reallocation.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty array.
+             */
+            SoAArray() : mColumns(static_cast<Fields*>(nullptr)...), mSize(0), mCapacity(0) {}
+
+            /**
+             * @brief Copy constructor. Creates a deep copy of every column.
+             * @param other The SoAArray to copy from.
+             */
+            SoAArray(const SoAArray& other) : SoAArray()
+            {
+                this->reserve(other.mSize);
+                this->copyColumns(other, std::index_sequence_for<Fields...>{});
+                this->mSize = other.mSize;
+            }
+
+            /**
+             * @brief Move constructor. Transfers ownership of columns from another SoAArray.
+             * @param other The SoAArray to move from.
+             */
+            SoAArray(SoAArray&& other) noexcept : mColumns(other.mColumns), mSize(other.mSize), mCapacity(other.mCapacity)
+            {
+                other.mColumns = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+                other.mSize = 0;
+                other.mCapacity = 0;
+            }
+
+            /**
+             * @brief Destructor. Releases all columns.
+             */
+            ~SoAArray()
+            {
+                this->releaseColumns(std::index_sequence_for<Fields...>{});
+            }
+
+            /**
+             * @brief Copy assignment operator.
+             * @param other The SoAArray to copy from.
+             * @return Reference to this SoAArray.
+             */
+            SoAArray& operator=(const SoAArray& other)
+            {
+                if (this == &other)
+                    return *this;
+
+                SoAArray copy(other);
+                *this = std::move(copy);
+
+                return *this;
+            }
+
+            /**
+             * @brief Move assignment operator.
+             * @param other The SoAArray to move from.
+             * @return Reference to this SoAArray.
+             */
+            SoAArray& operator=(SoAArray&& other) noexcept
+            {
+                if (this == &other)
+                    return *this;
+
+                this->releaseColumns(std::index_sequence_for<Fields...>{});
+
+                this->mColumns = other.mColumns;
+                this->mSize = other.mSize;
+                this->mCapacity = other.mCapacity;
+
+                other.mColumns = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+                other.mSize = 0;
+                other.mCapacity = 0;
+
+                return *this;
+            }
+
+            /**
+             * @brief Returns proxy to the row at the specified index.
+             * @param index Index of the row to access.
+             * @return Row proxy.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            Row get(const size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return Row(this, index);
+            }
+
+            /**
+             * @brief Returns read-only proxy to the row at the specified index.
+             * @param index Index of the row to access.
+             * @return Const row proxy.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            ConstRow get(const size_t index) const
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                return ConstRow(this, index);
+            }
+
+            /**
+             * @brief Array subscript operator.
+             * @param index Index of the row to access.
+             * @return Row proxy.
+             */
+            Row operator[](const size_t index)
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Array subscript operator (const version).
+             * @param index Index of the row to access.
+             * @return Const row proxy.
+             */
+            ConstRow operator[](const size_t index) const
+            {
+                return this->get(index);
+            }
+
+            /**
+             * @brief Returns view of a whole column.
+             * @tparam I Index of field.
+             * @return Column view.
+             */
+            template<size_t I>
+            SoAColumn<FieldType<I>> column()
+            {
+                return SoAColumn<FieldType<I>>(std::get<I>(this->mColumns), this->mSize);
+            }
+
+            /**
+             * @brief Returns read-only view of a whole column.
+             * @tparam I Index of field.
+             * @return Const column view.
+             */
+            template<size_t I>
+            SoAColumn<const FieldType<I>> column() const
+            {
+                return SoAColumn<const FieldType<I>>(std::get<I>(this->mColumns), this->mSize);
+            }
+
+            /**
+             * @brief Returns the number of rows in the array.
+             * @return Number of rows.
+             */
+            constexpr size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns the number of rows the array can hold without reallocating.
+             * @return Capacity of the array.
+             */
+            constexpr size_t getCapacity() const
+            {
+                return this->mCapacity;
+            }
+
+            /**
+             * @brief Ensures every column can hold at least the given number of rows.
+             * @param capacity Requested capacity.
+             */
+            void reserve(size_t capacity)
+            {
+                if (capacity <= this->mCapacity)
+                    return;
+
+                this->reallocateColumns(capacity, std::index_sequence_for<Fields...>{});
+                this->mCapacity = capacity;
+            }
+
+            /**
+             * @brief Sets every field of the row at the specified index.
+             * @param index Index of the row to set.
+             * @param values Field values to assign.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void set(size_t index, Fields... values)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                this->storeRow(index, std::index_sequence_for<Fields...>{}, std::move(values)...);
+            }
+
+            /**
+             * @brief Adds a row to the end of the array.
+             *
+             * Columns grow geometrically, so repeated calls are amortized constant time.
+             *
+             * @param values Field values of the new row.
+             */
+            void addLast(Fields... values)
+            {
+                if (this->mSize == this->mCapacity)
+                    this->reserve(this->mCapacity == 0 ? 1 : this->mCapacity * 2);
+
+                this->storeRow(this->mSize, std::index_sequence_for<Fields...>{}, std::move(values)...);
+                this->mSize++;
+            }
+
+            /**
+             * @brief Removes the last row from the array.
+             * @throws std::runtime_error if the array is empty.
+             */
+            void removeLast()
+            {
+                if (this->mSize == 0)
+                    throw std::runtime_error("Cannot remove item when no item is present in array");
+
+                this->mSize--;
+                this->releaseRows(this->mSize, this->mSize + 1);
+            }
+
+            /**
+             * @brief Removes the row at the specified index, shifting following rows in every column.
+             * @param index Index of the row to remove.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            void removeAt(size_t index)
+            {
+                if (index >= this->mSize)
+                    throw std::out_of_range("Index out of array bounds");
+
+                this->shiftColumns(index, std::index_sequence_for<Fields...>{});
+                this->mSize--;
+                this->releaseRows(this->mSize, this->mSize + 1);
+            }
+
+            /**
+             * @brief Removes all rows while keeping the allocated columns.
+             */
+            void clear()
+            {
+                this->releaseRows(0, this->mSize);
+                this->mSize = 0;
+            }
+
+            /**
+             * @brief Returns a new instance of SoAArrayIterator which points to first row.
+             * @return Instance of SoAArrayIterator.
+             */
+            Iterator begin()
+            {
+                return Iterator(this, 0);
+            }
+
+            /**
+             * @brief Returns a new instance of SoAArrayIterator which points past the last row.
+             * @return Instance of SoAArrayIterator.
+             */
+            Iterator end()
+            {
+                return Iterator(this, this->mSize);
+            }
+
+            /**
+             * @brief Returns a new instance of read-only SoAArrayIterator which points to first row.
+             * @return Instance of SoAArrayIterator over const rows.
+             */
+            ConstIterator begin() const
+            {
+                return ConstIterator(this, 0);
+            }
+
+            /**
+             * @brief Returns a new instance of read-only SoAArrayIterator which points past the last row.
+             * @return Instance of SoAArrayIterator over const rows.
+             */
+            ConstIterator end() const
+            {
+                return ConstIterator(this, this->mSize);
+            }
+
+        private:
+            template<size_t... I>
+            void storeRow(size_t index, std::index_sequence<I...>, Fields&&... values)
+            {
+                ((std::get<I>(this->mColumns)[index] = std::move(values)), ...);
+            }
+
+            template<size_t... I>
+            void shiftColumns(size_t index, std::index_sequence<I...>)
+            {
+                (this->shiftColumn(std::get<I>(this->mColumns), index), ...);
+            }
+
+            template<typename T>
+            void shiftColumn(T* column, size_t index)
+            {
+                for (size_t i = index + 1; i < this->mSize; i++)
+                {
+                    column[i - 1] = std::move(column[i]);
+                }
+            }
+
+            /**
+             * @brief Resets fields of rows vacated by removal so they do not keep resources alive.
+             * @param from Index of first vacated row.
+             * @param to Index past the last vacated row.
+             */
+            void releaseRows(size_t from, size_t to)
+            {
+                this->releaseRows(from, to, std::index_sequence_for<Fields...>{});
+            }
+
+            template<size_t... I>
+            void releaseRows(size_t from, size_t to, std::index_sequence<I...>)
+            {
+                (this->releaseColumnRows(std::get<I>(this->mColumns), from, to), ...);
+            }
+
+            template<typename T>
+            void releaseColumnRows(T* column, size_t from, size_t to)
+            {
+                if constexpr (!std::is_trivially_copyable_v<T>)
+                {
+                    for (size_t i = from; i < to; i++)
+                    {
+                        column[i] = T();
+                    }
+                }
+            }
+
+            template<size_t... I>
+            void reallocateColumns(size_t capacity, std::index_sequence<I...>)
+            {
+                (this->reallocateColumn(std::get<I>(this->mColumns), capacity), ...);
+            }
+
+            template<typename T>
+            void reallocateColumn(T*& column, size_t capacity)
+            {
+                T* temp = new T[capacity];
+
+                for (size_t i = 0; i < this->mSize; i++)
+                {
+                    temp[i] = std::move(column[i]);
+                }
+
+                delete[] column;
+
+                column = temp;
+            }
+
+            template<size_t... I>
+            void copyColumns(const SoAArray& other, std::index_sequence<I...>)
+            {
+                (this->copyColumn(std::get<I>(this->mColumns), std::get<I>(other.mColumns), other.mSize), ...);
+            }
+
+            template<typename T>
+            void copyColumn(T* column, const T* source, size_t size)
+            {
+                for (size_t i = 0; i < size; i++)
+                {
+                    column[i] = source[i];
+                }
+            }
+
+            template<size_t... I>
+            void releaseColumns(std::index_sequence<I...>)
+            {
+                ((delete[] std::get<I>(this->mColumns)), ...);
+            }
+    };
+}
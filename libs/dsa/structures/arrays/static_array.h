@@ -1,7 +1,13 @@
+#pragma once
+
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
+#include <utility>
+#include <dsa/utility/instrumentation.h>
+#include <dsa/utility/memory.h>
 
 namespace dsa::structures::arrays
 {
@@ -25,13 +31,13 @@ namespace dsa::structures::arrays
              * @brief Default constructor. Initializes pointer to element.
              * @param ptr Pointer to element.
              */
-            StaticArrayIterator(PointerType ptr) : mPtr(ptr) {}
+            constexpr StaticArrayIterator(PointerType ptr) : mPtr(ptr) {}
 
             /**
              * @brief Postfix increment operator. Increments pointer to element.
              * @return Reference to this instance of StaticArrayIterator.
              */
-            StaticArrayIterator& operator++()
+            constexpr StaticArrayIterator& operator++()
             {
                 this->mPtr++;
                 return *this;
@@ -41,7 +47,7 @@ namespace dsa::structures::arrays
              * @brief Prefix increment operator. Increments pointer to element.
              * @return Instance of iterator.
              */
-            StaticArrayIterator operator++(int)
+            constexpr StaticArrayIterator operator++(int)
             {
                 StaticArrayIterator iterator = *this;
                 ++(*this);
@@ -52,7 +58,7 @@ namespace dsa::structures::arrays
              * @brief Postfix decrement operator. Decrements pointer to element.
              * @return Reference to this instance of StaticArrayIterator.
              */
-            StaticArrayIterator& operator--()
+            constexpr StaticArrayIterator& operator--()
             {
                 this->mPtr--;
                 return *this;
@@ -62,7 +68,7 @@ namespace dsa::structures::arrays
              * @brief Prefix decrement operator. Decrements pointer to element.
              * @return Instance of iterator.
              */
-            StaticArrayIterator operator--(int)
+            constexpr StaticArrayIterator operator--(int)
             {
                 StaticArrayIterator iterator = *this;
                 --(*this);
@@ -74,7 +80,7 @@ namespace dsa::structures::arrays
              * @param index Index to get.
              * @return Reference to StaticArray at specific index.
              */
-            ReferenceType operator[](int index)
+            constexpr ReferenceType operator[](int index)
             {
                 return this->mPtr[index];
             }
@@ -83,7 +89,7 @@ namespace dsa::structures::arrays
              * @brief Gets pointer to internal pointer.
              * @return Pointer to StaticArray.
              */
-            PointerType operator->()
+            constexpr PointerType operator->()
             {
                 return this->mPtr;
             }
@@ -92,7 +98,7 @@ namespace dsa::structures::arrays
              * @brief Gets reference to dereferenced internal pointer.
              * @return Reference to StaticArray.
              */
-            ReferenceType operator*()
+            constexpr ReferenceType operator*()
             {
                 return *this->mPtr;
             }
@@ -102,7 +108,7 @@ namespace dsa::structures::arrays
              * @param other Other instance of StaticArrayIterator to compare with.
              * @return True if internal pointers equals.
              */
-            bool operator==(const StaticArrayIterator& other) const
+            constexpr bool operator==(const StaticArrayIterator& other) const
             {
                 return this->mPtr == other.mPtr;
             }
@@ -112,7 +118,7 @@ namespace dsa::structures::arrays
              * @param other Other instance of StaticArrayIterator to compare with.
              * @return True if internal pointers do not equals.
              */
-            bool operator!=(const StaticArrayIterator& other) const
+            constexpr bool operator!=(const StaticArrayIterator& other) const
             {
                 return this->mPtr != other.mPtr;
             }
@@ -123,83 +129,69 @@ namespace dsa::structures::arrays
       *
       * Provides basic static array functionality such as setting at index, getting element at index,
       * initializer_list constructor and assignment operator.
-      * Elements are stored in heap allocated array
+      * Elements are stored inline inside the array object and every operation except stream output
+      * is constexpr, so arrays of literal types can be built and queried at compile time.
       *
       * @tparam T Type of Elements
       * @tparam size Size of array
+      * @tparam Alignment Alignment of first element in bytes, e.g. 32 for aligned AVX loads
       */
-    template<typename T, size_t size>
+    template<typename T, size_t size, size_t Alignment = alignof(T)>
     class StaticArray
     {
+        static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be power of two not smaller than alignment of element type");
+
         private:
-            T* pElements;       /// Pointer to elements array.
+            alignas(Alignment) T mElements[size == 0 ? 1 : size];      /// Elements array, zero sized array keeps one unused slot.
 
         public:
             using ValueType = T;
             using ReferenceType = T&;
             using ConstReferenceType = const T&;
             using PointerType = T*;
-            using Iterator = StaticArrayIterator<StaticArray<ValueType, size>>;
+            using Iterator = StaticArrayIterator<StaticArray<ValueType, size, Alignment>>;
 
         public:
             /**
-             * @brief Default constructor. Initializes an empty array.
+             * @brief Default constructor. Value initializes all elements.
              */
-            StaticArray() : pElements(new ValueType[size]()) {}
+            constexpr StaticArray() : mElements{} {}
 
             /**
              * @brief Constructs the array from an initializer list.
              * @param list Initializer list of array elements.
              * @throws std::runtime_error if list size does not match array size
              */
-            StaticArray(const std::initializer_list<ValueType> list)
+            constexpr StaticArray(const std::initializer_list<ValueType> list) : mElements{}
             {
                 if (size != list.size())
                     throw std::runtime_error("Entered array size does not match template parameter size");
 
-                this->pElements = new ValueType[size];
-
-                size_t i = 0;
-
-                for (ValueType it : list)
-                {
-                    if (i >= size)
-                        return;
+                DSA_INSTRUMENT_COPIES(StaticArray, size);
 
-                    this->pElements[i++] = it;
-                }
+                dsa::utility::copyElements(list.begin(), size, this->mElements);
             }
 
             /**
              * @brief Copy constructor. Creates deep copy of another StaticArray.
              * @param other StaticArray to copy from.
              */
-            StaticArray(const StaticArray<ValueType, size>& other) : pElements(new ValueType[size])
+            constexpr StaticArray(const StaticArray<ValueType, size, Alignment>& other) : mElements{}
             {
-                for (size_t i = 0; i < size; i++) {
-                    this->pElements[i] = other.pElements[i];
-                }
+                DSA_INSTRUMENT_COPIES(StaticArray, size);
+
+                dsa::utility::copyElements(other.mElements, size, this->mElements);
             }
 
             /**
-             * @brief Move constructor. Transfers ownership of resources form another StaticArray.
-             *
-             * Moves the pElements array from one instance to another.
-             *
+             * @brief Move constructor. Moves elements of another StaticArray one by one.
              * @param other StaticArray to move from.
              */
-            StaticArray(StaticArray<ValueType, size>&& other) noexcept : pElements(other.pElements)
+            constexpr StaticArray(StaticArray<ValueType, size, Alignment>&& other) noexcept(std::is_nothrow_move_assignable_v<T>) : mElements{}
             {
-                other.pElements = nullptr;
-            }
+                DSA_INSTRUMENT_MOVES(StaticArray, size);
 
-            /**
-             * @brief Destructor. Releases allocated memory.
-             */
-            ~StaticArray()
-            {
-                delete[] this->pElements;
-                this->pElements = NULL;
+                dsa::utility::moveElements(other.mElements, size, this->mElements);
             }
 
             /**
@@ -208,12 +200,12 @@ namespace dsa::structures::arrays
              * @throws std::out_of_range if index is out of array bounds.
              * @return Reference to element of template type T.
              */
-            ReferenceType get(const size_t index)
+            constexpr ReferenceType get(const size_t index)
             {
                 if (index >= size)
                     throw std::out_of_range("Index out of array bounds");
 
-                return this->pElements[index];
+                return this->mElements[index];
             }
 
             /**
@@ -222,29 +214,47 @@ namespace dsa::structures::arrays
              * @throws std::out_of_range if index is out of array bounds.
              * @return Const reference to element of template type T.
              */
-            ConstReferenceType get(const size_t index) const
+            constexpr ConstReferenceType get(const size_t index) const
             {
                 if (index >= size)
                     throw std::out_of_range("Index out of array bounds");
 
-                return this->pElements[index];
+                return this->mElements[index];
             }
 
             /**
              * @brief Gets size of array.
              * @return Number of elements.
              */
-            constexpr int getSize()
+            static constexpr size_t getSize()
             {
                 return size;
             }
 
+            /**
+             * @brief Gets pointer to the underlying contiguous storage.
+             * @return Pointer to first element.
+             */
+            constexpr PointerType getData()
+            {
+                return this->mElements;
+            }
+
+            /**
+             * @brief Gets const pointer to the underlying contiguous storage.
+             * @return Const pointer to first element.
+             */
+            constexpr const ValueType* getData() const
+            {
+                return this->mElements;
+            }
+
             /**
              * @brief Gets element at specific index using operator[].
              * @param index Index of element.
              * @return Reference to element of template type T.
              */
-            ReferenceType operator[](const size_t index)
+            constexpr ReferenceType operator[](const size_t index)
             {
                 return this->get(index);
             }
@@ -254,7 +264,7 @@ namespace dsa::structures::arrays
              * @param index Index of element.
              * @return Const reference to element of template type T.
              */
-            ConstReferenceType operator[](const size_t index) const
+            constexpr ConstReferenceType operator[](const size_t index) const
             {
                 return this->get(index);
             }
@@ -263,7 +273,7 @@ namespace dsa::structures::arrays
              * @brief Gets first element.
              * @return Reference to first element of template type T.
              */
-            ReferenceType first()
+            constexpr ReferenceType first()
             {
                 return this->get(0);
             }
@@ -272,7 +282,7 @@ namespace dsa::structures::arrays
              * @brief Gets last element.
              * @return Reference to last element of template type T.
              */
-            ReferenceType last()
+            constexpr ReferenceType last()
             {
                 return this->get(size - 1);
             }
@@ -284,12 +294,12 @@ namespace dsa::structures::arrays
              * @param value Value to set at specific index.
              * @throws std::out_of_range if index is out of array bounds.
              */
-            void set(const size_t index, ValueType value)
+            constexpr void set(const size_t index, ValueType value)
             {
                 if (index >= size)
                     throw std::out_of_range("Index out of array bounds");
 
-                this->pElements[index] = value;
+                this->mElements[index] = std::move(value);
             }
 
             /**
@@ -298,20 +308,14 @@ namespace dsa::structures::arrays
              * @throws std::runtime_error if list size does not match array size from template parameter.
              * @return Reference to this StaticArray.
              */
-            StaticArray<ValueType, size>& operator=(const std::initializer_list<ValueType>& list)
+            constexpr StaticArray<ValueType, size, Alignment>& operator=(const std::initializer_list<ValueType>& list)
             {
                 if (size != list.size())
                     throw std::runtime_error("Entered array size does not match template parameter size");
 
-                size_t i = 0;
-
-                for (ValueType value : list)
-                {
-                    if (i >= size)
-                        break;
+                DSA_INSTRUMENT_COPIES(StaticArray, size);
 
-                    this->pElements[i++] = value;
-                }
+                dsa::utility::copyElements(list.begin(), size, this->mElements);
 
                 return *this;
             }
@@ -321,37 +325,31 @@ namespace dsa::structures::arrays
              * @param other StaticArray to copy from.
              * @return Reference to this StaticArray.
              */
-            StaticArray<ValueType, size>& operator=(const StaticArray<ValueType, size>& other)
+            constexpr StaticArray<ValueType, size, Alignment>& operator=(const StaticArray<ValueType, size, Alignment>& other)
             {
                 if (this == &other)
                     return *this;
 
-                delete[] this->pElements;
+                DSA_INSTRUMENT_COPIES(StaticArray, size);
 
-                this->pElements = new ValueType[size]();
-
-                for (size_t i = 0; i < size; i++)
-                {
-                    this->pElements[i] = other.pElements[i];
-                }
+                dsa::utility::copyElements(other.mElements, size, this->mElements);
 
                 return *this;
             }
 
             /**
              * @brief Move assignment operator.
-             * @param other StaticArray to copy from.
+             * @param other StaticArray to move from.
              * @return Reference to this StaticArray.
              */
-            StaticArray<ValueType, size>& operator=(StaticArray<ValueType, size>&& other) noexcept
+            constexpr StaticArray<ValueType, size, Alignment>& operator=(StaticArray<ValueType, size, Alignment>&& other) noexcept(std::is_nothrow_move_assignable_v<T>)
             {
                 if (this == &other)
                     return *this;
 
-                delete[] this->pElements;
+                DSA_INSTRUMENT_MOVES(StaticArray, size);
 
-                this->pElements = other.pElements;
-                other.pElements = nullptr;
+                dsa::utility::moveElements(other.mElements, size, this->mElements);
 
                 return *this;
             }
@@ -362,11 +360,11 @@ namespace dsa::structures::arrays
              * @param array Array to output.
              * @return Reference to output stream.
              */
-            friend std::ostream& operator<<(std::ostream& os, const StaticArray<ValueType, size>& array)
+            friend std::ostream& operator<<(std::ostream& os, const StaticArray<ValueType, size, Alignment>& array)
             {
                 for (size_t i = 0; i < size; i++)
                 {
-                    os << "Index: " << i << " | " << "Value: " << array.pElements[i] << "\n";
+                    os << "Index: " << i << " | " << "Value: " << array.mElements[i] << "\n";
                 }
 
                 return os;
@@ -376,18 +374,18 @@ namespace dsa::structures::arrays
              * @brief Returns a new instance of StaticArrayIterator which points to first element.
              * @return Instance of StaticArrayIterator.
              */
-            Iterator begin()
+            constexpr Iterator begin()
             {
-                return Iterator(this->pElements);
+                return Iterator(this->mElements);
             }
 
             /**
              * @brief Returns a new instace of StaticArrayIterator which points to last element.
              * @return Instance of StaticArrayIterator.
              */
-            Iterator end()
+            constexpr Iterator end()
             {
-                return Iterator(this->pElements + size);
+                return Iterator(this->mElements + size);
             }
     };
 }
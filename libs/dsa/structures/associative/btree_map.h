@@ -0,0 +1,1015 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <dsa/algorithms/searching/binary_search.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/allocation_policy.h>
+#include <dsa/utility/instrumentation.h>
+
+namespace dsa::structures::associative
+{
+    /**
+     * @brief Ordered map implemented as B+ tree with nodes sized to whole cache lines.
+     *
+     * All entries live in leaves; inner nodes only hold separator keys that route searches. Keys of
+     * every node are stored in one cache line aligned array of NodeBytes bytes, apart from values
+     * and child pointers, so search inside a node touches only a few consecutive lines and runs as
+     * branchless binary search. Leaves are linked in both directions, so iteration and range scans
+     * walk leaves sequentially instead of climbing the tree.
+     *
+     * Nodes are kept at least half full: inserting into a full node splits it, erasing from a node
+     * at minimal size borrows an entry from a sibling or merges with it.
+     *
+     * @tparam K Type of keys, must be default constructible.
+     * @tparam V Type of values, must be default constructible.
+     * @tparam Compare Comparator defining key order.
+     * @tparam NodeBytes Size of key array of node in bytes, multiple of cache line size.
+     */
+    template<typename K, typename V, typename Compare = std::less<K>, size_t NodeBytes = 4 * dsa::utility::CacheLineSize>
+    class BTreeMap
+    {
+        static_assert(NodeBytes % dsa::utility::CacheLineSize == 0, "Node size must be multiple of cache line size");
+
+        public:
+            static constexpr size_t NodeCapacity = std::max<size_t>(4, NodeBytes / sizeof(K));  /// Maximal number of keys per node.
+            static constexpr size_t MinimumKeys = NodeCapacity / 2;                             /// Minimal number of keys of non-root node.
+
+        private:
+            /**
+             * @brief Common header of nodes.
+             */
+            struct Node
+            {
+                bool mIsLeaf;           /// True for leaf nodes.
+                uint16_t mCount = 0;    /// Number of keys.
+
+                explicit Node(bool isLeaf) : mIsLeaf(isLeaf) {}
+            };
+
+            /**
+             * @brief Leaf holding entries, linked with neighbouring leaves.
+             */
+            struct LeafNode : Node
+            {
+                alignas(dsa::utility::CacheLineSize) K mKeys[NodeCapacity];    /// Sorted keys.
+                V mValues[NodeCapacity];                                        /// Values in order of keys.
+                LeafNode* pPrevious = nullptr;                                  /// Leaf with smaller keys.
+                LeafNode* pNext = nullptr;                                      /// Leaf with larger keys.
+
+                LeafNode() : Node(true), mKeys(), mValues() {}
+            };
+
+            /**
+             * @brief Inner node routing searches, child i holds keys between separators i - 1 and i.
+             */
+            struct InnerNode : Node
+            {
+                alignas(dsa::utility::CacheLineSize) K mKeys[NodeCapacity];    /// Sorted separator keys.
+                Node* pChildren[NodeCapacity + 1] = {};                         /// Children, one more than keys.
+
+                InnerNode() : Node(false), mKeys() {}
+            };
+
+            /**
+             * @brief Iterator over entries in key order, walks linked leaves.
+             * @tparam IsConst Whether values are read-only.
+             */
+            template<bool IsConst>
+            class IteratorBase
+            {
+                friend class BTreeMap;
+
+                private:
+                    LeafNode* pLeaf;        /// Leaf of current entry, nullptr at the end.
+                    size_t mIndex;          /// Index of current entry in leaf.
+
+                public:
+                    using ValueReference = std::conditional_t<IsConst, const V&, V&>;
+
+                public:
+                    /**
+                     * @brief Constructs iterator to entry of leaf.
+                     * @param leaf Leaf of entry, nullptr for end iterator.
+                     * @param index Index of entry in leaf.
+                     */
+                    IteratorBase(LeafNode* leaf, size_t index) : pLeaf(leaf), mIndex(index) {}
+
+                    /**
+                     * @brief Prefix increment operator. Moves to entry with next key.
+                     * @return Reference to this iterator.
+                     */
+                    IteratorBase& operator++()
+                    {
+                        this->mIndex++;
+
+                        if (this->mIndex == this->pLeaf->mCount)
+                        {
+                            this->pLeaf = this->pLeaf->pNext;
+                            this->mIndex = 0;
+                        }
+
+                        return *this;
+                    }
+
+                    /**
+                     * @brief Postfix increment operator. Moves to entry with next key.
+                     * @return Iterator before increment.
+                     */
+                    IteratorBase operator++(int)
+                    {
+                        IteratorBase iterator = *this;
+                        ++(*this);
+                        return iterator;
+                    }
+
+                    /**
+                     * @brief Gets current entry.
+                     * @return Pair of key and value references.
+                     */
+                    std::pair<const K&, ValueReference> operator*() const
+                    {
+                        return { this->pLeaf->mKeys[this->mIndex], this->pLeaf->mValues[this->mIndex] };
+                    }
+
+                    /**
+                     * @brief Equals operator.
+                     * @param other Iterator to compare with.
+                     * @return True if iterators point to the same entry.
+                     */
+                    bool operator==(const IteratorBase& other) const
+                    {
+                        return this->pLeaf == other.pLeaf && this->mIndex == other.mIndex;
+                    }
+
+                    /**
+                     * @brief Not equals operator.
+                     * @param other Iterator to compare with.
+                     * @return True if iterators point to different entries.
+                     */
+                    bool operator!=(const IteratorBase& other) const
+                    {
+                        return !(*this == other);
+                    }
+            };
+
+        public:
+            using KeyType = K;
+            using ValueType = V;
+            using EntryType = std::pair<K, V>;
+            using ReferenceType = V&;
+            using ConstReferenceType = const V&;
+            using Iterator = IteratorBase<false>;
+            using ConstIterator = IteratorBase<true>;
+
+        private:
+            Node* pRoot;            /// Root node, nullptr if empty.
+            LeafNode* pFirst;       /// Leaf with the smallest keys.
+            size_t mSize;           /// Number of entries.
+            Compare mCompare;       /// Comparator instance.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty map.
+             * @param compare Comparator instance.
+             */
+            explicit BTreeMap(const Compare& compare = Compare()) : pRoot(nullptr), pFirst(nullptr), mSize(0), mCompare(compare) {}
+
+            BTreeMap(const BTreeMap&) = delete;
+            BTreeMap& operator=(const BTreeMap&) = delete;
+
+            /**
+             * @brief Move constructor. Transfers nodes of other map, which is left empty.
+             * @param other The BTreeMap to move from.
+             */
+            BTreeMap(BTreeMap&& other) noexcept : pRoot(other.pRoot), pFirst(other.pFirst), mSize(other.mSize), mCompare(std::move(other.mCompare))
+            {
+                other.pRoot = nullptr;
+                other.pFirst = nullptr;
+                other.mSize = 0;
+            }
+
+            /**
+             * @brief Move assignment operator.
+             * @param other The BTreeMap to move from.
+             * @return Reference to this BTreeMap.
+             */
+            BTreeMap& operator=(BTreeMap&& other) noexcept
+            {
+                if (this == &other)
+                    return *this;
+
+                this->clear();
+
+                std::swap(this->pRoot, other.pRoot);
+                std::swap(this->pFirst, other.pFirst);
+                std::swap(this->mSize, other.mSize);
+                std::swap(this->mCompare, other.mCompare);
+
+                return *this;
+            }
+
+            /**
+             * @brief Destructor. Releases all nodes.
+             */
+            ~BTreeMap()
+            {
+                this->clear();
+            }
+
+            /**
+             * @brief Replaces content of the map by sorted entries, building full leaves bottom-up in O(n).
+             * @param entries Array of entries sorted by strictly increasing keys.
+             * @throws std::runtime_error if keys are not strictly increasing.
+             */
+            void bulkLoad(dsa::structures::arrays::DynamicArray<EntryType> entries)
+            {
+                EntryType* data = entries.getData();
+                size_t size = entries.getSize();
+
+                for (size_t i = 1; i < size; i++)
+                {
+                    if (!this->mCompare(data[i - 1].first, data[i].first))
+                        throw std::runtime_error("Entries of bulk load must have strictly increasing keys");
+                }
+
+                this->clear();
+
+                if (size == 0)
+                    return;
+
+                // Entries are spread evenly, so every node of a level gets at least half of capacity.
+                size_t leafCount = (size + NodeCapacity - 1) / NodeCapacity;
+                dsa::structures::arrays::DynamicArray<Node*> level(leafCount);
+                dsa::structures::arrays::DynamicArray<K> lowestKeys(leafCount);
+                LeafNode* previous = nullptr;
+                size_t entry = 0;
+
+                for (size_t l = 0; l < leafCount; l++)
+                {
+                    LeafNode* leaf = this->createLeaf();
+                    size_t count = size / leafCount + (l < size % leafCount ? 1 : 0);
+
+                    for (size_t i = 0; i < count; i++, entry++)
+                    {
+                        leaf->mKeys[i] = std::move(data[entry].first);
+                        leaf->mValues[i] = std::move(data[entry].second);
+                    }
+
+                    leaf->mCount = static_cast<uint16_t>(count);
+                    leaf->pPrevious = previous;
+
+                    if (previous != nullptr)
+                        previous->pNext = leaf;
+                    else
+                        this->pFirst = leaf;
+
+                    level[l] = leaf;
+                    lowestKeys[l] = leaf->mKeys[0];
+                    previous = leaf;
+                }
+
+                while (level.getSize() > 1)
+                {
+                    size_t childCount = level.getSize();
+                    size_t nodeCount = (childCount + NodeCapacity) / (NodeCapacity + 1);
+                    dsa::structures::arrays::DynamicArray<Node*> parents(nodeCount);
+                    dsa::structures::arrays::DynamicArray<K> parentKeys(nodeCount);
+                    size_t child = 0;
+
+                    for (size_t n = 0; n < nodeCount; n++)
+                    {
+                        InnerNode* inner = this->createInner();
+                        size_t count = childCount / nodeCount + (n < childCount % nodeCount ? 1 : 0);
+
+                        parentKeys[n] = lowestKeys[child];
+
+                        for (size_t i = 0; i < count; i++, child++)
+                        {
+                            inner->pChildren[i] = level[child];
+
+                            if (i != 0)
+                                inner->mKeys[i - 1] = lowestKeys[child];
+                        }
+
+                        inner->mCount = static_cast<uint16_t>(count - 1);
+                        parents[n] = inner;
+                    }
+
+                    level = std::move(parents);
+                    lowestKeys = std::move(parentKeys);
+                }
+
+                this->pRoot = level[0];
+                this->mSize = size;
+            }
+
+            /**
+             * @brief Inserts entry or replaces value of existing key.
+             * @param key Key of entry.
+             * @param value Value of entry.
+             * @return True if key was not present before.
+             */
+            bool insert(const K& key, V value)
+            {
+                if (this->pRoot == nullptr)
+                {
+                    LeafNode* leaf = this->createLeaf();
+
+                    this->pRoot = leaf;
+                    this->pFirst = leaf;
+                }
+
+                bool inserted = false;
+                K separator{};
+                Node* right = this->insertInto(this->pRoot, key, value, inserted, separator);
+
+                if (right != nullptr)
+                {
+                    InnerNode* root = this->createInner();
+
+                    root->mKeys[0] = std::move(separator);
+                    root->pChildren[0] = this->pRoot;
+                    root->pChildren[1] = right;
+                    root->mCount = 1;
+
+                    this->pRoot = root;
+                }
+
+                if (inserted)
+                    this->mSize++;
+
+                return inserted;
+            }
+
+            /**
+             * @brief Removes entry of key.
+             * @param key Key to remove.
+             * @return True if key was present.
+             */
+            bool erase(const K& key)
+            {
+                if (this->pRoot == nullptr || !this->eraseFrom(this->pRoot, key))
+                    return false;
+
+                this->mSize--;
+
+                if (this->pRoot->mIsLeaf && this->pRoot->mCount == 0)
+                {
+                    this->destroyNode(this->pRoot);
+                    this->pRoot = nullptr;
+                    this->pFirst = nullptr;
+                }
+                else if (!this->pRoot->mIsLeaf && this->pRoot->mCount == 0)
+                {
+                    Node* child = static_cast<InnerNode*>(this->pRoot)->pChildren[0];
+
+                    this->destroyNode(this->pRoot);
+                    this->pRoot = child;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @return Pointer to value, nullptr if key is not present.
+             */
+            V* find(const K& key)
+            {
+                Iterator iterator = this->lowerBound(key);
+
+                if (iterator == this->end() || this->mCompare(key, iterator.pLeaf->mKeys[iterator.mIndex]))
+                    return nullptr;
+
+                return &iterator.pLeaf->mValues[iterator.mIndex];
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @return Const pointer to value, nullptr if key is not present.
+             */
+            const V* find(const K& key) const
+            {
+                return const_cast<BTreeMap*>(this)->find(key);
+            }
+
+            /**
+             * @brief Returns a reference to value of key.
+             * @param key Key to search for.
+             * @return Reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ReferenceType get(const K& key)
+            {
+                V* value = this->find(key);
+
+                if (value == nullptr)
+                    throw std::out_of_range("Key is not present in map");
+
+                return *value;
+            }
+
+            /**
+             * @brief Returns a const reference to value of key.
+             * @param key Key to search for.
+             * @return Const reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ConstReferenceType get(const K& key) const
+            {
+                const V* value = this->find(key);
+
+                if (value == nullptr)
+                    throw std::out_of_range("Key is not present in map");
+
+                return *value;
+            }
+
+            /**
+             * @brief Subscript operator.
+             * @param key Key to search for.
+             * @return Reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ReferenceType operator[](const K& key)
+            {
+                return this->get(key);
+            }
+
+            /**
+             * @brief Subscript operator (const version).
+             * @param key Key to search for.
+             * @return Const reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ConstReferenceType operator[](const K& key) const
+            {
+                return this->get(key);
+            }
+
+            /**
+             * @brief Checks whether key is in the map.
+             * @param key Key to search for.
+             * @return True if key is present.
+             */
+            bool contains(const K& key) const
+            {
+                return this->find(key) != nullptr;
+            }
+
+            /**
+             * @brief Returns iterator to the first entry whose key does not compare before key.
+             * @param key Key to search for.
+             * @return Iterator to entry, end() if every key compares before key.
+             */
+            Iterator lowerBound(const K& key)
+            {
+                if (this->pRoot == nullptr)
+                    return this->end();
+
+                Node* node = this->pRoot;
+
+                while (!node->mIsLeaf)
+                {
+                    InnerNode* inner = static_cast<InnerNode*>(node);
+
+                    node = inner->pChildren[this->childIndex(inner, key)];
+                }
+
+                LeafNode* leaf = static_cast<LeafNode*>(node);
+                size_t index = dsa::algorithms::searching::branchlessLowerBound(leaf->mKeys, leaf->mCount, key, this->mCompare);
+
+                // Every key of leaf may precede key, lower bound is then the first entry of the next leaf.
+                if (index == leaf->mCount)
+                    return Iterator(leaf->pNext, 0);
+
+                return Iterator(leaf, index);
+            }
+
+            /**
+             * @brief Calls function for every entry with key in range [from, to), walking linked leaves.
+             * @param from Smallest key of range.
+             * @param to Key past the range.
+             * @param function Callable taking const key reference and value reference.
+             */
+            template<typename Function>
+            void forEachInRange(const K& from, const K& to, Function function)
+            {
+                Iterator iterator = this->lowerBound(from);
+                LeafNode* leaf = iterator.pLeaf;
+                size_t index = iterator.mIndex;
+
+                while (leaf != nullptr)
+                {
+                    for (; index < leaf->mCount; index++)
+                    {
+                        if (!this->mCompare(leaf->mKeys[index], to))
+                            return;
+
+                        function(static_cast<const K&>(leaf->mKeys[index]), leaf->mValues[index]);
+                    }
+
+                    leaf = leaf->pNext;
+                    index = 0;
+                }
+            }
+
+            /**
+             * @brief Returns the number of entries in the map.
+             * @return Number of entries.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Checks whether the map is empty.
+             * @return True if the map has no entries.
+             */
+            bool isEmpty() const
+            {
+                return this->mSize == 0;
+            }
+
+            /**
+             * @brief Returns number of levels of the tree.
+             * @return Height, 0 for empty map.
+             */
+            size_t getHeight() const
+            {
+                size_t height = 0;
+
+                for (Node* node = this->pRoot; node != nullptr; node = node->mIsLeaf ? nullptr : static_cast<InnerNode*>(node)->pChildren[0])
+                {
+                    height++;
+                }
+
+                return height;
+            }
+
+            /**
+             * @brief Removes all entries.
+             */
+            void clear()
+            {
+                if (this->pRoot != nullptr)
+                    this->destroyTree(this->pRoot);
+
+                this->pRoot = nullptr;
+                this->pFirst = nullptr;
+                this->mSize = 0;
+            }
+
+            /**
+             * @brief Returns iterator to the entry with smallest key.
+             * @return Instance of Iterator.
+             */
+            Iterator begin()
+            {
+                return Iterator(this->pFirst, 0);
+            }
+
+            /**
+             * @brief Returns iterator past the entry with largest key.
+             * @return Instance of Iterator.
+             */
+            Iterator end()
+            {
+                return Iterator(nullptr, 0);
+            }
+
+            /**
+             * @brief Returns const iterator to the entry with smallest key.
+             * @return Instance of ConstIterator.
+             */
+            ConstIterator begin() const
+            {
+                return ConstIterator(this->pFirst, 0);
+            }
+
+            /**
+             * @brief Returns const iterator past the entry with largest key.
+             * @return Instance of ConstIterator.
+             */
+            ConstIterator end() const
+            {
+                return ConstIterator(nullptr, 0);
+            }
+
+        private:
+            /**
+             * @brief Allocates empty leaf.
+             */
+            LeafNode* createLeaf()
+            {
+                DSA_INSTRUMENT_ALLOCATION(BTreeMap, sizeof(LeafNode));
+
+                return new LeafNode();
+            }
+
+            /**
+             * @brief Allocates empty inner node.
+             */
+            InnerNode* createInner()
+            {
+                DSA_INSTRUMENT_ALLOCATION(BTreeMap, sizeof(InnerNode));
+
+                return new InnerNode();
+            }
+
+            /**
+             * @brief Releases single node.
+             */
+            void destroyNode(Node* node)
+            {
+                if (node->mIsLeaf)
+                {
+                    DSA_INSTRUMENT_DEALLOCATION(BTreeMap, sizeof(LeafNode));
+                    delete static_cast<LeafNode*>(node);
+                }
+                else
+                {
+                    DSA_INSTRUMENT_DEALLOCATION(BTreeMap, sizeof(InnerNode));
+                    delete static_cast<InnerNode*>(node);
+                }
+            }
+
+            /**
+             * @brief Releases node with whole subtree.
+             */
+            void destroyTree(Node* node)
+            {
+                if (!node->mIsLeaf)
+                {
+                    InnerNode* inner = static_cast<InnerNode*>(node);
+
+                    for (size_t i = 0; i <= inner->mCount; i++)
+                    {
+                        this->destroyTree(inner->pChildren[i]);
+                    }
+                }
+
+                this->destroyNode(node);
+            }
+
+            /**
+             * @brief Finds child of inner node whose range contains key, i.e. number of separators not greater than key.
+             */
+            size_t childIndex(const InnerNode* inner, const K& key) const
+            {
+                size_t index = dsa::algorithms::searching::branchlessLowerBound(inner->mKeys, inner->mCount, key, this->mCompare);
+
+                return index < inner->mCount && !this->mCompare(key, inner->mKeys[index]) ? index + 1 : index;
+            }
+
+            /**
+             * @brief Inserts entry into subtree.
+             * @param node Root of subtree.
+             * @param key Key of entry.
+             * @param value Value of entry.
+             * @param inserted Set to true if key was new.
+             * @param separator Set to the smallest key of the new right node if node was split.
+             * @return New right sibling of node if it was split, nullptr otherwise.
+             */
+            Node* insertInto(Node* node, const K& key, V& value, bool& inserted, K& separator)
+            {
+                if (node->mIsLeaf)
+                {
+                    LeafNode* leaf = static_cast<LeafNode*>(node);
+                    size_t position = dsa::algorithms::searching::branchlessLowerBound(leaf->mKeys, leaf->mCount, key, this->mCompare);
+
+                    if (position < leaf->mCount && !this->mCompare(key, leaf->mKeys[position]))
+                    {
+                        leaf->mValues[position] = std::move(value);
+                        return nullptr;
+                    }
+
+                    inserted = true;
+
+                    if (leaf->mCount < NodeCapacity)
+                    {
+                        insertEntry(leaf, position, key, value);
+                        return nullptr;
+                    }
+
+                    LeafNode* right = this->createLeaf();
+                    size_t middle = NodeCapacity / 2;
+
+                    for (size_t i = middle; i < NodeCapacity; i++)
+                    {
+                        right->mKeys[i - middle] = std::move(leaf->mKeys[i]);
+                        right->mValues[i - middle] = std::move(leaf->mValues[i]);
+                    }
+
+                    right->mCount = static_cast<uint16_t>(NodeCapacity - middle);
+                    leaf->mCount = static_cast<uint16_t>(middle);
+
+                    right->pNext = leaf->pNext;
+                    right->pPrevious = leaf;
+
+                    if (leaf->pNext != nullptr)
+                        leaf->pNext->pPrevious = right;
+
+                    leaf->pNext = right;
+
+                    if (position <= middle)
+                        insertEntry(leaf, position, key, value);
+                    else
+                        insertEntry(right, position - middle, key, value);
+
+                    separator = right->mKeys[0];
+                    return right;
+                }
+
+                InnerNode* inner = static_cast<InnerNode*>(node);
+                size_t index = this->childIndex(inner, key);
+                K childSeparator{};
+                Node* childRight = this->insertInto(inner->pChildren[index], key, value, inserted, childSeparator);
+
+                if (childRight == nullptr)
+                    return nullptr;
+
+                if (inner->mCount < NodeCapacity)
+                {
+                    insertSeparator(inner, index, childSeparator, childRight);
+                    return nullptr;
+                }
+
+                // Full inner node is split around its middle key, which moves up to the parent.
+                InnerNode* right = this->createInner();
+                size_t middle = NodeCapacity / 2;
+
+                for (size_t i = middle + 1; i < NodeCapacity; i++)
+                {
+                    right->mKeys[i - middle - 1] = std::move(inner->mKeys[i]);
+                }
+
+                for (size_t i = middle + 1; i <= NodeCapacity; i++)
+                {
+                    right->pChildren[i - middle - 1] = inner->pChildren[i];
+                }
+
+                separator = std::move(inner->mKeys[middle]);
+                right->mCount = static_cast<uint16_t>(NodeCapacity - middle - 1);
+                inner->mCount = static_cast<uint16_t>(middle);
+
+                if (index <= middle)
+                    insertSeparator(inner, index, childSeparator, childRight);
+                else
+                    insertSeparator(right, index - middle - 1, childSeparator, childRight);
+
+                return right;
+            }
+
+            /**
+             * @brief Inserts entry at position of leaf with free space.
+             */
+            static void insertEntry(LeafNode* leaf, size_t position, const K& key, V& value)
+            {
+                for (size_t i = leaf->mCount; i > position; i--)
+                {
+                    leaf->mKeys[i] = std::move(leaf->mKeys[i - 1]);
+                    leaf->mValues[i] = std::move(leaf->mValues[i - 1]);
+                }
+
+                leaf->mKeys[position] = key;
+                leaf->mValues[position] = std::move(value);
+                leaf->mCount++;
+            }
+
+            /**
+             * @brief Inserts separator and its right child after child index of inner node with free space.
+             */
+            static void insertSeparator(InnerNode* inner, size_t index, K& separator, Node* right)
+            {
+                for (size_t i = inner->mCount; i > index; i--)
+                {
+                    inner->mKeys[i] = std::move(inner->mKeys[i - 1]);
+                    inner->pChildren[i + 1] = inner->pChildren[i];
+                }
+
+                inner->mKeys[index] = std::move(separator);
+                inner->pChildren[index + 1] = right;
+                inner->mCount++;
+            }
+
+            /**
+             * @brief Removes key from subtree, rebalancing children that fall below minimal size.
+             * @return True if key was present.
+             */
+            bool eraseFrom(Node* node, const K& key)
+            {
+                if (node->mIsLeaf)
+                {
+                    LeafNode* leaf = static_cast<LeafNode*>(node);
+                    size_t position = dsa::algorithms::searching::branchlessLowerBound(leaf->mKeys, leaf->mCount, key, this->mCompare);
+
+                    if (position == leaf->mCount || this->mCompare(key, leaf->mKeys[position]))
+                        return false;
+
+                    for (size_t i = position + 1; i < leaf->mCount; i++)
+                    {
+                        leaf->mKeys[i - 1] = std::move(leaf->mKeys[i]);
+                        leaf->mValues[i - 1] = std::move(leaf->mValues[i]);
+                    }
+
+                    leaf->mCount--;
+                    return true;
+                }
+
+                InnerNode* inner = static_cast<InnerNode*>(node);
+                size_t index = this->childIndex(inner, key);
+
+                if (!this->eraseFrom(inner->pChildren[index], key))
+                    return false;
+
+                if (inner->pChildren[index]->mCount < MinimumKeys)
+                    this->rebalance(inner, index);
+
+                return true;
+            }
+
+            /**
+             * @brief Refills underfull child by borrowing from a sibling, or merges it with the sibling.
+             */
+            void rebalance(InnerNode* parent, size_t index)
+            {
+                Node* left = index > 0 ? parent->pChildren[index - 1] : nullptr;
+                Node* right = index < parent->mCount ? parent->pChildren[index + 1] : nullptr;
+
+                if (left != nullptr && left->mCount > MinimumKeys)
+                {
+                    this->borrowFromLeft(parent, index);
+                }
+                else if (right != nullptr && right->mCount > MinimumKeys)
+                {
+                    this->borrowFromRight(parent, index);
+                }
+                else if (left != nullptr)
+                {
+                    this->merge(parent, index - 1);
+                }
+                else
+                {
+                    this->merge(parent, index);
+                }
+            }
+
+            /**
+             * @brief Moves the last entry of left sibling into child.
+             */
+            void borrowFromLeft(InnerNode* parent, size_t index)
+            {
+                Node* child = parent->pChildren[index];
+                Node* left = parent->pChildren[index - 1];
+
+                if (child->mIsLeaf)
+                {
+                    LeafNode* to = static_cast<LeafNode*>(child);
+                    LeafNode* from = static_cast<LeafNode*>(left);
+                    size_t last = from->mCount - 1;
+
+                    insertEntry(to, 0, from->mKeys[last], from->mValues[last]);
+                    from->mCount--;
+                    parent->mKeys[index - 1] = to->mKeys[0];
+                    return;
+                }
+
+                InnerNode* to = static_cast<InnerNode*>(child);
+                InnerNode* from = static_cast<InnerNode*>(left);
+
+                for (size_t i = to->mCount; i > 0; i--)
+                {
+                    to->mKeys[i] = std::move(to->mKeys[i - 1]);
+                }
+
+                for (size_t i = to->mCount + 1; i > 0; i--)
+                {
+                    to->pChildren[i] = to->pChildren[i - 1];
+                }
+
+                to->mKeys[0] = std::move(parent->mKeys[index - 1]);
+                to->pChildren[0] = from->pChildren[from->mCount];
+                to->mCount++;
+
+                parent->mKeys[index - 1] = std::move(from->mKeys[from->mCount - 1]);
+                from->mCount--;
+            }
+
+            /**
+             * @brief Moves the first entry of right sibling into child.
+             */
+            void borrowFromRight(InnerNode* parent, size_t index)
+            {
+                Node* child = parent->pChildren[index];
+                Node* right = parent->pChildren[index + 1];
+
+                if (child->mIsLeaf)
+                {
+                    LeafNode* to = static_cast<LeafNode*>(child);
+                    LeafNode* from = static_cast<LeafNode*>(right);
+
+                    insertEntry(to, to->mCount, from->mKeys[0], from->mValues[0]);
+
+                    for (size_t i = 1; i < from->mCount; i++)
+                    {
+                        from->mKeys[i - 1] = std::move(from->mKeys[i]);
+                        from->mValues[i - 1] = std::move(from->mValues[i]);
+                    }
+
+                    from->mCount--;
+                    parent->mKeys[index] = from->mKeys[0];
+                    return;
+                }
+
+                InnerNode* to = static_cast<InnerNode*>(child);
+                InnerNode* from = static_cast<InnerNode*>(right);
+
+                to->mKeys[to->mCount] = std::move(parent->mKeys[index]);
+                to->pChildren[to->mCount + 1] = from->pChildren[0];
+                to->mCount++;
+
+                parent->mKeys[index] = std::move(from->mKeys[0]);
+
+                for (size_t i = 1; i < from->mCount; i++)
+                {
+                    from->mKeys[i - 1] = std::move(from->mKeys[i]);
+                }
+
+                for (size_t i = 1; i <= from->mCount; i++)
+                {
+                    from->pChildren[i - 1] = from->pChildren[i];
+                }
+
+                from->mCount--;
+            }
+
+            /**
+             * @brief Merges child index + 1 into child index and removes their separator from parent.
+             */
+            void merge(InnerNode* parent, size_t index)
+            {
+                Node* left = parent->pChildren[index];
+                Node* right = parent->pChildren[index + 1];
+
+                if (left->mIsLeaf)
+                {
+                    LeafNode* to = static_cast<LeafNode*>(left);
+                    LeafNode* from = static_cast<LeafNode*>(right);
+
+                    for (size_t i = 0; i < from->mCount; i++)
+                    {
+                        to->mKeys[to->mCount + i] = std::move(from->mKeys[i]);
+                        to->mValues[to->mCount + i] = std::move(from->mValues[i]);
+                    }
+
+                    to->mCount = static_cast<uint16_t>(to->mCount + from->mCount);
+                    to->pNext = from->pNext;
+
+                    if (from->pNext != nullptr)
+                        from->pNext->pPrevious = to;
+                }
+                else
+                {
+                    InnerNode* to = static_cast<InnerNode*>(left);
+                    InnerNode* from = static_cast<InnerNode*>(right);
+
+                    to->mKeys[to->mCount] = std::move(parent->mKeys[index]);
+
+                    for (size_t i = 0; i < from->mCount; i++)
+                    {
+                        to->mKeys[to->mCount + 1 + i] = std::move(from->mKeys[i]);
+                    }
+
+                    for (size_t i = 0; i <= from->mCount; i++)
+                    {
+                        to->pChildren[to->mCount + 1 + i] = from->pChildren[i];
+                    }
+
+                    to->mCount = static_cast<uint16_t>(to->mCount + 1 + from->mCount);
+                }
+
+                for (size_t i = index + 1; i < parent->mCount; i++)
+                {
+                    parent->mKeys[i - 1] = std::move(parent->mKeys[i]);
+                }
+
+                for (size_t i = index + 2; i <= parent->mCount; i++)
+                {
+                    parent->pChildren[i - 1] = parent->pChildren[i];
+                }
+
+                parent->mCount--;
+                this->destroyNode(right);
+            }
+    };
+}
@@ -0,0 +1,385 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <dsa/algorithms/searching/binary_search.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/associative/flat_set.h>
+
+namespace dsa::structures::associative
+{
+    /**
+     * @brief Read-optimized sorted map stored in contiguous DynamicArrays.
+     *
+     * Keys and values are kept in two separate arrays, so lookups only touch the densely packed
+     * keys. The map is built once from unsorted entries and afterwards values can be modified but
+     * keys cannot be added or removed without rebuilding.
+     *
+     * @tparam K Type of keys.
+     * @tparam V Type of values.
+     * @tparam Compare Comparator defining key order.
+     * @tparam Layout Memory layout of keys.
+     */
+    template<typename K, typename V, typename Compare = std::less<K>, FlatLayout Layout = FlatLayout::Sorted>
+    class FlatMap
+    {
+        friend class FlatIterator<FlatMap<K, V, Compare, Layout>>;
+        friend class FlatIterator<const FlatMap<K, V, Compare, Layout>>;
+
+        public:
+            using KeyType = K;
+            using ValueType = V;
+            using EntryType = std::pair<K, V>;
+            using ReferenceType = V&;
+            using ConstReferenceType = const V&;
+            using Iterator = FlatIterator<FlatMap<K, V, Compare, Layout>>;
+            using ConstIterator = FlatIterator<const FlatMap<K, V, Compare, Layout>>;
+
+        private:
+            dsa::structures::arrays::DynamicArray<K> mKeys;     /// Keys in storage order given by layout.
+            dsa::structures::arrays::DynamicArray<V> mValues;   /// Values in the same order as keys.
+            Compare mCompare;                                   /// Comparator instance.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty map.
+             */
+            FlatMap() : mKeys(), mValues(), mCompare() {}
+
+            /**
+             * @brief Builds the map from an initializer list of unsorted entries.
+             * @param list Initializer list of entries, for duplicate keys the first entry is kept.
+             */
+            FlatMap(std::initializer_list<EntryType> list) : FlatMap(dsa::structures::arrays::DynamicArray<EntryType>(list)) {}
+
+            /**
+             * @brief Builds the map from array of unsorted entries.
+             * @param entries Array of entries, for duplicate keys the first entry is kept.
+             * @param compare Comparator instance.
+             */
+            explicit FlatMap(dsa::structures::arrays::DynamicArray<EntryType> entries, const Compare& compare = Compare()) : mKeys(), mValues(), mCompare(compare)
+            {
+                this->build(std::move(entries));
+            }
+
+            /**
+             * @brief Replaces content of the map by unsorted entries.
+             * @param entries Array of entries, for duplicate keys the first entry is kept.
+             */
+            void build(dsa::structures::arrays::DynamicArray<EntryType> entries)
+            {
+                EntryType* data = entries.getData();
+                size_t size = entries.getSize();
+
+                std::stable_sort(data, data + size, [this](const EntryType& a, const EntryType& b) {
+                    return this->mCompare(a.first, b.first);
+                });
+
+                size_t unique = 0;
+
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (unique != 0 && !this->mCompare(data[unique - 1].first, data[i].first))
+                        continue;
+
+                    if (unique != i)
+                        data[unique] = std::move(data[i]);
+
+                    unique++;
+                }
+
+                dsa::structures::arrays::DynamicArray<K> keys(unique);
+                dsa::structures::arrays::DynamicArray<V> values(unique);
+
+                for (size_t i = 0; i < unique; i++)
+                {
+                    keys.getData()[i] = std::move(data[i].first);
+                    values.getData()[i] = std::move(data[i].second);
+                }
+
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                {
+                    this->mKeys = dsa::structures::arrays::DynamicArray<K>(unique);
+                    this->mValues = dsa::structures::arrays::DynamicArray<V>(unique);
+
+                    dsa::algorithms::searching::eytzingerLayout(keys.getData(), this->mKeys.getData(), unique);
+                    dsa::algorithms::searching::eytzingerLayout(values.getData(), this->mValues.getData(), unique);
+                }
+                else
+                {
+                    this->mKeys = std::move(keys);
+                    this->mValues = std::move(values);
+                }
+            }
+
+            /**
+             * @brief Returns a reference to value of key.
+             * @param key Key to search for.
+             * @return Reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ReferenceType get(const K& key)
+            {
+                V* value = this->find(key);
+
+                if (value == nullptr)
+                    throw std::out_of_range("Key is not present in map");
+
+                return *value;
+            }
+
+            /**
+             * @brief Returns a const reference to value of key.
+             * @param key Key to search for.
+             * @return Const reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ConstReferenceType get(const K& key) const
+            {
+                const V* value = this->find(key);
+
+                if (value == nullptr)
+                    throw std::out_of_range("Key is not present in map");
+
+                return *value;
+            }
+
+            /**
+             * @brief Subscript operator.
+             * @param key Key to search for.
+             * @return Reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ReferenceType operator[](const K& key)
+            {
+                return this->get(key);
+            }
+
+            /**
+             * @brief Subscript operator (const version).
+             * @param key Key to search for.
+             * @return Const reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ConstReferenceType operator[](const K& key) const
+            {
+                return this->get(key);
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @return Pointer to value, nullptr if key is not present.
+             */
+            V* find(const K& key)
+            {
+                size_t position = this->findPosition(key);
+
+                if (position == this->endPosition())
+                    return nullptr;
+
+                return &this->valueAt(position);
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @return Const pointer to value, nullptr if key is not present.
+             */
+            const V* find(const K& key) const
+            {
+                size_t position = this->findPosition(key);
+
+                if (position == this->endPosition())
+                    return nullptr;
+
+                return &this->valueAt(position);
+            }
+
+            /**
+             * @brief Checks whether key is in the map.
+             * @param key Key to search for.
+             * @return True if key is present.
+             */
+            bool contains(const K& key) const
+            {
+                return this->findPosition(key) != this->endPosition();
+            }
+
+            /**
+             * @brief Returns the number of entries in the map.
+             * @return Number of entries.
+             */
+            size_t getSize() const
+            {
+                return this->mKeys.getSize();
+            }
+
+            /**
+             * @brief Checks whether the map is empty.
+             * @return True if the map has no entries.
+             */
+            bool isEmpty() const
+            {
+                return this->mKeys.getSize() == 0;
+            }
+
+            /**
+             * @brief Returns iterator to the entry with smallest key.
+             * @return Instance of FlatIterator, dereferences to pair of key and value references.
+             */
+            Iterator begin()
+            {
+                return Iterator(this, this->beginPosition());
+            }
+
+            /**
+             * @brief Returns iterator past the entry with largest key.
+             * @return Instance of FlatIterator.
+             */
+            Iterator end()
+            {
+                return Iterator(this, this->endPosition());
+            }
+
+            /**
+             * @brief Returns const iterator to the entry with smallest key.
+             * @return Instance of FlatIterator, dereferences to pair of const key and value references.
+             */
+            ConstIterator begin() const
+            {
+                return ConstIterator(this, this->beginPosition());
+            }
+
+            /**
+             * @brief Returns const iterator past the entry with largest key.
+             * @return Instance of FlatIterator.
+             */
+            ConstIterator end() const
+            {
+                return ConstIterator(this, this->endPosition());
+            }
+
+        private:
+            /**
+             * @brief Finds storage position of key.
+             * @param key Key to search for.
+             * @return Storage position, endPosition() if key is not present.
+             */
+            size_t findPosition(const K& key) const
+            {
+                const K* keys = this->mKeys.getData();
+                size_t size = this->mKeys.getSize();
+
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                {
+                    size_t k = dsa::algorithms::searching::eytzingerLowerBound(keys, size, key, this->mCompare);
+
+                    if (k == 0 || this->mCompare(key, keys[k - 1]))
+                        return this->endPosition();
+
+                    return k;
+                }
+                else
+                {
+                    size_t i = dsa::algorithms::searching::branchlessLowerBound(keys, size, key, this->mCompare);
+
+                    if (i == size || this->mCompare(key, keys[i]))
+                        return this->endPosition();
+
+                    return i;
+                }
+            }
+
+            /**
+             * @brief Gets storage position of the smallest key.
+             * @return Storage position.
+             */
+            size_t beginPosition() const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return dsa::algorithms::searching::eytzingerFirst(this->getSize());
+                else
+                    return 0;
+            }
+
+            /**
+             * @brief Gets storage position following given position in sorted order.
+             * @param position Storage position.
+             * @return Next storage position.
+             */
+            size_t nextPosition(size_t position) const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return dsa::algorithms::searching::eytzingerNext(position, this->getSize());
+                else
+                    return position + 1;
+            }
+
+            /**
+             * @brief Gets storage position used as end marker.
+             * @return End position.
+             */
+            size_t endPosition() const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return 0;
+                else
+                    return this->getSize();
+            }
+
+            /**
+             * @brief Converts storage position to array index.
+             * @param position Storage position.
+             * @return Index into key and value arrays.
+             */
+            static constexpr size_t indexOf(size_t position)
+            {
+                return Layout == FlatLayout::Eytzinger ? position - 1 : position;
+            }
+
+            /**
+             * @brief Gets value at storage position.
+             * @param position Storage position.
+             * @return Reference to value.
+             */
+            ReferenceType valueAt(size_t position)
+            {
+                return this->mValues.getData()[indexOf(position)];
+            }
+
+            /**
+             * @brief Gets value at storage position.
+             * @param position Storage position.
+             * @return Const reference to value.
+             */
+            ConstReferenceType valueAt(size_t position) const
+            {
+                return this->mValues.getData()[indexOf(position)];
+            }
+
+            /**
+             * @brief Gets entry at storage position.
+             * @param position Storage position.
+             * @return Pair of key and value references.
+             */
+            std::pair<const K&, V&> elementAt(size_t position)
+            {
+                return { this->mKeys.getData()[indexOf(position)], this->mValues.getData()[indexOf(position)] };
+            }
+
+            /**
+             * @brief Gets entry at storage position.
+             * @param position Storage position.
+             * @return Pair of key and value const references.
+             */
+            std::pair<const K&, const V&> elementAt(size_t position) const
+            {
+                return { this->mKeys.getData()[indexOf(position)], this->mValues.getData()[indexOf(position)] };
+            }
+    };
+}
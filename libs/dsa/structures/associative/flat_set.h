@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <dsa/algorithms/searching/binary_search.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+
+namespace dsa::structures::associative
+{
+    /**
+     * @brief Memory layout of keys in flat associative containers.
+     */
+    enum class FlatLayout
+    {
+        Sorted,         /// Keys stored in sorted order, searched by branchless binary search.
+        Eytzinger       /// Keys stored in breadth-first order of implicit search tree, searched with prefetching.
+    };
+
+    /**
+     * @brief Iterator class for flat associative containers. Visits elements in sorted order.
+     * @tparam Container Type of flat container.
+     */
+    template<typename Container>
+    class FlatIterator
+    {
+        private:
+            Container* pContainer;      /// Pointer to iterated container.
+            size_t mPosition;           /// Storage position of current element.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes iterator to element at given storage position.
+             * @param container Iterated container.
+             * @param position Storage position of element.
+             */
+            FlatIterator(Container* container, size_t position) : pContainer(container), mPosition(position) {}
+
+            /**
+             * @brief Postfix increment operator. Moves to next element in sorted order.
+             * @return Reference to this instance of FlatIterator.
+             */
+            FlatIterator& operator++()
+            {
+                this->mPosition = this->pContainer->nextPosition(this->mPosition);
+                return *this;
+            }
+
+            /**
+             * @brief Prefix increment operator. Moves to next element in sorted order.
+             * @return Instance of iterator.
+             */
+            FlatIterator operator++(int)
+            {
+                FlatIterator iterator = *this;
+                ++(*this);
+                return iterator;
+            }
+
+            /**
+             * @brief Gets current element.
+             * @return Element of container at current position.
+             */
+            decltype(auto) operator*() const
+            {
+                return this->pContainer->elementAt(this->mPosition);
+            }
+
+            /**
+             * @brief Equals operator.
+             * @param other Other instance of FlatIterator to compare with.
+             * @return True if iterators point to same element.
+             */
+            bool operator==(const FlatIterator& other) const
+            {
+                return this->mPosition == other.mPosition;
+            }
+
+            /**
+             * @brief Not equals operator.
+             * @param other Other instance of FlatIterator to compare with.
+             * @return True if iterators point to different elements.
+             */
+            bool operator!=(const FlatIterator& other) const
+            {
+                return this->mPosition != other.mPosition;
+            }
+    };
+
+    /**
+     * @brief Read-optimized sorted set stored in single contiguous DynamicArray.
+     *
+     * The set is built once from unsorted input and then only queried. Lookups use branchless
+     * binary search, or with Eytzinger layout a prefetching search over breadth-first ordered keys,
+     * which is considerably faster for sets larger than L2 cache.
+     *
+     * @tparam K Type of keys.
+     * @tparam Compare Comparator defining key order.
+     * @tparam Layout Memory layout of keys.
+     */
+    template<typename K, typename Compare = std::less<K>, FlatLayout Layout = FlatLayout::Sorted>
+    class FlatSet
+    {
+        friend class FlatIterator<const FlatSet<K, Compare, Layout>>;
+
+        public:
+            using KeyType = K;
+            using ConstReferenceType = const K&;
+            using Iterator = FlatIterator<const FlatSet<K, Compare, Layout>>;
+
+        private:
+            dsa::structures::arrays::DynamicArray<K> mKeys;     /// Keys in storage order given by layout.
+            Compare mCompare;                                   /// Comparator instance.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty set.
+             */
+            FlatSet() : mKeys(), mCompare() {}
+
+            /**
+             * @brief Builds the set from an initializer list of unsorted keys.
+             * @param list Initializer list of keys, duplicates are ignored.
+             */
+            FlatSet(std::initializer_list<K> list) : FlatSet(dsa::structures::arrays::DynamicArray<K>(list)) {}
+
+            /**
+             * @brief Builds the set from array of unsorted keys.
+             * @param keys Array of keys, duplicates are ignored.
+             * @param compare Comparator instance.
+             */
+            explicit FlatSet(dsa::structures::arrays::DynamicArray<K> keys, const Compare& compare = Compare()) : mKeys(), mCompare(compare)
+            {
+                this->build(std::move(keys));
+            }
+
+            /**
+             * @brief Replaces content of the set by keys from unsorted array.
+             * @param keys Array of keys, duplicates are ignored.
+             */
+            void build(dsa::structures::arrays::DynamicArray<K> keys)
+            {
+                K* data = keys.getData();
+                size_t size = keys.getSize();
+
+                std::sort(data, data + size, this->mCompare);
+
+                size_t unique = 0;
+
+                for (size_t i = 0; i < size; i++)
+                {
+                    if (unique != 0 && !this->mCompare(data[unique - 1], data[i]))
+                        continue;
+
+                    if (unique != i)
+                        data[unique] = std::move(data[i]);
+
+                    unique++;
+                }
+
+                this->mKeys = dsa::structures::arrays::DynamicArray<K>(unique);
+
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                {
+                    dsa::algorithms::searching::eytzingerLayout(data, this->mKeys.getData(), unique);
+                }
+                else
+                {
+                    for (size_t i = 0; i < unique; i++)
+                    {
+                        this->mKeys.getData()[i] = std::move(data[i]);
+                    }
+                }
+            }
+
+            /**
+             * @brief Checks whether key is in the set.
+             * @param key Key to search for.
+             * @return True if key is present.
+             */
+            bool contains(const K& key) const
+            {
+                return this->findPosition(key) != this->endPosition();
+            }
+
+            /**
+             * @brief Returns the number of keys in the set.
+             * @return Number of keys.
+             */
+            size_t getSize() const
+            {
+                return this->mKeys.getSize();
+            }
+
+            /**
+             * @brief Checks whether the set is empty.
+             * @return True if the set has no keys.
+             */
+            bool isEmpty() const
+            {
+                return this->mKeys.getSize() == 0;
+            }
+
+            /**
+             * @brief Returns iterator to the smallest key.
+             * @return Instance of FlatIterator.
+             */
+            Iterator begin() const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return Iterator(this, dsa::algorithms::searching::eytzingerFirst(this->getSize()));
+                else
+                    return Iterator(this, 0);
+            }
+
+            /**
+             * @brief Returns iterator past the largest key.
+             * @return Instance of FlatIterator.
+             */
+            Iterator end() const
+            {
+                return Iterator(this, this->endPosition());
+            }
+
+        private:
+            /**
+             * @brief Finds storage position of key.
+             * @param key Key to search for.
+             * @return Storage position, endPosition() if key is not present.
+             */
+            size_t findPosition(const K& key) const
+            {
+                const K* keys = this->mKeys.getData();
+                size_t size = this->mKeys.getSize();
+
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                {
+                    size_t k = dsa::algorithms::searching::eytzingerLowerBound(keys, size, key, this->mCompare);
+
+                    if (k == 0 || this->mCompare(key, keys[k - 1]))
+                        return this->endPosition();
+
+                    return k;
+                }
+                else
+                {
+                    size_t i = dsa::algorithms::searching::branchlessLowerBound(keys, size, key, this->mCompare);
+
+                    if (i == size || this->mCompare(key, keys[i]))
+                        return this->endPosition();
+
+                    return i;
+                }
+            }
+
+            /**
+             * @brief Gets storage position following given position in sorted order.
+             * @param position Storage position.
+             * @return Next storage position.
+             */
+            size_t nextPosition(size_t position) const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return dsa::algorithms::searching::eytzingerNext(position, this->getSize());
+                else
+                    return position + 1;
+            }
+
+            /**
+             * @brief Gets storage position used as end marker.
+             * @return End position.
+             */
+            size_t endPosition() const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return 0;
+                else
+                    return this->getSize();
+            }
+
+            /**
+             * @brief Gets key at storage position.
+             * @param position Storage position.
+             * @return Const reference to key.
+             */
+            ConstReferenceType elementAt(size_t position) const
+            {
+                if constexpr (Layout == FlatLayout::Eytzinger)
+                    return this->mKeys.getData()[position - 1];
+                else
+                    return this->mKeys.getData()[position];
+            }
+    };
+}
@@ -0,0 +1,489 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <thread>
+#include <dsa/utility/epoch.h>
+#include <dsa/utility/instrumentation.h>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::structures::concurrent
+{
+    /**
+     * @brief Ordered map that any number of threads can read and modify concurrently without locks.
+     *
+     * Every node has a tower of forward pointers, one per level it takes part in; level 0 links all
+     * entries in key order and higher levels skip over geometrically more of them. Pointers are
+     * changed only by compare-and-swap. Erasing first marks the lowest bit of every forward pointer
+     * of the node, which freezes them and makes the entry logically absent, and then any thread
+     * passing the node unlinks it (Harris / Fraser skip list). Unlinked nodes are released through
+     * EpochManager once no running operation can still hold them.
+     *
+     * Entries are immutable once inserted. Size and range scans are weakly consistent while other
+     * threads modify the list.
+     *
+     * @tparam K Type of keys.
+     * @tparam V Type of values, copied out by find().
+     * @tparam Compare Comparator defining key order.
+     */
+    template<typename K, typename V, typename Compare = std::less<K>>
+    class LockFreeSkipList
+    {
+        public:
+            static constexpr uint32_t MaxLevel = 32;    /// Maximal height of tower.
+
+        private:
+            /**
+             * @brief Entry followed in the same allocation by tower of mLevel forward pointers.
+             */
+            struct alignas(std::atomic<uintptr_t>) Node
+            {
+                const K mKey;                       /// Key of entry.
+                const V mValue;                     /// Value of entry.
+                uint32_t mLevel;                    /// Height of tower.
+                std::atomic<uint32_t> mOwners;      /// Inserter and eraser, the last one to finish retires the node.
+
+                Node(const K& key, const V& value, uint32_t level) : mKey(key), mValue(value), mLevel(level), mOwners(2) {}
+
+                /**
+                 * @brief Gets forward pointers stored right after the node.
+                 */
+                std::atomic<uintptr_t>* getTower()
+                {
+                    return reinterpret_cast<std::atomic<uintptr_t>*>(this + 1);
+                }
+            };
+
+            std::atomic<uintptr_t>* pHead;                  /// Forward pointers of head, one per level.
+            std::atomic<uint32_t> mLevels;                  /// Height of the highest tower ever inserted.
+            std::atomic<size_t> mSize;                      /// Number of entries.
+            mutable dsa::utility::EpochManager mEpochs;     /// Reclamation of unlinked nodes.
+            Compare mCompare;                               /// Comparator instance.
+
+        public:
+            using KeyType = K;
+            using ValueType = V;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty list.
+             * @param compare Comparator instance.
+             */
+            explicit LockFreeSkipList(const Compare& compare = Compare()) : pHead(new std::atomic<uintptr_t>[MaxLevel]()), mLevels(1), mSize(0), mEpochs(), mCompare(compare) {}
+
+            LockFreeSkipList(const LockFreeSkipList&) = delete;
+            LockFreeSkipList& operator=(const LockFreeSkipList&) = delete;
+
+            /**
+             * @brief Destructor. Releases all nodes, no other thread may use the list.
+             */
+            ~LockFreeSkipList()
+            {
+                Node* node = pointer(this->pHead[0].load());
+
+                while (node != nullptr)
+                {
+                    Node* next = pointer(node->getTower()[0].load());
+
+                    destroyNode(node);
+                    node = next;
+                }
+
+                delete[] this->pHead;
+            }
+
+            /**
+             * @brief Inserts entry if key is not present.
+             * @param key Key of entry.
+             * @param value Value of entry.
+             * @return True if entry was inserted, false if key was already present.
+             */
+            bool insert(const K& key, const V& value)
+            {
+                dsa::utility::EpochManager::Guard guard = this->mEpochs.enter();
+                Node* predecessors[MaxLevel];
+                Node* successors[MaxLevel];
+                uint32_t level = randomLevel();
+                uint32_t levels = this->mLevels.load(std::memory_order_relaxed);
+                Node* node = nullptr;
+
+                // Searches cover only levels in use, raise the height before the search positions the new tower.
+                while (levels < level)
+                {
+                    if (this->mLevels.compare_exchange_weak(levels, level, std::memory_order_relaxed))
+                        break;
+                }
+
+                while (true)
+                {
+                    if (this->search(key, predecessors, successors))
+                    {
+                        if (node != nullptr)
+                            destroyNode(node);
+
+                        return false;
+                    }
+
+                    if (node == nullptr)
+                        node = createNode(key, value, level);
+
+                    for (uint32_t l = 0; l < level; l++)
+                    {
+                        node->getTower()[l].store(address(successors[l]), std::memory_order_relaxed);
+                    }
+
+                    // Entry becomes visible once linked at level 0, upper levels are only shortcuts.
+                    uintptr_t expected = address(successors[0]);
+
+                    if (this->next(predecessors[0])[0].compare_exchange_strong(expected, address(node), std::memory_order_release, std::memory_order_relaxed))
+                        break;
+                }
+
+                this->mSize.fetch_add(1, std::memory_order_relaxed);
+
+                for (uint32_t l = 1; l < level; l++)
+                {
+                    if (!this->linkLevel(node, l, predecessors, successors))
+                        break;
+                }
+
+                // Node erased while its tower was being linked may have been linked again above, unlink it for good.
+                // Fence pairs with the one in erase(): either this load sees the mark or eraser's search sees the links.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (isMarked(node->getTower()[0].load(std::memory_order_acquire)))
+                    this->search(key, predecessors, successors);
+
+                this->release(guard, node);
+
+                return true;
+            }
+
+            /**
+             * @brief Removes entry of key.
+             * @param key Key to remove.
+             * @return True if this call removed the entry.
+             */
+            bool erase(const K& key)
+            {
+                dsa::utility::EpochManager::Guard guard = this->mEpochs.enter();
+                Node* predecessors[MaxLevel];
+                Node* successors[MaxLevel];
+
+                if (!this->search(key, predecessors, successors))
+                    return false;
+
+                Node* node = successors[0];
+                std::atomic<uintptr_t>* tower = node->getTower();
+
+                for (uint32_t l = node->mLevel - 1; l > 0; l--)
+                {
+                    tower[l].fetch_or(1, std::memory_order_acq_rel);
+                }
+
+                // Marking level 0 is the linearization point, only one of concurrent erasers succeeds.
+                uintptr_t successor = tower[0].load(std::memory_order_acquire);
+
+                do
+                {
+                    if (isMarked(successor))
+                        return false;
+                }
+                while (!tower[0].compare_exchange_weak(successor, successor | 1, std::memory_order_acq_rel, std::memory_order_acquire));
+
+                this->mSize.fetch_sub(1, std::memory_order_relaxed);
+
+                // Fence pairs with the one in insert(), so links made by a concurrent insert are seen and unlinked here.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                this->search(key, predecessors, successors);
+                this->release(guard, node);
+
+                return true;
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @param value Receives copy of value if key is present.
+             * @return True if key is present.
+             */
+            bool find(const K& key, V& value) const
+            {
+                dsa::utility::EpochManager::Guard guard = this->mEpochs.enter();
+                Node* node = this->lowerBound(key);
+
+                if (node == nullptr || this->mCompare(key, node->mKey))
+                    return false;
+
+                value = node->mValue;
+                return true;
+            }
+
+            /**
+             * @brief Checks whether key is in the list.
+             * @param key Key to search for.
+             * @return True if key is present.
+             */
+            bool contains(const K& key) const
+            {
+                dsa::utility::EpochManager::Guard guard = this->mEpochs.enter();
+                Node* node = this->lowerBound(key);
+
+                return node != nullptr && !this->mCompare(key, node->mKey);
+            }
+
+            /**
+             * @brief Calls function for entries with key in range [from, to) in key order.
+             *
+             * Entries inserted or erased concurrently with the scan may or may not be visited.
+             *
+             * @param from Smallest key of range.
+             * @param to Key past the range.
+             * @param function Callable taking const key and const value references.
+             */
+            template<typename Function>
+            void forEachInRange(const K& from, const K& to, Function function) const
+            {
+                dsa::utility::EpochManager::Guard guard = this->mEpochs.enter();
+                Node* node = this->lowerBound(from);
+
+                while (node != nullptr && this->mCompare(node->mKey, to))
+                {
+                    uintptr_t successor = node->getTower()[0].load(std::memory_order_acquire);
+
+                    if (!isMarked(successor))
+                        function(node->mKey, node->mValue);
+
+                    node = pointer(successor);
+                }
+            }
+
+            /**
+             * @brief Returns the number of entries, approximate while other threads modify the list.
+             * @return Number of entries.
+             */
+            size_t getSize() const
+            {
+                return this->mSize.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Checks whether the list is empty.
+             * @return True if the list has no entries.
+             */
+            bool isEmpty() const
+            {
+                return this->getSize() == 0;
+            }
+
+        private:
+            /**
+             * @brief Strips mark bit from forward pointer.
+             */
+            static Node* pointer(uintptr_t link)
+            {
+                return reinterpret_cast<Node*>(link & ~static_cast<uintptr_t>(1));
+            }
+
+            /**
+             * @brief Checks whether forward pointer belongs to erased node.
+             */
+            static bool isMarked(uintptr_t link)
+            {
+                return (link & 1) != 0;
+            }
+
+            /**
+             * @brief Converts node to unmarked forward pointer.
+             */
+            static uintptr_t address(Node* node)
+            {
+                return reinterpret_cast<uintptr_t>(node);
+            }
+
+            /**
+             * @brief Gets forward pointers of node, nullptr stands for head.
+             */
+            std::atomic<uintptr_t>* next(Node* node) const
+            {
+                return node == nullptr ? this->pHead : node->getTower();
+            }
+
+            /**
+             * @brief Picks tower height with probability 1/2^level from per-thread xorshift generator.
+             */
+            static uint32_t randomLevel()
+            {
+                thread_local uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                return 1 + dsa::utility::countTrailingZeros(state | (static_cast<uint64_t>(1) << (MaxLevel - 1)));
+            }
+
+            /**
+             * @brief Allocates node together with its tower.
+             */
+            static Node* createNode(const K& key, const V& value, uint32_t level)
+            {
+                size_t bytes = sizeof(Node) + level * sizeof(std::atomic<uintptr_t>);
+
+                DSA_INSTRUMENT_ALLOCATION(LockFreeSkipList, bytes);
+
+                Node* node = new (::operator new(bytes)) Node(key, value, level);
+
+                for (uint32_t l = 0; l < level; l++)
+                {
+                    new (&node->getTower()[l]) std::atomic<uintptr_t>(0);
+                }
+
+                return node;
+            }
+
+            /**
+             * @brief Releases node together with its tower.
+             */
+            static void destroyNode(Node* node)
+            {
+                DSA_INSTRUMENT_DEALLOCATION(LockFreeSkipList, sizeof(Node) + node->mLevel * sizeof(std::atomic<uintptr_t>));
+
+                node->~Node();
+                ::operator delete(node);
+            }
+
+            /**
+             * @brief Deleter passed to EpochManager.
+             */
+            static void reclaim(void* node)
+            {
+                destroyNode(static_cast<Node*>(node));
+            }
+
+            /**
+             * @brief Drops ownership of inserter or eraser, the last owner retires the node.
+             */
+            static void release(dsa::utility::EpochManager::Guard& guard, Node* node)
+            {
+                if (node->mOwners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    guard.retire(node, &LockFreeSkipList::reclaim);
+            }
+
+            /**
+             * @brief Finds neighbours of key on every level, unlinking erased nodes on the way.
+             * @param key Key to search for.
+             * @param predecessors Receives last node before key on each level in use, nullptr for head.
+             * @param successors Receives first node not before key on each level in use.
+             * @return True if unerased entry of key was found.
+             */
+            bool search(const K& key, Node** predecessors, Node** successors)
+            {
+                while (!this->tryLocate(key, predecessors, successors))
+                {
+                }
+
+                return successors[0] != nullptr && !this->mCompare(key, successors[0]->mKey);
+            }
+
+            /**
+             * @brief Single pass of search, fails if unlinking lost a race and search has to restart.
+             */
+            bool tryLocate(const K& key, Node** predecessors, Node** successors)
+            {
+                Node* predecessor = nullptr;
+                uint32_t levels = this->mLevels.load(std::memory_order_relaxed);
+
+                for (uint32_t l = levels; l-- > 0;)
+                {
+                    Node* current = pointer(this->next(predecessor)[l].load(std::memory_order_acquire));
+
+                    while (current != nullptr)
+                    {
+                        uintptr_t successor = current->getTower()[l].load(std::memory_order_acquire);
+
+                        if (isMarked(successor))
+                        {
+                            uintptr_t expected = address(current);
+
+                            if (!this->next(predecessor)[l].compare_exchange_strong(expected, successor & ~static_cast<uintptr_t>(1), std::memory_order_acq_rel, std::memory_order_relaxed))
+                                return false;
+
+                            current = pointer(successor);
+                            continue;
+                        }
+
+                        if (!this->mCompare(current->mKey, key))
+                            break;
+
+                        predecessor = current;
+                        current = pointer(successor);
+                    }
+
+                    predecessors[l] = predecessor;
+                    successors[l] = current;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Links inserted node at upper level of its tower.
+             * @return False if node was erased meanwhile and linking has to stop.
+             */
+            bool linkLevel(Node* node, uint32_t level, Node** predecessors, Node** successors)
+            {
+                std::atomic<uintptr_t>& link = node->getTower()[level];
+
+                while (true)
+                {
+                    uintptr_t current = link.load(std::memory_order_acquire);
+
+                    if (isMarked(current))
+                        return false;
+
+                    if (current != address(successors[level]) && !link.compare_exchange_strong(current, address(successors[level]), std::memory_order_acq_rel))
+                        return false;
+
+                    uintptr_t expected = address(successors[level]);
+
+                    if (this->next(predecessors[level])[level].compare_exchange_strong(expected, address(node), std::memory_order_release, std::memory_order_relaxed))
+                        return true;
+
+                    this->search(node->mKey, predecessors, successors);
+                }
+            }
+
+            /**
+             * @brief Finds first unerased node not before key without modifying the list.
+             */
+            Node* lowerBound(const K& key) const
+            {
+                Node* predecessor = nullptr;
+                Node* current = nullptr;
+
+                for (uint32_t l = this->mLevels.load(std::memory_order_relaxed); l-- > 0;)
+                {
+                    current = pointer(this->next(predecessor)[l].load(std::memory_order_acquire));
+
+                    while (current != nullptr)
+                    {
+                        uintptr_t successor = current->getTower()[l].load(std::memory_order_acquire);
+
+                        if (!isMarked(successor) && !this->mCompare(current->mKey, key))
+                            break;
+
+                        if (!isMarked(successor))
+                            predecessor = current;
+
+                        current = pointer(successor);
+                    }
+                }
+
+                return current;
+            }
+    };
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/allocation_policy.h>
+#include <dsa/utility/hash.h>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::structures::filters
+{
+    /**
+     * @brief Approximate set answering "definitely absent" or "probably present", stored in cache line sized blocks.
+     *
+     * Classic Bloom filter sets k bits spread over the whole bit array for each key, so every lookup
+     * costs up to k cache misses. Here the first part of the hash selects one 512-bit block aligned
+     * to a cache line and all k bits are set inside it, so lookup touches exactly one line. Packing
+     * keys into blocks unevenly costs slightly higher false positive rate than classic filter of the
+     * same size, which is compensated by sizing.
+     *
+     * Keys cannot be removed. False negatives never happen.
+     *
+     * @tparam T Type of keys.
+     * @tparam Hash Hash function of keys, its result is remixed so identity hashes are fine.
+     */
+    template<typename T, typename Hash = std::hash<T>>
+    class BloomFilter
+    {
+        public:
+            static constexpr size_t BlockBits = dsa::utility::CacheLineSize * 8;     /// Bits per block.
+            static constexpr size_t MaxHashCount = 16;                              /// Maximal number of bits per key.
+            static constexpr size_t BatchSize = 16;                                 /// Keys hashed and prefetched ahead by containsMany().
+
+        private:
+            static constexpr size_t WordsPerBlock = BlockBits / 64;
+            static constexpr double BlockingOverhead = 1.1;     /// Extra bits compensating uneven load of blocks.
+
+            using Words = dsa::structures::arrays::DynamicArray<uint64_t,
+                dsa::utility::AlignedAllocationPolicy<uint64_t, dsa::utility::CacheLineSize>>;
+
+            Words mWords;               /// Bits of all blocks.
+            size_t mBlockCount;         /// Number of blocks.
+            size_t mHashCount;          /// Number of bits set per key.
+            size_t mSize;               /// Number of inserted keys.
+            Hash mHash;                 /// Hash function instance.
+
+        public:
+            using ValueType = T;
+
+        public:
+            /**
+             * @brief Constructs filter sized for expected number of keys and false positive rate.
+             * @param expectedCount Number of keys the filter is sized for.
+             * @param falsePositiveRate Probability that absent key is reported present, in (0, 1).
+             * @param hash Hash function instance.
+             * @throws std::invalid_argument if false positive rate is out of range.
+             */
+            BloomFilter(size_t expectedCount, double falsePositiveRate, const Hash& hash = Hash()) : mWords(), mBlockCount(0), mHashCount(0), mSize(0), mHash(hash)
+            {
+                if (!(falsePositiveRate > 0 && falsePositiveRate < 1))
+                    throw std::invalid_argument("False positive rate must be between 0 and 1");
+
+                // Optimal classic filter uses -ln(p) / ln(2)^2 bits and ln(2) bits per key set.
+                double bitsPerKey = -std::log(falsePositiveRate) / (std::log(2.0) * std::log(2.0));
+                double bits = std::ceil(std::max<size_t>(expectedCount, 1) * bitsPerKey * BlockingOverhead);
+
+                this->mBlockCount = std::max<size_t>(1, static_cast<size_t>(std::ceil(bits / BlockBits)));
+                this->mHashCount = std::clamp<size_t>(static_cast<size_t>(std::lround(bitsPerKey * std::log(2.0))), 1, MaxHashCount);
+                this->mWords = Words(this->mBlockCount * WordsPerBlock);
+                this->clear();
+            }
+
+            /**
+             * @brief Adds key to the filter.
+             * @param key Key to add.
+             */
+            void insert(const T& key)
+            {
+                uint64_t hash = this->hashOf(key);
+                uint64_t* block = this->mWords.getData() + this->blockOf(hash);
+                uint32_t position = static_cast<uint32_t>(hash);
+                uint32_t step = static_cast<uint32_t>(dsa::utility::mixHash(hash)) | 1;
+
+                for (size_t i = 0; i < this->mHashCount; i++, position += step)
+                {
+                    uint32_t bit = position >> 23;
+
+                    block[bit / 64] |= static_cast<uint64_t>(1) << (bit % 64);
+                }
+
+                this->mSize++;
+            }
+
+            /**
+             * @brief Checks whether key may be in the filter.
+             * @param key Key to check.
+             * @return False if key was definitely not inserted, true if it probably was.
+             */
+            bool contains(const T& key) const
+            {
+                return this->containsHash(this->hashOf(key));
+            }
+
+            /**
+             * @brief Checks batch of keys, hashing a group of keys and prefetching their blocks before testing any of them.
+             *
+             * Lookups of a large filter are dominated by cache misses on blocks. Issuing the loads of a
+             * whole group up front lets them overlap instead of waiting for each in turn.
+             *
+             * @param keys Pointer to keys.
+             * @param count Number of keys.
+             * @param results Receives result of contains() for every key.
+             * @return Number of keys reported as present.
+             */
+            size_t containsMany(const T* keys, size_t count, bool* results) const
+            {
+                uint64_t hashes[BatchSize];
+                size_t positives = 0;
+
+                for (size_t start = 0; start < count; start += BatchSize)
+                {
+                    size_t size = std::min(BatchSize, count - start);
+
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        hashes[i] = this->hashOf(keys[start + i]);
+                        dsa::utility::prefetch(this->mWords.getData() + this->blockOf(hashes[i]));
+                    }
+
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        results[start + i] = this->containsHash(hashes[i]);
+                        positives += results[start + i];
+                    }
+                }
+
+                return positives;
+            }
+
+            /**
+             * @brief Removes all keys.
+             */
+            void clear()
+            {
+                std::fill(this->mWords.getData(), this->mWords.getData() + this->mWords.getSize(), 0);
+                this->mSize = 0;
+            }
+
+            /**
+             * @brief Returns number of inserted keys, duplicates included.
+             * @return Number of keys.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns number of bits set per key.
+             * @return Number of hash functions.
+             */
+            size_t getHashCount() const
+            {
+                return this->mHashCount;
+            }
+
+            /**
+             * @brief Returns size of the filter in bits.
+             * @return Number of bits.
+             */
+            size_t getBitCount() const
+            {
+                return this->mBlockCount * BlockBits;
+            }
+
+            /**
+             * @brief Returns bits of the filter per inserted key.
+             * @return Bits per key, 0 for empty filter.
+             */
+            double getBitsPerKey() const
+            {
+                return this->mSize == 0 ? 0 : static_cast<double>(this->getBitCount()) / this->mSize;
+            }
+
+        private:
+            /**
+             * @brief Hashes key and mixes the hash.
+             */
+            uint64_t hashOf(const T& key) const
+            {
+                return dsa::utility::mixHash(static_cast<uint64_t>(this->mHash(key)));
+            }
+
+            /**
+             * @brief Maps upper half of hash to index of first word of block by multiply-shift, avoiding division.
+             */
+            size_t blockOf(uint64_t hash) const
+            {
+                return static_cast<size_t>(((hash >> 32) * this->mBlockCount) >> 32) * WordsPerBlock;
+            }
+
+            /**
+             * @brief Tests bits of hash in its block.
+             */
+            bool containsHash(uint64_t hash) const
+            {
+                const uint64_t* block = this->mWords.getData() + this->blockOf(hash);
+                uint32_t position = static_cast<uint32_t>(hash);
+                uint32_t step = static_cast<uint32_t>(dsa::utility::mixHash(hash)) | 1;
+                uint64_t missing = 0;
+
+                for (size_t i = 0; i < this->mHashCount; i++, position += step)
+                {
+                    uint32_t bit = position >> 23;
+
+                    missing |= ~block[bit / 64] & (static_cast<uint64_t>(1) << (bit % 64));
+                }
+
+                return missing == 0;
+            }
+    };
+}
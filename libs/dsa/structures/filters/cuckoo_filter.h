@@ -0,0 +1,432 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/hash.h>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::structures::filters
+{
+    /**
+     * @brief Approximate set storing short fingerprints of keys in cuckoo hash table, supports removal.
+     *
+     * Every key has fingerprint of f bits and two candidate buckets of four slots. The second bucket
+     * is derived from the first one and the fingerprint alone, so a stored fingerprint can be moved
+     * to its other bucket without knowing the key. Insert into two full buckets evicts a random
+     * fingerprint to its alternate bucket and continues with that one. Lookup reads two buckets and
+     * compares all four slots of each at once with SWAR (SIMD within a register) arithmetic.
+     *
+     * Buckets of 4f bits are packed back to back in 64-bit words, so no bits are wasted for
+     * fingerprint sizes that do not divide word size.
+     *
+     * Only keys that were inserted may be erased, erasing other key can remove fingerprint of a
+     * colliding key. Key inserted twice is stored twice and has to be erased twice.
+     *
+     * @tparam T Type of keys.
+     * @tparam Hash Hash function of keys, its result is remixed so identity hashes are fine.
+     */
+    template<typename T, typename Hash = std::hash<T>>
+    class CuckooFilter
+    {
+        public:
+            static constexpr size_t SlotsPerBucket = 4;         /// Fingerprints per bucket.
+            static constexpr size_t MinFingerprintBits = 4;     /// Smallest fingerprint size.
+            static constexpr size_t MaxFingerprintBits = 16;    /// Largest fingerprint size, bucket then fills whole word.
+            static constexpr size_t MaxKicks = 500;             /// Evictions tried before insert gives up.
+            static constexpr double TargetLoadFactor = 0.9;     /// Fraction of slots expected to be used at full size.
+            static constexpr size_t BatchSize = 16;             /// Keys hashed and prefetched ahead by containsMany().
+
+        private:
+            dsa::structures::arrays::DynamicArray<uint64_t> mWords;    /// Packed buckets followed by one padding word.
+            size_t mBucketCount;                                        /// Number of buckets.
+            size_t mFingerprintBits;                                    /// Bits per fingerprint.
+            size_t mBucketBits;                                         /// Bits per bucket.
+            uint64_t mBucketMask;                                       /// Mask of bits of one bucket.
+            uint64_t mLowBits;                                          /// Lowest bit of every slot.
+            uint64_t mHighBits;                                         /// Highest bit of every slot.
+            size_t mSize;                                               /// Number of stored fingerprints.
+            size_t mVictimIndex;                                        /// Bucket of fingerprint that did not fit.
+            uint64_t mVictim;                                           /// Fingerprint that did not fit, 0 if none.
+            uint64_t mRandom;                                           /// State of generator choosing evicted slots.
+            Hash mHash;                                                 /// Hash function instance.
+
+        public:
+            using ValueType = T;
+
+        public:
+            /**
+             * @brief Constructs filter sized for expected number of keys and false positive rate.
+             * @param expectedCount Number of keys the filter is sized for.
+             * @param falsePositiveRate Probability that absent key is reported present, in (0, 1).
+             * @param hash Hash function instance.
+             * @throws std::invalid_argument if false positive rate is out of range.
+             */
+            CuckooFilter(size_t expectedCount, double falsePositiveRate, const Hash& hash = Hash())
+                : mWords(), mBucketCount(0), mFingerprintBits(0), mBucketBits(0), mBucketMask(0), mLowBits(0), mHighBits(0),
+                  mSize(0), mVictimIndex(0), mVictim(0), mRandom(0x9E3779B97F4A7C15ULL), mHash(hash)
+            {
+                if (!(falsePositiveRate > 0 && falsePositiveRate < 1))
+                    throw std::invalid_argument("False positive rate must be between 0 and 1");
+
+                // Lookup compares against 2 * SlotsPerBucket fingerprints, each matching with probability 2^-f.
+                double bits = std::ceil(std::log2(2 * SlotsPerBucket / falsePositiveRate));
+
+                this->mFingerprintBits = std::clamp<size_t>(static_cast<size_t>(bits), MinFingerprintBits, MaxFingerprintBits);
+                this->mBucketBits = this->mFingerprintBits * SlotsPerBucket;
+                this->mBucketMask = this->mBucketBits == 64 ? ~static_cast<uint64_t>(0) : (static_cast<uint64_t>(1) << this->mBucketBits) - 1;
+
+                for (size_t slot = 0; slot < SlotsPerBucket; slot++)
+                {
+                    this->mLowBits |= static_cast<uint64_t>(1) << (slot * this->mFingerprintBits);
+                }
+
+                this->mHighBits = this->mLowBits << (this->mFingerprintBits - 1);
+                this->mBucketCount = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::max<size_t>(expectedCount, 1) / (SlotsPerBucket * TargetLoadFactor))));
+                this->mWords = dsa::structures::arrays::DynamicArray<uint64_t>((this->mBucketCount * this->mBucketBits + 63) / 64 + 1);
+            }
+
+            /**
+             * @brief Adds key to the filter.
+             * @param key Key to add.
+             * @return False if the filter is full and key was not added.
+             */
+            bool insert(const T& key)
+            {
+                if (this->mVictim != 0)
+                    return false;
+
+                uint64_t fingerprint;
+                size_t index = this->locate(key, fingerprint);
+
+                this->mSize++;
+
+                if (this->tryAdd(index, fingerprint) || this->tryAdd(this->alternate(index, fingerprint), fingerprint))
+                    return true;
+
+                for (size_t kick = 0; kick < MaxKicks; kick++)
+                {
+                    uint64_t random = this->nextRandom();
+
+                    if (kick == 0 && (random & 4) != 0)
+                        index = this->alternate(index, fingerprint);
+
+                    size_t slot = static_cast<size_t>(random % SlotsPerBucket);
+                    uint64_t evicted = this->getSlot(index, slot);
+
+                    this->setSlot(index, slot, fingerprint);
+                    fingerprint = evicted;
+                    index = this->alternate(index, fingerprint);
+
+                    if (this->tryAdd(index, fingerprint))
+                        return true;
+                }
+
+                // Last evicted fingerprint is kept aside, so the key just inserted is still found.
+                this->mVictimIndex = index;
+                this->mVictim = fingerprint;
+
+                return true;
+            }
+
+            /**
+             * @brief Checks whether key may be in the filter.
+             * @param key Key to check.
+             * @return False if key was definitely not inserted, true if it probably was.
+             */
+            bool contains(const T& key) const
+            {
+                uint64_t fingerprint;
+                size_t index = this->locate(key, fingerprint);
+
+                return this->containsFingerprint(index, this->alternate(index, fingerprint), fingerprint);
+            }
+
+            /**
+             * @brief Checks batch of keys, hashing a group of keys and prefetching both their buckets before testing any of them.
+             * @param keys Pointer to keys.
+             * @param count Number of keys.
+             * @param results Receives result of contains() for every key.
+             * @return Number of keys reported as present.
+             */
+            size_t containsMany(const T* keys, size_t count, bool* results) const
+            {
+                size_t first[BatchSize];
+                size_t second[BatchSize];
+                uint64_t fingerprints[BatchSize];
+                size_t positives = 0;
+
+                for (size_t start = 0; start < count; start += BatchSize)
+                {
+                    size_t size = std::min(BatchSize, count - start);
+
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        first[i] = this->locate(keys[start + i], fingerprints[i]);
+                        second[i] = this->alternate(first[i], fingerprints[i]);
+                        dsa::utility::prefetch(this->mWords.getData() + first[i] * this->mBucketBits / 64);
+                        dsa::utility::prefetch(this->mWords.getData() + second[i] * this->mBucketBits / 64);
+                    }
+
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        results[start + i] = this->containsFingerprint(first[i], second[i], fingerprints[i]);
+                        positives += results[start + i];
+                    }
+                }
+
+                return positives;
+            }
+
+            /**
+             * @brief Removes one copy of fingerprint of previously inserted key.
+             * @param key Key to remove.
+             * @return True if fingerprint of key was found and removed.
+             */
+            bool erase(const T& key)
+            {
+                uint64_t fingerprint;
+                size_t index = this->locate(key, fingerprint);
+                size_t alternate = this->alternate(index, fingerprint);
+
+                if (this->mVictim == fingerprint && (this->mVictimIndex == index || this->mVictimIndex == alternate))
+                {
+                    this->mVictim = 0;
+                    this->mSize--;
+                    return true;
+                }
+
+                if (!this->tryRemove(index, fingerprint) && !this->tryRemove(alternate, fingerprint))
+                    return false;
+
+                this->mSize--;
+
+                // Freed slot may give room to the fingerprint that did not fit.
+                if (this->mVictim != 0 && (this->tryAdd(this->mVictimIndex, this->mVictim) || this->tryAdd(this->alternate(this->mVictimIndex, this->mVictim), this->mVictim)))
+                    this->mVictim = 0;
+
+                return true;
+            }
+
+            /**
+             * @brief Removes all keys.
+             */
+            void clear()
+            {
+                std::fill(this->mWords.getData(), this->mWords.getData() + this->mWords.getSize(), 0);
+                this->mSize = 0;
+                this->mVictim = 0;
+            }
+
+            /**
+             * @brief Returns number of stored fingerprints.
+             * @return Number of keys.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Checks whether last insert did not fit and further inserts are refused.
+             * @return True if the filter is full.
+             */
+            bool isFull() const
+            {
+                return this->mVictim != 0;
+            }
+
+            /**
+             * @brief Returns size of fingerprints.
+             * @return Bits per fingerprint.
+             */
+            size_t getFingerprintBits() const
+            {
+                return this->mFingerprintBits;
+            }
+
+            /**
+             * @brief Returns number of buckets.
+             * @return Number of buckets.
+             */
+            size_t getBucketCount() const
+            {
+                return this->mBucketCount;
+            }
+
+            /**
+             * @brief Returns fraction of used slots.
+             * @return Load factor in [0, 1].
+             */
+            double getLoadFactor() const
+            {
+                return static_cast<double>(this->mSize) / (this->mBucketCount * SlotsPerBucket);
+            }
+
+            /**
+             * @brief Returns size of the filter in bits.
+             * @return Number of bits.
+             */
+            size_t getBitCount() const
+            {
+                return this->mBucketCount * this->mBucketBits;
+            }
+
+            /**
+             * @brief Returns bits of the filter per stored key.
+             * @return Bits per key, 0 for empty filter.
+             */
+            double getBitsPerKey() const
+            {
+                return this->mSize == 0 ? 0 : static_cast<double>(this->getBitCount()) / this->mSize;
+            }
+
+        private:
+            /**
+             * @brief Computes first bucket and nonzero fingerprint of key.
+             */
+            size_t locate(const T& key, uint64_t& fingerprint) const
+            {
+                uint64_t hash = dsa::utility::mixHash(static_cast<uint64_t>(this->mHash(key)));
+
+                fingerprint = (hash >> 32) & ((static_cast<uint64_t>(1) << this->mFingerprintBits) - 1);
+                fingerprint += fingerprint == 0;
+
+                return static_cast<size_t>(((hash & 0xFFFFFFFF) * this->mBucketCount) >> 32);
+            }
+
+            /**
+             * @brief Gets the other bucket of fingerprint, alternate(alternate(i)) == i for any bucket count.
+             */
+            size_t alternate(size_t index, uint64_t fingerprint) const
+            {
+                size_t offset = static_cast<size_t>(((dsa::utility::mixHash(fingerprint) & 0xFFFFFFFF) * this->mBucketCount) >> 32);
+
+                return offset >= index ? offset - index : offset + this->mBucketCount - index;
+            }
+
+            /**
+             * @brief Reads packed bucket, which may span two words.
+             */
+            uint64_t getBucket(size_t index) const
+            {
+                size_t offset = index * this->mBucketBits;
+                size_t shift = offset % 64;
+                const uint64_t* words = this->mWords.getData() + offset / 64;
+                uint64_t bucket = words[0] >> shift;
+
+                if (shift + this->mBucketBits > 64)
+                    bucket |= words[1] << (64 - shift);
+
+                return bucket & this->mBucketMask;
+            }
+
+            /**
+             * @brief Writes packed bucket.
+             */
+            void setBucket(size_t index, uint64_t bucket)
+            {
+                size_t offset = index * this->mBucketBits;
+                size_t shift = offset % 64;
+                uint64_t* words = this->mWords.getData() + offset / 64;
+
+                words[0] = (words[0] & ~(this->mBucketMask << shift)) | (bucket << shift);
+
+                if (shift + this->mBucketBits > 64)
+                {
+                    uint64_t highMask = this->mBucketMask >> (64 - shift);
+
+                    words[1] = (words[1] & ~highMask) | (bucket >> (64 - shift));
+                }
+            }
+
+            /**
+             * @brief Reads fingerprint of slot.
+             */
+            uint64_t getSlot(size_t index, size_t slot) const
+            {
+                return (this->getBucket(index) >> (slot * this->mFingerprintBits)) & ((static_cast<uint64_t>(1) << this->mFingerprintBits) - 1);
+            }
+
+            /**
+             * @brief Writes fingerprint of slot.
+             */
+            void setSlot(size_t index, size_t slot, uint64_t fingerprint)
+            {
+                uint64_t mask = ((static_cast<uint64_t>(1) << this->mFingerprintBits) - 1) << (slot * this->mFingerprintBits);
+
+                this->setBucket(index, (this->getBucket(index) & ~mask) | (fingerprint << (slot * this->mFingerprintBits)));
+            }
+
+            /**
+             * @brief Checks all slots of bucket for fingerprint at once: slot equal to fingerprint becomes zero after xor.
+             */
+            bool hasFingerprint(uint64_t bucket, uint64_t fingerprint) const
+            {
+                uint64_t difference = bucket ^ (fingerprint * this->mLowBits);
+
+                return ((difference - this->mLowBits) & ~difference & this->mHighBits) != 0;
+            }
+
+            /**
+             * @brief Checks both buckets and the fingerprint kept aside.
+             */
+            bool containsFingerprint(size_t first, size_t second, uint64_t fingerprint) const
+            {
+                return this->hasFingerprint(this->getBucket(first), fingerprint) || this->hasFingerprint(this->getBucket(second), fingerprint)
+                    || (this->mVictim == fingerprint && (this->mVictimIndex == first || this->mVictimIndex == second));
+            }
+
+            /**
+             * @brief Stores fingerprint in empty slot of bucket.
+             * @return False if bucket is full.
+             */
+            bool tryAdd(size_t index, uint64_t fingerprint)
+            {
+                for (size_t slot = 0; slot < SlotsPerBucket; slot++)
+                {
+                    if (this->getSlot(index, slot) == 0)
+                    {
+                        this->setSlot(index, slot, fingerprint);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            /**
+             * @brief Clears one slot of bucket holding fingerprint.
+             * @return False if bucket does not hold fingerprint.
+             */
+            bool tryRemove(size_t index, uint64_t fingerprint)
+            {
+                for (size_t slot = 0; slot < SlotsPerBucket; slot++)
+                {
+                    if (this->getSlot(index, slot) == fingerprint)
+                    {
+                        this->setSlot(index, slot, 0);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            /**
+             * @brief Advances xorshift generator.
+             */
+            uint64_t nextRandom()
+            {
+                this->mRandom ^= this->mRandom << 13;
+                this->mRandom ^= this->mRandom >> 7;
+                this->mRandom ^= this->mRandom << 17;
+
+                return this->mRandom;
+            }
+    };
+}
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <dsa/algorithms/numeric/scan.h>
+#include <dsa/algorithms/sorting/pdq_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/allocation_policy.h>
+#include <dsa/utility/parallel.h>
+
+namespace dsa::structures::graphs
+{
+    /**
+     * @brief Array for per-vertex and per-edge data of large graphs, backed by huge pages touched in parallel.
+     * @tparam T Type of elements.
+     */
+    template<typename T>
+    using GraphArray = dsa::structures::arrays::DynamicArray<T, dsa::utility::HugePageAllocationPolicy<T, true>>;
+
+    /**
+     * @brief Immutable directed graph in compressed sparse row format.
+     *
+     * Targets of all edges are stored in one array grouped by source vertex, and offsets[v] is the
+     * index of the first edge of vertex v, so neighbours of v are targets[offsets[v]] up to
+     * targets[offsets[v + 1]]. Graph of E edges takes 4 bytes per edge and 8 bytes per vertex and
+     * traversing neighbours is a sequential read, compared to a node and pointer per edge in
+     * adjacency lists.
+     *
+     * Graph is built from edge list in parallel: degrees are counted with atomic increments, turned
+     * into offsets by parallel exclusive scan, edges are scattered to their slots and every
+     * adjacency list is sorted.
+     */
+    class CsrGraph
+    {
+        public:
+            using VertexType = uint32_t;
+            using EdgeType = std::pair<uint32_t, uint32_t>;
+
+            static constexpr size_t ParallelMinimum = 1 << 16;     /// Minimal number of edges or vertices per thread.
+
+        private:
+            GraphArray<uint64_t> mOffsets;      /// Index of first edge of every vertex, followed by number of edges.
+            GraphArray<uint32_t> mTargets;      /// Targets of edges grouped by source.
+            size_t mVertexCount;                /// Number of vertices.
+            bool mIsUndirected;                 /// True if every edge is stored in both directions.
+
+        public:
+            /**
+             * @brief Default constructor. Initializes graph without vertices.
+             */
+            CsrGraph() : mOffsets(1), mTargets(), mVertexCount(0), mIsUndirected(false) {}
+
+            /**
+             * @brief Builds graph from edge list.
+             * @param vertexCount Number of vertices, vertices are numbered from 0.
+             * @param edges Pointer to edges as (source, target) pairs.
+             * @param edgeCount Number of edges.
+             * @param undirected Whether to store every edge also in reverse direction.
+             * @param threadCount Number of threads, 0 for hardware concurrency.
+             * @throws std::out_of_range if an edge references vertex out of range.
+             */
+            CsrGraph(size_t vertexCount, const EdgeType* edges, size_t edgeCount, bool undirected = false, size_t threadCount = 0)
+                : mOffsets(vertexCount + 1), mTargets(undirected ? 2 * edgeCount : edgeCount), mVertexCount(vertexCount), mIsUndirected(undirected)
+            {
+                if (vertexCount > UINT32_MAX)
+                    throw std::out_of_range("Number of vertices exceeds vertex type");
+
+                size_t edgeChunks = dsa::utility::getChunkCount(edgeCount, threadCount, ParallelMinimum);
+                size_t vertexChunks = dsa::utility::getChunkCount(vertexCount, threadCount, ParallelMinimum);
+                GraphArray<std::atomic<uint64_t>> counters(vertexCount);
+                std::atomic<uint64_t>* cursors = counters.getData();
+                std::atomic<bool> isInvalid(false);
+
+                // Locked increment drains store buffer on x86, which serializes cache misses of scattered
+                // stores, so a single chunk owning all cursors increments them without read-modify-write.
+                auto claim = [cursors, isShared = edgeChunks > 1](uint32_t vertex)
+                {
+                    if (isShared)
+                        return cursors[vertex].fetch_add(1, std::memory_order_relaxed);
+
+                    uint64_t cursor = cursors[vertex].load(std::memory_order_relaxed);
+                    cursors[vertex].store(cursor + 1, std::memory_order_relaxed);
+                    return cursor;
+                };
+
+                dsa::utility::parallelFor(edgeCount, edgeChunks, [&](size_t begin, size_t end, size_t)
+                {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        if (edges[i].first >= vertexCount || edges[i].second >= vertexCount)
+                        {
+                            isInvalid.store(true, std::memory_order_relaxed);
+                            return;
+                        }
+
+                        claim(edges[i].first);
+
+                        if (undirected)
+                            claim(edges[i].second);
+                    }
+                });
+
+                if (isInvalid.load())
+                    throw std::out_of_range("Edge references vertex out of graph");
+
+                uint64_t* offsets = this->mOffsets.getData();
+
+                dsa::utility::parallelFor(vertexCount, vertexChunks, [&](size_t begin, size_t end, size_t)
+                {
+                    for (size_t v = begin; v < end; v++)
+                    {
+                        offsets[v] = cursors[v].load(std::memory_order_relaxed);
+                    }
+                });
+
+                dsa::algorithms::numeric::parallelExclusiveScan(offsets, vertexCount + 1, offsets, static_cast<uint64_t>(0), std::plus<uint64_t>(), threadCount);
+
+                dsa::utility::parallelFor(vertexCount, vertexChunks, [&](size_t begin, size_t end, size_t)
+                {
+                    for (size_t v = begin; v < end; v++)
+                    {
+                        cursors[v].store(offsets[v], std::memory_order_relaxed);
+                    }
+                });
+
+                uint32_t* targets = this->mTargets.getData();
+
+                dsa::utility::parallelFor(edgeCount, edgeChunks, [&](size_t begin, size_t end, size_t)
+                {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        targets[claim(edges[i].first)] = edges[i].second;
+
+                        if (undirected)
+                            targets[claim(edges[i].second)] = edges[i].first;
+                    }
+                });
+
+                // Order of scattered edges depends on thread timing, sorting makes layout deterministic.
+                dsa::utility::parallelFor(vertexCount, vertexChunks, [&](size_t begin, size_t end, size_t)
+                {
+                    for (size_t v = begin; v < end; v++)
+                    {
+                        dsa::algorithms::sorting::pdqSort(targets + offsets[v], targets + offsets[v + 1]);
+                    }
+                });
+            }
+
+            /**
+             * @brief Builds graph from edge list.
+             * @param vertexCount Number of vertices, vertices are numbered from 0.
+             * @param edges Array of edges as (source, target) pairs.
+             * @param undirected Whether to store every edge also in reverse direction.
+             * @param threadCount Number of threads, 0 for hardware concurrency.
+             * @throws std::out_of_range if an edge references vertex out of range.
+             */
+            template<typename AllocationPolicy>
+            CsrGraph(size_t vertexCount, const dsa::structures::arrays::DynamicArray<EdgeType, AllocationPolicy>& edges, bool undirected = false, size_t threadCount = 0)
+                : CsrGraph(vertexCount, edges.getData(), edges.getSize(), undirected, threadCount) {}
+
+            /**
+             * @brief Creates graph with every edge reversed, needed for pulling from in-neighbours in directed graphs.
+             * @param threadCount Number of threads, 0 for hardware concurrency.
+             * @return Transposed graph.
+             */
+            CsrGraph transpose(size_t threadCount = 0) const
+            {
+                if (this->mIsUndirected)
+                    return *this;
+
+                GraphArray<EdgeType> edges(this->getEdgeCount());
+                EdgeType* reversed = edges.getData();
+                const uint64_t* offsets = this->mOffsets.getData();
+                const uint32_t* targets = this->mTargets.getData();
+
+                dsa::utility::parallelFor(this->mVertexCount, dsa::utility::getChunkCount(this->mVertexCount, threadCount, ParallelMinimum), [&](size_t begin, size_t end, size_t)
+                {
+                    for (size_t v = begin; v < end; v++)
+                    {
+                        for (uint64_t e = offsets[v]; e < offsets[v + 1]; e++)
+                        {
+                            reversed[e] = EdgeType(targets[e], static_cast<uint32_t>(v));
+                        }
+                    }
+                });
+
+                return CsrGraph(this->mVertexCount, reversed, edges.getSize(), false, threadCount);
+            }
+
+            /**
+             * @brief Returns the number of vertices.
+             * @return Number of vertices.
+             */
+            size_t getVertexCount() const
+            {
+                return this->mVertexCount;
+            }
+
+            /**
+             * @brief Returns the number of stored edges, undirected edges count twice.
+             * @return Number of edges.
+             */
+            size_t getEdgeCount() const
+            {
+                return this->mTargets.getSize();
+            }
+
+            /**
+             * @brief Checks whether every edge is stored in both directions.
+             * @return True if graph was built as undirected.
+             */
+            bool isUndirected() const
+            {
+                return this->mIsUndirected;
+            }
+
+            /**
+             * @brief Returns number of outgoing edges of vertex.
+             * @param vertex Index of vertex.
+             * @return Out-degree.
+             * @throws std::out_of_range if vertex is out of graph.
+             */
+            size_t getDegree(size_t vertex) const
+            {
+                if (vertex >= this->mVertexCount)
+                    throw std::out_of_range("Vertex out of graph");
+
+                return static_cast<size_t>(this->mOffsets.getData()[vertex + 1] - this->mOffsets.getData()[vertex]);
+            }
+
+            /**
+             * @brief Returns sorted targets of outgoing edges of vertex, getDegree() elements long.
+             * @param vertex Index of vertex.
+             * @return Pointer to first target.
+             * @throws std::out_of_range if vertex is out of graph.
+             */
+            const uint32_t* getNeighbors(size_t vertex) const
+            {
+                if (vertex >= this->mVertexCount)
+                    throw std::out_of_range("Vertex out of graph");
+
+                return this->mTargets.getData() + this->mOffsets.getData()[vertex];
+            }
+
+            /**
+             * @brief Returns offsets array of getVertexCount() + 1 elements.
+             * @return Pointer to first offset.
+             */
+            const uint64_t* getOffsets() const
+            {
+                return this->mOffsets.getData();
+            }
+
+            /**
+             * @brief Returns targets array of getEdgeCount() elements.
+             * @return Pointer to first target.
+             */
+            const uint32_t* getTargets() const
+            {
+                return this->mTargets.getData();
+            }
+
+            /**
+             * @brief Returns size of offsets and targets.
+             * @return Number of bytes.
+             */
+            size_t getMemoryBytes() const
+            {
+                return this->mOffsets.getSize() * sizeof(uint64_t) + this->mTargets.getSize() * sizeof(uint32_t);
+            }
+    };
+}
@@ -0,0 +1,324 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <dsa/algorithms/numeric/matrix_multiply.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/allocation_policy.h>
+
+namespace dsa::structures::matrices
+{
+    /**
+     * @brief Dense matrix with size chosen at runtime, elements stored row-major in one contiguous buffer.
+     *
+     * Element (row, column) lives at index row * columns + column, so walking a row is sequential
+     * and the whole matrix is one allocation, unlike array of row arrays where every row is reached
+     * through its own pointer. Buffer starts at cache line boundary.
+     *
+     * @tparam T Type of elements.
+     */
+    template<typename T>
+    class Matrix
+    {
+        private:
+            using Storage = dsa::structures::arrays::DynamicArray<T,
+                dsa::utility::AlignedAllocationPolicy<T, std::max(alignof(T), dsa::utility::CacheLineSize)>>;
+
+            Storage mElements;      /// Row-major elements.
+            size_t mRows;           /// Number of rows.
+            size_t mColumns;        /// Number of columns.
+
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using ConstReferenceType = const T&;
+            using PointerType = T*;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty 0x0 matrix.
+             */
+            Matrix() : mElements(), mRows(0), mColumns(0) {}
+
+            /**
+             * @brief Constructs matrix of value-initialized elements.
+             * @param rows Number of rows.
+             * @param columns Number of columns.
+             */
+            Matrix(size_t rows, size_t columns) : mElements(rows * columns), mRows(rows), mColumns(columns) {}
+
+            /**
+             * @brief Constructs matrix from list of rows.
+             * @param rows Initializer list of rows, all of the same length.
+             * @throws std::runtime_error if rows differ in length.
+             */
+            Matrix(std::initializer_list<std::initializer_list<T>> rows)
+                : mElements(rows.size() * (rows.size() != 0 ? rows.begin()->size() : 0)), mRows(rows.size()), mColumns(rows.size() != 0 ? rows.begin()->size() : 0)
+            {
+                size_t index = 0;
+
+                for (const std::initializer_list<T>& row : rows)
+                {
+                    if (row.size() != this->mColumns)
+                        throw std::runtime_error("Rows of matrix must have the same length");
+
+                    for (const T& value : row)
+                    {
+                        this->mElements[index++] = value;
+                    }
+                }
+            }
+
+            /**
+             * @brief Creates identity matrix.
+             * @param size Number of rows and columns.
+             * @return Matrix with ones on diagonal and zeros elsewhere.
+             */
+            static Matrix<T> identity(size_t size)
+            {
+                Matrix<T> result(size, size);
+
+                for (size_t i = 0; i < size; i++)
+                {
+                    result.mElements[i * size + i] = T(1);
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Returns a reference to the element at given position.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Reference to the element.
+             * @throws std::out_of_range if position is out of bounds.
+             */
+            ReferenceType get(const size_t row, const size_t column)
+            {
+                if (row >= this->mRows || column >= this->mColumns)
+                    throw std::out_of_range("Index out of matrix bounds");
+
+                return this->mElements.getData()[row * this->mColumns + column];
+            }
+
+            /**
+             * @brief Returns a const reference to the element at given position.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Const reference to the element.
+             * @throws std::out_of_range if position is out of bounds.
+             */
+            ConstReferenceType get(const size_t row, const size_t column) const
+            {
+                if (row >= this->mRows || column >= this->mColumns)
+                    throw std::out_of_range("Index out of matrix bounds");
+
+                return this->mElements.getData()[row * this->mColumns + column];
+            }
+
+            /**
+             * @brief Element access operator.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Reference to the element.
+             */
+            ReferenceType operator()(const size_t row, const size_t column)
+            {
+                return this->get(row, column);
+            }
+
+            /**
+             * @brief Element access operator (const version).
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Const reference to the element.
+             */
+            ConstReferenceType operator()(const size_t row, const size_t column) const
+            {
+                return this->get(row, column);
+            }
+
+            /**
+             * @brief Sets the value at given position.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @param value Value to assign.
+             * @throws std::out_of_range if position is out of bounds.
+             */
+            void set(size_t row, size_t column, ValueType value)
+            {
+                this->get(row, column) = std::move(value);
+            }
+
+            /**
+             * @brief Returns the number of rows.
+             * @return Number of rows.
+             */
+            size_t getRows() const
+            {
+                return this->mRows;
+            }
+
+            /**
+             * @brief Returns the number of columns.
+             * @return Number of columns.
+             */
+            size_t getColumns() const
+            {
+                return this->mColumns;
+            }
+
+            /**
+             * @brief Returns the number of elements.
+             * @return Rows times columns.
+             */
+            size_t getSize() const
+            {
+                return this->mElements.getSize();
+            }
+
+            /**
+             * @brief Returns pointer to row-major elements.
+             * @return Pointer to first element.
+             */
+            PointerType getData()
+            {
+                return this->mElements.getData();
+            }
+
+            /**
+             * @brief Returns const pointer to row-major elements.
+             * @return Const pointer to first element.
+             */
+            const ValueType* getData() const
+            {
+                return this->mElements.getData();
+            }
+
+            /**
+             * @brief Returns pointer to first element of row, columns of row follow contiguously.
+             * @param row Index of row.
+             * @return Pointer to row.
+             * @throws std::out_of_range if row is out of bounds.
+             */
+            PointerType getRow(size_t row)
+            {
+                if (row >= this->mRows)
+                    throw std::out_of_range("Index out of matrix bounds");
+
+                return this->mElements.getData() + row * this->mColumns;
+            }
+
+            /**
+             * @brief Returns const pointer to first element of row.
+             * @param row Index of row.
+             * @return Const pointer to row.
+             * @throws std::out_of_range if row is out of bounds.
+             */
+            const ValueType* getRow(size_t row) const
+            {
+                if (row >= this->mRows)
+                    throw std::out_of_range("Index out of matrix bounds");
+
+                return this->mElements.getData() + row * this->mColumns;
+            }
+
+            /**
+             * @brief Sets all elements to value.
+             * @param value Value to assign.
+             */
+            void fill(const ValueType& value)
+            {
+                std::fill(this->getData(), this->getData() + this->getSize(), value);
+            }
+
+            /**
+             * @brief Creates transposed matrix by blocked transpose.
+             * @return Matrix of columns x rows elements.
+             */
+            Matrix<T> transpose() const
+            {
+                Matrix<T> result(this->mColumns, this->mRows);
+
+                dsa::algorithms::numeric::transpose(this->getData(), this->mRows, this->mColumns, result.getData());
+
+                return result;
+            }
+
+            /**
+             * @brief Multiplies matrices by cache-blocked kernel, large products use all hardware threads.
+             * @param other Right operand with as many rows as this matrix has columns.
+             * @param threadCount Number of threads, 0 for hardware concurrency, 1 for sequential multiply.
+             * @return Matrix product of rows x other.columns elements.
+             * @throws std::runtime_error if dimensions do not match.
+             */
+            Matrix<T> multiply(const Matrix<T>& other, size_t threadCount = 0) const
+            {
+                if (this->mColumns != other.mRows)
+                    throw std::runtime_error("Matrix dimensions do not match");
+
+                Matrix<T> result(this->mRows, other.mColumns);
+
+                dsa::algorithms::numeric::parallelMultiply(this->getData(), other.getData(), result.getData(),
+                    this->mRows, this->mColumns, other.mColumns, threadCount);
+
+                return result;
+            }
+
+            /**
+             * @brief Matrix multiplication operator, see multiply().
+             * @param other Right operand.
+             * @return Matrix product.
+             * @throws std::runtime_error if dimensions do not match.
+             */
+            Matrix<T> operator*(const Matrix<T>& other) const
+            {
+                return this->multiply(other);
+            }
+
+            /**
+             * @brief Compares dimensions and elements of matrices.
+             * @param other Matrix to compare with.
+             * @return True if matrices are equal.
+             */
+            bool operator==(const Matrix<T>& other) const
+            {
+                return this->mRows == other.mRows && this->mColumns == other.mColumns
+                    && std::equal(this->getData(), this->getData() + this->getSize(), other.getData());
+            }
+
+            /**
+             * @brief Compares dimensions and elements of matrices.
+             * @param other Matrix to compare with.
+             * @return True if matrices differ.
+             */
+            bool operator!=(const Matrix<T>& other) const
+            {
+                return !(*this == other);
+            }
+
+            /**
+             * @brief Outputs the matrix to a stream, one row per line.
+             * @param os Output stream.
+             * @param matrix The Matrix to output.
+             * @return Reference to the output stream.
+             */
+            friend std::ostream& operator<<(std::ostream& os, const Matrix<T>& matrix)
+            {
+                for (size_t i = 0; i < matrix.mRows; i++)
+                {
+                    for (size_t j = 0; j < matrix.mColumns; j++)
+                    {
+                        os << (j == 0 ? "" : " ") << matrix.getData()[i * matrix.mColumns + j];
+                    }
+
+                    os << std::endl;
+                }
+
+                return os;
+            }
+    };
+}
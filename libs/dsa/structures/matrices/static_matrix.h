@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <dsa/algorithms/numeric/matrix_multiply.h>
+#include <dsa/structures/arrays/static_array.h>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::structures::matrices
+{
+    /**
+     * @brief Dense matrix with dimensions fixed at compile time, elements stored row-major inline.
+     *
+     * Dimensions are part of the type, so product of mismatched matrices does not compile. Matrix
+     * can be built, multiplied and transposed in constant expressions, at runtime the same kernels
+     * as Matrix are used.
+     *
+     * @tparam T Type of elements.
+     * @tparam R Number of rows.
+     * @tparam C Number of columns.
+     */
+    template<typename T, size_t R, size_t C>
+    class StaticMatrix
+    {
+        private:
+            dsa::structures::arrays::StaticArray<T, R * C> mElements;     /// Row-major elements.
+
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using ConstReferenceType = const T&;
+            using PointerType = T*;
+
+        public:
+            /**
+             * @brief Default constructor. Value initializes all elements.
+             */
+            constexpr StaticMatrix() : mElements() {}
+
+            /**
+             * @brief Constructs matrix from list of rows.
+             * @param rows Initializer list of R rows of C elements.
+             * @throws std::runtime_error if list does not match dimensions.
+             */
+            constexpr StaticMatrix(std::initializer_list<std::initializer_list<T>> rows) : mElements()
+            {
+                if (rows.size() != R)
+                    throw std::runtime_error("Entered matrix size does not match template parameter size");
+
+                size_t index = 0;
+
+                for (const std::initializer_list<T>& row : rows)
+                {
+                    if (row.size() != C)
+                        throw std::runtime_error("Entered matrix size does not match template parameter size");
+
+                    for (const T& value : row)
+                    {
+                        this->mElements.getData()[index++] = value;
+                    }
+                }
+            }
+
+            /**
+             * @brief Creates identity matrix.
+             * @return Matrix with ones on diagonal and zeros elsewhere.
+             */
+            static constexpr StaticMatrix<T, R, C> identity()
+            {
+                static_assert(R == C, "Identity matrix must be square");
+
+                StaticMatrix<T, R, C> result;
+
+                for (size_t i = 0; i < R; i++)
+                {
+                    result.mElements.getData()[i * C + i] = T(1);
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Returns a reference to the element at given position.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Reference to the element.
+             * @throws std::out_of_range if position is out of bounds.
+             */
+            constexpr ReferenceType get(const size_t row, const size_t column)
+            {
+                if (row >= R || column >= C)
+                    throw std::out_of_range("Index out of matrix bounds");
+
+                return this->mElements.getData()[row * C + column];
+            }
+
+            /**
+             * @brief Returns a const reference to the element at given position.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Const reference to the element.
+             * @throws std::out_of_range if position is out of bounds.
+             */
+            constexpr ConstReferenceType get(const size_t row, const size_t column) const
+            {
+                if (row >= R || column >= C)
+                    throw std::out_of_range("Index out of matrix bounds");
+
+                return this->mElements.getData()[row * C + column];
+            }
+
+            /**
+             * @brief Element access operator.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Reference to the element.
+             */
+            constexpr ReferenceType operator()(const size_t row, const size_t column)
+            {
+                return this->get(row, column);
+            }
+
+            /**
+             * @brief Element access operator (const version).
+             * @param row Index of row.
+             * @param column Index of column.
+             * @return Const reference to the element.
+             */
+            constexpr ConstReferenceType operator()(const size_t row, const size_t column) const
+            {
+                return this->get(row, column);
+            }
+
+            /**
+             * @brief Sets the value at given position.
+             * @param row Index of row.
+             * @param column Index of column.
+             * @param value Value to assign.
+             * @throws std::out_of_range if position is out of bounds.
+             */
+            constexpr void set(size_t row, size_t column, ValueType value)
+            {
+                this->get(row, column) = std::move(value);
+            }
+
+            /**
+             * @brief Returns the number of rows.
+             * @return Number of rows R.
+             */
+            static constexpr size_t getRows()
+            {
+                return R;
+            }
+
+            /**
+             * @brief Returns the number of columns.
+             * @return Number of columns C.
+             */
+            static constexpr size_t getColumns()
+            {
+                return C;
+            }
+
+            /**
+             * @brief Returns the number of elements.
+             * @return R times C.
+             */
+            static constexpr size_t getSize()
+            {
+                return R * C;
+            }
+
+            /**
+             * @brief Returns pointer to row-major elements.
+             * @return Pointer to first element.
+             */
+            constexpr PointerType getData()
+            {
+                return this->mElements.getData();
+            }
+
+            /**
+             * @brief Returns const pointer to row-major elements.
+             * @return Const pointer to first element.
+             */
+            constexpr const ValueType* getData() const
+            {
+                return this->mElements.getData();
+            }
+
+            /**
+             * @brief Creates transposed matrix.
+             * @return Matrix of C x R elements.
+             */
+            constexpr StaticMatrix<T, C, R> transpose() const
+            {
+                StaticMatrix<T, C, R> result;
+
+                if (dsa::utility::isConstantEvaluated())
+                {
+                    for (size_t i = 0; i < R; i++)
+                    {
+                        for (size_t j = 0; j < C; j++)
+                        {
+                            result.getData()[j * R + i] = this->getData()[i * C + j];
+                        }
+                    }
+                }
+                else
+                {
+                    dsa::algorithms::numeric::transpose(this->getData(), R, C, result.getData());
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Matrix multiplication operator, inner dimensions are checked by type.
+             * @tparam N Number of columns of right operand.
+             * @param other Right operand of C x N elements.
+             * @return Matrix product of R x N elements.
+             */
+            template<size_t N>
+            constexpr StaticMatrix<T, R, N> operator*(const StaticMatrix<T, C, N>& other) const
+            {
+                StaticMatrix<T, R, N> result;
+
+                if (dsa::utility::isConstantEvaluated())
+                {
+                    for (size_t i = 0; i < R; i++)
+                    {
+                        for (size_t p = 0; p < C; p++)
+                        {
+                            for (size_t j = 0; j < N; j++)
+                            {
+                                result.getData()[i * N + j] += this->getData()[i * C + p] * other.getData()[p * N + j];
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    dsa::algorithms::numeric::multiply(this->getData(), other.getData(), result.getData(), R, C, N);
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Compares elements of matrices.
+             * @param other Matrix to compare with.
+             * @return True if matrices are equal.
+             */
+            constexpr bool operator==(const StaticMatrix<T, R, C>& other) const
+            {
+                for (size_t i = 0; i < R * C; i++)
+                {
+                    if (!(this->getData()[i] == other.getData()[i]))
+                        return false;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Compares elements of matrices.
+             * @param other Matrix to compare with.
+             * @return True if matrices differ.
+             */
+            constexpr bool operator!=(const StaticMatrix<T, R, C>& other) const
+            {
+                return !(*this == other);
+            }
+
+            /**
+             * @brief Outputs the matrix to a stream, one row per line.
+             * @param os Output stream.
+             * @param matrix The StaticMatrix to output.
+             * @return Reference to the output stream.
+             */
+            friend std::ostream& operator<<(std::ostream& os, const StaticMatrix<T, R, C>& matrix)
+            {
+                for (size_t i = 0; i < R; i++)
+                {
+                    for (size_t j = 0; j < C; j++)
+                    {
+                        os << (j == 0 ? "" : " ") << matrix.getData()[i * C + j];
+                    }
+
+                    os << std::endl;
+                }
+
+                return os;
+            }
+    };
+}
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+
+namespace dsa::structures::queues
+{
+    /**
+     * @brief Priority queue with index tracking, allowing priorities of queued elements to change.
+     *
+     * Every element is identified by an index in range [0, maxIndex). The heap stores only indices,
+     * priorities are kept in separate array indexed by element index and heap positions of every
+     * index are tracked, so decreaseKey, update and remove run in O(log n).
+     * Ordering follows PriorityQueue, with default std::less the smallest priority is on top.
+     *
+     * @tparam T Type of priorities.
+     * @tparam Compare Comparator, returns true if first argument has higher priority.
+     * @tparam Arity Number of children of each heap node.
+     */
+    template<typename T, typename Compare = std::less<T>, size_t Arity = 2>
+    class IndexedPriorityQueue
+    {
+        static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+        public:
+            using ValueType = T;
+            using ConstReferenceType = const T&;
+            using CompareType = Compare;
+
+            static constexpr size_t NotPresent = static_cast<size_t>(-1);      /// Position of indices that are not queued.
+
+        private:
+            dsa::structures::arrays::DynamicArray<size_t> mHeap;       /// Element indices in heap order.
+            dsa::structures::arrays::DynamicArray<size_t> mPositions;  /// Heap position of every element index.
+            dsa::structures::arrays::DynamicArray<T> mValues;          /// Priority of every element index.
+            size_t mSize;                                               /// Number of queued elements.
+            Compare mCompare;                                           /// Comparator instance.
+
+        public:
+            /**
+             * @brief Constructs an empty queue for element indices in range [0, maxIndex).
+             * @param maxIndex Upper bound (exclusive) of element indices.
+             * @param compare Comparator instance.
+             */
+            explicit IndexedPriorityQueue(size_t maxIndex, const Compare& compare = Compare())
+                : mHeap(maxIndex), mPositions(maxIndex), mValues(maxIndex), mSize(0), mCompare(compare)
+            {
+                size_t* positions = this->mPositions.getData();
+
+                for (size_t i = 0; i < maxIndex; i++)
+                {
+                    positions[i] = NotPresent;
+                }
+            }
+
+            /**
+             * @brief Checks whether element index is queued.
+             * @param index Element index.
+             * @return True if index is in the queue.
+             * @throws std::out_of_range if index is out of bounds.
+             */
+            bool contains(size_t index) const
+            {
+                return this->mPositions.get(index) != NotPresent;
+            }
+
+            /**
+             * @brief Inserts element index with given priority.
+             * @param index Element index.
+             * @param value Priority of element.
+             * @throws std::out_of_range if index is out of bounds.
+             * @throws std::runtime_error if index is already in the queue.
+             */
+            void push(size_t index, ValueType value)
+            {
+                if (this->contains(index))
+                    throw std::runtime_error("Index is already present in queue");
+
+                this->mValues.getData()[index] = std::move(value);
+                this->mSize++;
+                this->siftUp(this->mSize - 1, index);
+            }
+
+            /**
+             * @brief Returns priority of queued element.
+             * @param index Element index.
+             * @return Const reference to priority.
+             * @throws std::out_of_range if index is out of bounds.
+             * @throws std::runtime_error if index is not in the queue.
+             */
+            ConstReferenceType getPriority(size_t index) const
+            {
+                if (!this->contains(index))
+                    throw std::runtime_error("Index is not present in queue");
+
+                return this->mValues.getData()[index];
+            }
+
+            /**
+             * @brief Moves queued element closer to the top by assigning it higher priority.
+             * @param index Element index.
+             * @param value New priority, must not compare after current priority.
+             * @throws std::out_of_range if index is out of bounds.
+             * @throws std::runtime_error if index is not in the queue.
+             * @throws std::invalid_argument if new priority is lower than current priority.
+             */
+            void decreaseKey(size_t index, ValueType value)
+            {
+                if (!this->contains(index))
+                    throw std::runtime_error("Index is not present in queue");
+
+                if (this->mCompare(this->mValues.getData()[index], value))
+                    throw std::invalid_argument("New priority is lower than current priority");
+
+                this->mValues.getData()[index] = std::move(value);
+                this->siftUp(this->mPositions.getData()[index], index);
+            }
+
+            /**
+             * @brief Changes priority of queued element in any direction.
+             * @param index Element index.
+             * @param value New priority.
+             * @throws std::out_of_range if index is out of bounds.
+             * @throws std::runtime_error if index is not in the queue.
+             */
+            void update(size_t index, ValueType value)
+            {
+                if (!this->contains(index))
+                    throw std::runtime_error("Index is not present in queue");
+
+                this->mValues.getData()[index] = std::move(value);
+
+                size_t position = this->mPositions.getData()[index];
+
+                this->siftUp(position, index);
+                this->siftDown(this->mPositions.getData()[index], index);
+            }
+
+            /**
+             * @brief Returns priority of the top element.
+             * @return Const reference to the top priority.
+             * @throws std::runtime_error if the queue is empty.
+             */
+            ConstReferenceType top() const
+            {
+                return this->mValues.getData()[this->topIndex()];
+            }
+
+            /**
+             * @brief Returns index of the top element.
+             * @return Element index with highest priority.
+             * @throws std::runtime_error if the queue is empty.
+             */
+            size_t topIndex() const
+            {
+                if (this->mSize == 0)
+                    throw std::runtime_error("Cannot access item when no item is present in queue");
+
+                return this->mHeap.getData()[0];
+            }
+
+            /**
+             * @brief Removes the top element.
+             * @throws std::runtime_error if the queue is empty.
+             */
+            void pop()
+            {
+                this->remove(this->topIndex());
+            }
+
+            /**
+             * @brief Removes element index from the queue.
+             * @param index Element index.
+             * @throws std::out_of_range if index is out of bounds.
+             * @throws std::runtime_error if index is not in the queue.
+             */
+            void remove(size_t index)
+            {
+                if (!this->contains(index))
+                    throw std::runtime_error("Index is not present in queue");
+
+                size_t* heap = this->mHeap.getData();
+                size_t* positions = this->mPositions.getData();
+                size_t position = positions[index];
+
+                positions[index] = NotPresent;
+                this->mSize--;
+
+                // Priority of removed index is unreachable, reset it so it does not keep resources alive.
+                if constexpr (!std::is_trivially_copyable_v<T>)
+                    this->mValues.getData()[index] = T();
+
+                if (position == this->mSize)
+                    return;
+
+                size_t moved = heap[this->mSize];
+
+                this->siftUp(position, moved);
+                this->siftDown(positions[moved], moved);
+            }
+
+            /**
+             * @brief Returns the number of queued elements.
+             * @return Number of elements.
+             */
+            constexpr size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns upper bound (exclusive) of element indices.
+             * @return Maximum number of elements.
+             */
+            size_t getMaxIndex() const
+            {
+                return this->mPositions.getSize();
+            }
+
+            /**
+             * @brief Checks whether the queue is empty.
+             * @return True if the queue has no elements.
+             */
+            constexpr bool isEmpty() const
+            {
+                return this->mSize == 0;
+            }
+
+        private:
+            /**
+             * @brief Moves element index from hole towards the root until heap order is restored.
+             * @param hole Heap position to fill.
+             * @param index Element index to place.
+             */
+            void siftUp(size_t hole, size_t index)
+            {
+                size_t* heap = this->mHeap.getData();
+                size_t* positions = this->mPositions.getData();
+                const T* values = this->mValues.getData();
+
+                while (hole > 0)
+                {
+                    size_t parent = (hole - 1) / Arity;
+
+                    if (!this->mCompare(values[index], values[heap[parent]]))
+                        break;
+
+                    heap[hole] = heap[parent];
+                    positions[heap[hole]] = hole;
+                    hole = parent;
+                }
+
+                heap[hole] = index;
+                positions[index] = hole;
+            }
+
+            /**
+             * @brief Moves element index from hole towards the leaves until heap order is restored.
+             * @param hole Heap position to fill.
+             * @param index Element index to place.
+             */
+            void siftDown(size_t hole, size_t index)
+            {
+                size_t* heap = this->mHeap.getData();
+                size_t* positions = this->mPositions.getData();
+                const T* values = this->mValues.getData();
+
+                while (true)
+                {
+                    size_t firstChild = hole * Arity + 1;
+
+                    if (firstChild >= this->mSize)
+                        break;
+
+                    size_t lastChild = firstChild + Arity < this->mSize ? firstChild + Arity : this->mSize;
+                    size_t best = firstChild;
+
+                    for (size_t child = firstChild + 1; child < lastChild; child++)
+                    {
+                        if (this->mCompare(values[heap[child]], values[heap[best]]))
+                            best = child;
+                    }
+
+                    if (!this->mCompare(values[heap[best]], values[index]))
+                        break;
+
+                    heap[hole] = heap[best];
+                    positions[heap[hole]] = hole;
+                    hole = best;
+                }
+
+                heap[hole] = index;
+                positions[index] = hole;
+            }
+    };
+}
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+
+namespace dsa::structures::queues
+{
+    /**
+     * @brief Priority queue implemented as implicit d-ary heap.
+     *
+     * Elements are stored in DynamicArray in heap order. Top of the queue is the element that no
+     * other element compares before, so with default std::less the smallest element is on top
+     * (opposite of std::priority_queue). Higher arity makes the heap shallower and keeps children
+     * of a node next to each other in memory, 4-ary heap is usually the fastest on modern CPUs.
+     *
+     * @tparam T Type of elements stored in the queue.
+     * @tparam Compare Comparator, returns true if first argument has higher priority.
+     * @tparam Arity Number of children of each heap node.
+     */
+    template<typename T, typename Compare = std::less<T>, size_t Arity = 2>
+    class PriorityQueue
+    {
+        static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+        private:
+            dsa::structures::arrays::DynamicArray<T> mHeap;    /// Heap storage, its size is the capacity of queue.
+            size_t mSize;                                       /// Number of elements in the queue.
+            Compare mCompare;                                   /// Comparator instance.
+
+        public:
+            using ValueType = T;
+            using ReferenceType = T&;
+            using ConstReferenceType = const T&;
+            using CompareType = Compare;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty queue.
+             * @param compare Comparator instance.
+             */
+            explicit PriorityQueue(const Compare& compare = Compare()) : mHeap(), mSize(0), mCompare(compare) {}
+
+            /**
+             * @brief Constructs the queue from an initializer list in linear time.
+             * @param list Initializer list of elements.
+             * @param compare Comparator instance.
+             */
+            PriorityQueue(std::initializer_list<T> list, const Compare& compare = Compare()) : mHeap(list), mSize(list.size()), mCompare(compare)
+            {
+                this->heapify();
+            }
+
+            /**
+             * @brief Constructs the queue from elements of DynamicArray in linear time.
+             * @param array Array of elements.
+             * @param compare Comparator instance.
+             */
+            explicit PriorityQueue(dsa::structures::arrays::DynamicArray<T> array, const Compare& compare = Compare()) : mHeap(std::move(array)), mSize(0), mCompare(compare)
+            {
+                this->mSize = this->mHeap.getSize();
+                this->heapify();
+            }
+
+            /**
+             * @brief Returns the element with highest priority.
+             * @return Const reference to the top element.
+             * @throws std::runtime_error if the queue is empty.
+             */
+            ConstReferenceType top() const
+            {
+                if (this->mSize == 0)
+                    throw std::runtime_error("Cannot access item when no item is present in queue");
+
+                return this->mHeap.getData()[0];
+            }
+
+            /**
+             * @brief Inserts element into the queue.
+             * @param value Value to insert.
+             */
+            void push(ValueType value)
+            {
+                if (this->mSize == this->mHeap.getSize())
+                    this->reserve(this->mSize == 0 ? 1 : this->mSize * 2);
+
+                this->mSize++;
+                this->siftUp(this->mSize - 1, std::move(value));
+            }
+
+            /**
+             * @brief Inserts range of elements into the queue.
+             *
+             * When the batch is at least as large as the queue, the whole heap is rebuilt in linear
+             * time instead of sifting every element up separately.
+             *
+             * @tparam Iterator Type of input iterator.
+             * @param first Iterator to first element of range.
+             * @param last Iterator past the last element of range.
+             */
+            template<typename Iterator>
+            void pushBatch(Iterator first, Iterator last)
+            {
+                size_t previousSize = this->mSize;
+
+                for (; first != last; ++first)
+                {
+                    if (this->mSize == this->mHeap.getSize())
+                        this->reserve(this->mSize == 0 ? 1 : this->mSize * 2);
+
+                    this->mHeap.getData()[this->mSize++] = *first;
+                }
+
+                if (this->mSize - previousSize >= previousSize)
+                {
+                    this->heapify();
+                    return;
+                }
+
+                T* heap = this->mHeap.getData();
+
+                for (size_t i = previousSize; i < this->mSize; i++)
+                {
+                    this->siftUp(i, std::move(heap[i]));
+                }
+            }
+
+            /**
+             * @brief Inserts all elements of DynamicArray into the queue.
+             * @param array Array of elements to insert.
+             */
+            void pushBatch(dsa::structures::arrays::DynamicArray<T>& array)
+            {
+                this->pushBatch(array.begin(), array.end());
+            }
+
+            /**
+             * @brief Removes the element with highest priority.
+             * @throws std::runtime_error if the queue is empty.
+             */
+            void pop()
+            {
+                if (this->mSize == 0)
+                    throw std::runtime_error("Cannot remove item when no item is present in queue");
+
+                T* heap = this->mHeap.getData();
+
+                this->mSize--;
+
+                if (this->mSize != 0)
+                    this->siftDown(0, std::move(heap[this->mSize]));
+
+                this->releaseSlots(this->mSize, this->mSize + 1);
+            }
+
+            /**
+             * @brief Ensures the queue can hold given number of elements without reallocation.
+             * @param capacity Requested capacity.
+             */
+            void reserve(size_t capacity)
+            {
+                if (capacity <= this->mHeap.getSize())
+                    return;
+
+                dsa::structures::arrays::DynamicArray<T> temp(capacity);
+
+                for (size_t i = 0; i < this->mSize; i++)
+                {
+                    temp.getData()[i] = std::move(this->mHeap.getData()[i]);
+                }
+
+                this->mHeap = std::move(temp);
+            }
+
+            /**
+             * @brief Removes all elements while keeping allocated storage.
+             */
+            void clear()
+            {
+                this->releaseSlots(0, this->mSize);
+                this->mSize = 0;
+            }
+
+            /**
+             * @brief Returns the number of elements in the queue.
+             * @return Number of elements.
+             */
+            constexpr size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Returns the number of elements the queue can hold without reallocation.
+             * @return Capacity of the queue.
+             */
+            size_t getCapacity() const
+            {
+                return this->mHeap.getSize();
+            }
+
+            /**
+             * @brief Checks whether the queue is empty.
+             * @return True if the queue has no elements.
+             */
+            constexpr bool isEmpty() const
+            {
+                return this->mSize == 0;
+            }
+
+        private:
+            /**
+             * @brief Resets slots vacated by removal so they do not keep resources alive.
+             * @param from Index of first vacated slot.
+             * @param to Index past the last vacated slot.
+             */
+            void releaseSlots(size_t from, size_t to)
+            {
+                if constexpr (!std::is_trivially_copyable_v<T>)
+                {
+                    T* heap = this->mHeap.getData();
+
+                    for (size_t i = from; i < to; i++)
+                    {
+                        heap[i] = T();
+                    }
+                }
+            }
+
+            /**
+             * @brief Builds heap from unordered storage bottom-up (Floyd's method) in linear time.
+             */
+            void heapify()
+            {
+                if (this->mSize < 2)
+                    return;
+
+                T* heap = this->mHeap.getData();
+
+                for (size_t i = (this->mSize - 2) / Arity + 1; i-- > 0;)
+                {
+                    this->siftDown(i, std::move(heap[i]));
+                }
+            }
+
+            /**
+             * @brief Moves value from hole towards the root until heap order is restored.
+             * @param hole Index of empty slot.
+             * @param value Value to place.
+             */
+            void siftUp(size_t hole, T value)
+            {
+                T* heap = this->mHeap.getData();
+
+                while (hole > 0)
+                {
+                    size_t parent = (hole - 1) / Arity;
+
+                    if (!this->mCompare(value, heap[parent]))
+                        break;
+
+                    heap[hole] = std::move(heap[parent]);
+                    hole = parent;
+                }
+
+                heap[hole] = std::move(value);
+            }
+
+            /**
+             * @brief Moves value from hole towards the leaves until heap order is restored.
+             * @param hole Index of empty slot.
+             * @param value Value to place.
+             */
+            void siftDown(size_t hole, T value)
+            {
+                T* heap = this->mHeap.getData();
+
+                while (true)
+                {
+                    size_t firstChild = hole * Arity + 1;
+
+                    if (firstChild >= this->mSize)
+                        break;
+
+                    size_t lastChild = firstChild + Arity < this->mSize ? firstChild + Arity : this->mSize;
+                    size_t best = firstChild;
+
+                    for (size_t child = firstChild + 1; child < lastChild; child++)
+                    {
+                        if (this->mCompare(heap[child], heap[best]))
+                            best = child;
+                    }
+
+                    if (!this->mCompare(heap[best], value))
+                        break;
+
+                    heap[hole] = std::move(heap[best]);
+                    hole = best;
+                }
+
+                heap[hole] = std::move(value);
+            }
+    };
+}
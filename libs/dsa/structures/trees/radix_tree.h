@@ -0,0 +1,1208 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <dsa/utility/instrumentation.h>
+#include <dsa/utility/intrinsics.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSA_RADIX_SSE2 1
+#endif
+
+namespace dsa::structures::trees
+{
+    /**
+     * @brief Adaptive radix tree mapping byte string keys to values, kept in lexicographic order.
+     *
+     * Inner nodes branch on one key byte and come in four sizes chosen by number of children:
+     * Node4 and Node16 keep sorted key bytes next to child pointers, Node16 is searched by one SSE2
+     * comparison, Node48 maps byte to one of 48 slots through 256 byte index and Node256 is indexed
+     * directly. Nodes grow and shrink between sizes on insert and erase, so sparse levels stay small
+     * and dense levels stay one lookup deep.
+     *
+     * Chains of nodes with single child are collapsed into prefix of the next node (path
+     * compression). The first MaxPrefixLength bytes of prefix are stored in the node, lookups only
+     * compare those and verify the whole key in the leaf at the end. Key that ends inside inner node
+     * is kept in its terminal slot. Leaf stores value and key bytes in one allocation.
+     *
+     * @tparam V Type of values.
+     */
+    template<typename V>
+    class RadixTree
+    {
+        private:
+            static constexpr size_t MaxPrefixLength = 10;   /// Prefix bytes stored inline in inner node.
+
+            /**
+             * @brief Kind of node, stored in first byte of every node.
+             */
+            enum class NodeType : uint8_t
+            {
+                Leaf,
+                Node4,
+                Node16,
+                Node48,
+                Node256
+            };
+
+            /**
+             * @brief Common header of all nodes.
+             */
+            struct Node
+            {
+                NodeType mType;     /// Kind of node.
+
+                explicit Node(NodeType type) : mType(type) {}
+            };
+
+            /**
+             * @brief Leaf holding value, followed in the same allocation by key bytes.
+             */
+            struct Leaf : Node
+            {
+                V mValue;               /// Value of key.
+                size_t mKeyLength;      /// Number of key bytes following the leaf.
+
+                Leaf(V value, size_t keyLength) : Node(NodeType::Leaf), mValue(std::move(value)), mKeyLength(keyLength) {}
+
+                std::string_view getKey() const
+                {
+                    return std::string_view(reinterpret_cast<const char*>(this + 1), this->mKeyLength);
+                }
+            };
+
+            /**
+             * @brief Header of inner nodes.
+             */
+            struct InnerNode : Node
+            {
+                uint16_t mCount = 0;                            /// Number of children.
+                uint32_t mPrefixLength = 0;                     /// Length of compressed path above children.
+                unsigned char mPrefix[MaxPrefixLength] = {};    /// First bytes of compressed path.
+                Leaf* pTerminal = nullptr;                      /// Leaf of key ending at this node.
+
+                explicit InnerNode(NodeType type) : Node(type) {}
+            };
+
+            struct Node4 : InnerNode
+            {
+                unsigned char mKeys[4] = {};        /// Sorted key bytes of children.
+                Node* pChildren[4] = {};            /// Children in order of key bytes.
+
+                Node4() : InnerNode(NodeType::Node4) {}
+            };
+
+            struct Node16 : InnerNode
+            {
+                unsigned char mKeys[16] = {};       /// Sorted key bytes of children.
+                Node* pChildren[16] = {};           /// Children in order of key bytes.
+
+                Node16() : InnerNode(NodeType::Node16) {}
+            };
+
+            struct Node48 : InnerNode
+            {
+                unsigned char mIndex[256] = {};     /// Slot of child plus one for every key byte, 0 if absent.
+                Node* pChildren[48] = {};           /// Children in arbitrary slots.
+
+                Node48() : InnerNode(NodeType::Node48) {}
+            };
+
+            struct Node256 : InnerNode
+            {
+                Node* pChildren[256] = {};          /// Child of every key byte, nullptr if absent.
+
+                Node256() : InnerNode(NodeType::Node256) {}
+            };
+
+            Node* pRoot;            /// Root node, nullptr if empty.
+            size_t mSize;           /// Number of keys.
+            size_t mMemoryBytes;    /// Bytes allocated by nodes and leaves.
+
+        public:
+            using ValueType = V;
+            using ReferenceType = V&;
+            using ConstReferenceType = const V&;
+
+        public:
+            /**
+             * @brief Default constructor. Initializes an empty tree.
+             */
+            RadixTree() : pRoot(nullptr), mSize(0), mMemoryBytes(0) {}
+
+            RadixTree(const RadixTree&) = delete;
+            RadixTree& operator=(const RadixTree&) = delete;
+
+            /**
+             * @brief Move constructor. Transfers nodes of other tree, which is left empty.
+             * @param other The RadixTree to move from.
+             */
+            RadixTree(RadixTree<V>&& other) noexcept : pRoot(other.pRoot), mSize(other.mSize), mMemoryBytes(other.mMemoryBytes)
+            {
+                other.pRoot = nullptr;
+                other.mSize = 0;
+                other.mMemoryBytes = 0;
+            }
+
+            /**
+             * @brief Move assignment operator.
+             * @param other The RadixTree to move from.
+             * @return Reference to this RadixTree.
+             */
+            RadixTree<V>& operator=(RadixTree<V>&& other) noexcept
+            {
+                if (this == &other)
+                    return *this;
+
+                this->clear();
+
+                std::swap(this->pRoot, other.pRoot);
+                std::swap(this->mSize, other.mSize);
+                std::swap(this->mMemoryBytes, other.mMemoryBytes);
+
+                return *this;
+            }
+
+            /**
+             * @brief Destructor. Releases all nodes.
+             */
+            ~RadixTree()
+            {
+                this->clear();
+            }
+
+            /**
+             * @brief Inserts key or replaces its value.
+             * @param key Key bytes.
+             * @param value Value of key.
+             * @return True if key was not present before.
+             */
+            bool insert(std::string_view key, V value)
+            {
+                bool inserted = this->insert(this->pRoot, key, value, 0);
+
+                if (inserted)
+                    this->mSize++;
+
+                return inserted;
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @return Pointer to value, nullptr if key is not present.
+             */
+            V* find(std::string_view key)
+            {
+                Leaf* leaf = this->findLeaf(key);
+
+                return leaf != nullptr ? &leaf->mValue : nullptr;
+            }
+
+            /**
+             * @brief Finds value of key.
+             * @param key Key to search for.
+             * @return Const pointer to value, nullptr if key is not present.
+             */
+            const V* find(std::string_view key) const
+            {
+                Leaf* leaf = this->findLeaf(key);
+
+                return leaf != nullptr ? &leaf->mValue : nullptr;
+            }
+
+            /**
+             * @brief Returns a reference to value of key.
+             * @param key Key to search for.
+             * @return Reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ReferenceType get(std::string_view key)
+            {
+                V* value = this->find(key);
+
+                if (value == nullptr)
+                    throw std::out_of_range("Key is not present in tree");
+
+                return *value;
+            }
+
+            /**
+             * @brief Returns a const reference to value of key.
+             * @param key Key to search for.
+             * @return Const reference to value.
+             * @throws std::out_of_range if key is not present.
+             */
+            ConstReferenceType get(std::string_view key) const
+            {
+                const V* value = this->find(key);
+
+                if (value == nullptr)
+                    throw std::out_of_range("Key is not present in tree");
+
+                return *value;
+            }
+
+            /**
+             * @brief Checks whether key is in the tree.
+             * @param key Key to search for.
+             * @return True if key is present.
+             */
+            bool contains(std::string_view key) const
+            {
+                return this->findLeaf(key) != nullptr;
+            }
+
+            /**
+             * @brief Removes key.
+             * @param key Key to remove.
+             * @return True if key was present.
+             */
+            bool erase(std::string_view key)
+            {
+                bool erased = this->erase(this->pRoot, key, 0);
+
+                if (erased)
+                    this->mSize--;
+
+                return erased;
+            }
+
+            /**
+             * @brief Calls function for every entry in lexicographic order of keys.
+             * @param function Callable taking std::string_view key and reference to value.
+             */
+            template<typename Function>
+            void forEach(Function function)
+            {
+                if (this->pRoot != nullptr)
+                    visit(this->pRoot, function);
+            }
+
+            /**
+             * @brief Calls function for every entry whose key starts with prefix, in lexicographic order.
+             * @param prefix Prefix of keys.
+             * @param function Callable taking std::string_view key and reference to value.
+             */
+            template<typename Function>
+            void forEachWithPrefix(std::string_view prefix, Function function)
+            {
+                Node* node = this->pRoot;
+                size_t depth = 0;
+
+                while (node != nullptr)
+                {
+                    if (node->mType == NodeType::Leaf)
+                    {
+                        Leaf* leaf = static_cast<Leaf*>(node);
+
+                        if (leaf->getKey().substr(0, prefix.size()) == prefix)
+                            function(leaf->getKey(), leaf->mValue);
+
+                        return;
+                    }
+
+                    InnerNode* inner = static_cast<InnerNode*>(node);
+
+                    if (inner->mPrefixLength != 0)
+                    {
+                        size_t matched = prefixMismatch(inner, prefix, depth);
+
+                        if (matched == prefix.size() - depth)
+                            break;
+
+                        if (matched < inner->mPrefixLength)
+                            return;
+
+                        depth += inner->mPrefixLength;
+                    }
+
+                    if (depth == prefix.size())
+                        break;
+
+                    Node** child = findChild(inner, static_cast<unsigned char>(prefix[depth]));
+
+                    node = child != nullptr ? *child : nullptr;
+                    depth++;
+                }
+
+                if (node != nullptr)
+                    visit(node, function);
+            }
+
+            /**
+             * @brief Returns the number of keys.
+             * @return Number of keys.
+             */
+            size_t getSize() const
+            {
+                return this->mSize;
+            }
+
+            /**
+             * @brief Checks whether the tree is empty.
+             * @return True if the tree has no keys.
+             */
+            bool isEmpty() const
+            {
+                return this->mSize == 0;
+            }
+
+            /**
+             * @brief Returns memory allocated by nodes and leaves, including key bytes.
+             * @return Number of bytes.
+             */
+            size_t getMemoryUsage() const
+            {
+                return this->mMemoryBytes;
+            }
+
+            /**
+             * @brief Removes all keys.
+             */
+            void clear()
+            {
+                if (this->pRoot != nullptr)
+                    this->destroyTree(this->pRoot);
+
+                this->pRoot = nullptr;
+                this->mSize = 0;
+            }
+
+        private:
+            /**
+             * @brief Allocates empty inner node.
+             */
+            template<typename InnerType>
+            InnerType* createNode()
+            {
+                DSA_INSTRUMENT_ALLOCATION(RadixTree, sizeof(InnerType));
+
+                this->mMemoryBytes += sizeof(InnerType);
+
+                return new InnerType();
+            }
+
+            /**
+             * @brief Allocates leaf with key bytes stored right after it.
+             */
+            Leaf* createLeaf(std::string_view key, V& value)
+            {
+                size_t bytes = sizeof(Leaf) + key.size();
+                void* memory = ::operator new(bytes);
+                Leaf* leaf;
+
+                try
+                {
+                    leaf = new (memory) Leaf(std::move(value), key.size());
+                }
+                catch (...)
+                {
+                    ::operator delete(memory);
+                    throw;
+                }
+
+                std::memcpy(static_cast<void*>(leaf + 1), key.data(), key.size());
+
+                DSA_INSTRUMENT_ALLOCATION(RadixTree, bytes);
+
+                this->mMemoryBytes += bytes;
+
+                return leaf;
+            }
+
+            /**
+             * @brief Releases single node without its children.
+             */
+            void destroyNode(Node* node)
+            {
+                size_t bytes = 0;
+
+                switch (node->mType)
+                {
+                    case NodeType::Leaf:
+                    {
+                        Leaf* leaf = static_cast<Leaf*>(node);
+
+                        bytes = sizeof(Leaf) + leaf->mKeyLength;
+                        leaf->~Leaf();
+                        ::operator delete(static_cast<void*>(leaf));
+                        break;
+                    }
+                    case NodeType::Node4:
+                        bytes = sizeof(Node4);
+                        delete static_cast<Node4*>(node);
+                        break;
+                    case NodeType::Node16:
+                        bytes = sizeof(Node16);
+                        delete static_cast<Node16*>(node);
+                        break;
+                    case NodeType::Node48:
+                        bytes = sizeof(Node48);
+                        delete static_cast<Node48*>(node);
+                        break;
+                    case NodeType::Node256:
+                        bytes = sizeof(Node256);
+                        delete static_cast<Node256*>(node);
+                        break;
+                }
+
+                DSA_INSTRUMENT_DEALLOCATION(RadixTree, bytes);
+
+                this->mMemoryBytes -= bytes;
+            }
+
+            /**
+             * @brief Releases node with whole subtree.
+             */
+            void destroyTree(Node* node)
+            {
+                if (node->mType != NodeType::Leaf)
+                {
+                    InnerNode* inner = static_cast<InnerNode*>(node);
+
+                    if (inner->pTerminal != nullptr)
+                        this->destroyNode(inner->pTerminal);
+
+                    forEachChild(inner, [this](Node* child) { this->destroyTree(child); });
+                }
+
+                this->destroyNode(node);
+            }
+
+            /**
+             * @brief Calls function for every child of inner node in order of key bytes.
+             */
+            template<typename Function>
+            static void forEachChild(InnerNode* node, Function&& function)
+            {
+                switch (node->mType)
+                {
+                    case NodeType::Node4:
+                    {
+                        Node4* n = static_cast<Node4*>(node);
+
+                        for (size_t i = 0; i < n->mCount; i++)
+                        {
+                            function(n->pChildren[i]);
+                        }
+
+                        break;
+                    }
+                    case NodeType::Node16:
+                    {
+                        Node16* n = static_cast<Node16*>(node);
+
+                        for (size_t i = 0; i < n->mCount; i++)
+                        {
+                            function(n->pChildren[i]);
+                        }
+
+                        break;
+                    }
+                    case NodeType::Node48:
+                    {
+                        Node48* n = static_cast<Node48*>(node);
+
+                        for (size_t c = 0; c < 256; c++)
+                        {
+                            if (n->mIndex[c] != 0)
+                                function(n->pChildren[n->mIndex[c] - 1]);
+                        }
+
+                        break;
+                    }
+                    case NodeType::Node256:
+                    {
+                        Node256* n = static_cast<Node256*>(node);
+
+                        for (size_t c = 0; c < 256; c++)
+                        {
+                            if (n->pChildren[c] != nullptr)
+                                function(n->pChildren[c]);
+                        }
+
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+
+            /**
+             * @brief Calls function for every leaf of subtree in lexicographic order.
+             */
+            template<typename Function>
+            static void visit(Node* node, Function& function)
+            {
+                if (node->mType == NodeType::Leaf)
+                {
+                    Leaf* leaf = static_cast<Leaf*>(node);
+
+                    function(leaf->getKey(), leaf->mValue);
+                    return;
+                }
+
+                InnerNode* inner = static_cast<InnerNode*>(node);
+
+                // Key ending at this node is a prefix of all keys below it, so it comes first.
+                if (inner->pTerminal != nullptr)
+                    function(inner->pTerminal->getKey(), inner->pTerminal->mValue);
+
+                forEachChild(inner, [&function](Node* child) { visit(child, function); });
+            }
+
+            /**
+             * @brief Finds slot of child for key byte.
+             * @return Pointer to child slot, nullptr if there is no such child.
+             */
+            static Node** findChild(InnerNode* node, unsigned char byte)
+            {
+                switch (node->mType)
+                {
+                    case NodeType::Node4:
+                    {
+                        Node4* n = static_cast<Node4*>(node);
+
+                        for (size_t i = 0; i < n->mCount; i++)
+                        {
+                            if (n->mKeys[i] == byte)
+                                return &n->pChildren[i];
+                        }
+
+                        return nullptr;
+                    }
+                    case NodeType::Node16:
+                    {
+                        Node16* n = static_cast<Node16*>(node);
+#if defined(DSA_RADIX_SSE2)
+                        // All 16 key bytes are compared at once, bits past the count are masked out.
+                        __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->mKeys));
+                        __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), keys);
+                        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches)) & ((1u << n->mCount) - 1);
+
+                        return mask != 0 ? &n->pChildren[dsa::utility::countTrailingZeros(mask)] : nullptr;
+#else
+                        for (size_t i = 0; i < n->mCount; i++)
+                        {
+                            if (n->mKeys[i] == byte)
+                                return &n->pChildren[i];
+                        }
+
+                        return nullptr;
+#endif
+                    }
+                    case NodeType::Node48:
+                    {
+                        Node48* n = static_cast<Node48*>(node);
+
+                        return n->mIndex[byte] != 0 ? &n->pChildren[n->mIndex[byte] - 1] : nullptr;
+                    }
+                    case NodeType::Node256:
+                    {
+                        Node256* n = static_cast<Node256*>(node);
+
+                        return n->pChildren[byte] != nullptr ? &n->pChildren[byte] : nullptr;
+                    }
+                    default:
+                        return nullptr;
+                }
+            }
+
+            /**
+             * @brief Finds any leaf below node, all of them share the full prefix of node.
+             */
+            static Leaf* minimumLeaf(Node* node)
+            {
+                while (node->mType != NodeType::Leaf)
+                {
+                    InnerNode* inner = static_cast<InnerNode*>(node);
+
+                    if (inner->pTerminal != nullptr)
+                        return inner->pTerminal;
+
+                    Node* first = nullptr;
+
+                    forEachChild(inner, [&first](Node* child)
+                    {
+                        if (first == nullptr)
+                            first = child;
+                    });
+
+                    node = first;
+                }
+
+                return static_cast<Leaf*>(node);
+            }
+
+            /**
+             * @brief Compares prefix of node with key starting at depth, bytes past the stored ones are read from a leaf.
+             * @return Number of matching bytes, at most prefix length and remaining key length.
+             */
+            static size_t prefixMismatch(InnerNode* node, std::string_view key, size_t depth)
+            {
+                size_t limit = std::min<size_t>(node->mPrefixLength, key.size() - depth);
+                size_t stored = std::min(limit, MaxPrefixLength);
+                size_t i = 0;
+
+                for (; i < stored; i++)
+                {
+                    if (node->mPrefix[i] != static_cast<unsigned char>(key[depth + i]))
+                        return i;
+                }
+
+                if (limit > MaxPrefixLength)
+                {
+                    std::string_view leafKey = minimumLeaf(node)->getKey();
+
+                    for (; i < limit; i++)
+                    {
+                        if (leafKey[depth + i] != key[depth + i])
+                            return i;
+                    }
+                }
+
+                return i;
+            }
+
+            /**
+             * @brief Walks the tree comparing only stored prefix bytes, the leaf found is verified by full key.
+             */
+            Leaf* findLeaf(std::string_view key) const
+            {
+                Node* node = this->pRoot;
+                size_t depth = 0;
+
+                while (node != nullptr)
+                {
+                    if (node->mType == NodeType::Leaf)
+                    {
+                        Leaf* leaf = static_cast<Leaf*>(node);
+
+                        return leaf->getKey() == key ? leaf : nullptr;
+                    }
+
+                    InnerNode* inner = static_cast<InnerNode*>(node);
+
+                    if (inner->mPrefixLength != 0)
+                    {
+                        if (depth + inner->mPrefixLength > key.size())
+                            return nullptr;
+
+                        size_t stored = std::min<size_t>(inner->mPrefixLength, MaxPrefixLength);
+
+                        if (std::memcmp(inner->mPrefix, key.data() + depth, stored) != 0)
+                            return nullptr;
+
+                        depth += inner->mPrefixLength;
+                    }
+
+                    if (depth == key.size())
+                        return inner->pTerminal != nullptr && inner->pTerminal->getKey() == key ? inner->pTerminal : nullptr;
+
+                    Node** child = findChild(inner, static_cast<unsigned char>(key[depth]));
+
+                    node = child != nullptr ? *child : nullptr;
+                    depth++;
+                }
+
+                return nullptr;
+            }
+
+            /**
+             * @brief Stores prefix of given length taken from key starting at depth.
+             */
+            static void setPrefix(InnerNode* node, std::string_view key, size_t depth, size_t length)
+            {
+                node->mPrefixLength = static_cast<uint32_t>(length);
+                std::memcpy(node->mPrefix, key.data() + depth, std::min(length, MaxPrefixLength));
+            }
+
+            /**
+             * @brief Attaches leaf under inner node whose children start at depth.
+             */
+            void attachLeaf(Node*& reference, Leaf* leaf, size_t depth)
+            {
+                InnerNode* inner = static_cast<InnerNode*>(reference);
+                std::string_view key = leaf->getKey();
+
+                if (key.size() == depth)
+                    inner->pTerminal = leaf;
+                else
+                    this->addChild(reference, static_cast<unsigned char>(key[depth]), leaf);
+            }
+
+            /**
+             * @brief Inserts key into subtree referenced by slot.
+             */
+            bool insert(Node*& reference, std::string_view key, V& value, size_t depth)
+            {
+                Node* node = reference;
+
+                if (node == nullptr)
+                {
+                    reference = this->createLeaf(key, value);
+                    return true;
+                }
+
+                if (node->mType == NodeType::Leaf)
+                {
+                    Leaf* leaf = static_cast<Leaf*>(node);
+                    std::string_view leafKey = leaf->getKey();
+
+                    if (leafKey == key)
+                    {
+                        leaf->mValue = std::move(value);
+                        return false;
+                    }
+
+                    // Two keys below one slot are split by new node at their first differing byte.
+                    size_t common = 0;
+                    size_t limit = std::min(leafKey.size(), key.size());
+
+                    while (depth + common < limit && leafKey[depth + common] == key[depth + common])
+                    {
+                        common++;
+                    }
+
+                    Leaf* added = this->createLeaf(key, value);
+                    Node4* split = this->template createNode<Node4>();
+
+                    setPrefix(split, key, depth, common);
+
+                    Node* splitNode = split;
+
+                    this->attachLeaf(splitNode, leaf, depth + common);
+                    this->attachLeaf(splitNode, added, depth + common);
+
+                    reference = splitNode;
+                    return true;
+                }
+
+                InnerNode* inner = static_cast<InnerNode*>(node);
+
+                if (inner->mPrefixLength != 0)
+                {
+                    size_t matched = prefixMismatch(inner, key, depth);
+
+                    if (matched < inner->mPrefixLength)
+                    {
+                        // Key leaves compressed path in the middle, path is split by new node.
+                        Node4* split = this->template createNode<Node4>();
+                        unsigned char branch;
+
+                        setPrefix(split, key, depth, matched);
+
+                        if (inner->mPrefixLength <= MaxPrefixLength)
+                        {
+                            branch = inner->mPrefix[matched];
+                            inner->mPrefixLength -= static_cast<uint32_t>(matched + 1);
+                            std::memmove(inner->mPrefix, inner->mPrefix + matched + 1, inner->mPrefixLength);
+                        }
+                        else
+                        {
+                            std::string_view leafKey = minimumLeaf(inner)->getKey();
+
+                            branch = static_cast<unsigned char>(leafKey[depth + matched]);
+                            inner->mPrefixLength -= static_cast<uint32_t>(matched + 1);
+                            std::memcpy(inner->mPrefix, leafKey.data() + depth + matched + 1, std::min<size_t>(inner->mPrefixLength, MaxPrefixLength));
+                        }
+
+                        Node* splitNode = split;
+
+                        this->addChild(splitNode, branch, inner);
+                        this->attachLeaf(splitNode, this->createLeaf(key, value), depth + matched);
+
+                        reference = splitNode;
+                        return true;
+                    }
+
+                    depth += inner->mPrefixLength;
+                }
+
+                if (depth == key.size())
+                {
+                    if (inner->pTerminal != nullptr)
+                    {
+                        inner->pTerminal->mValue = std::move(value);
+                        return false;
+                    }
+
+                    inner->pTerminal = this->createLeaf(key, value);
+                    return true;
+                }
+
+                unsigned char byte = static_cast<unsigned char>(key[depth]);
+                Node** child = findChild(inner, byte);
+
+                if (child != nullptr)
+                    return this->insert(*child, key, value, depth + 1);
+
+                this->addChild(reference, byte, this->createLeaf(key, value));
+                return true;
+            }
+
+            /**
+             * @brief Copies header of inner node into node of another size.
+             */
+            static void copyHeader(InnerNode* from, InnerNode* to)
+            {
+                to->mCount = from->mCount;
+                to->mPrefixLength = from->mPrefixLength;
+                to->pTerminal = from->pTerminal;
+                std::memcpy(to->mPrefix, from->mPrefix, MaxPrefixLength);
+            }
+
+            /**
+             * @brief Inserts child into sorted arrays of Node4 or Node16 with free space.
+             */
+            template<typename SortedNode>
+            static void insertSorted(SortedNode* node, unsigned char byte, Node* child)
+            {
+                size_t position = 0;
+
+                while (position < node->mCount && node->mKeys[position] < byte)
+                {
+                    position++;
+                }
+
+                for (size_t i = node->mCount; i > position; i--)
+                {
+                    node->mKeys[i] = node->mKeys[i - 1];
+                    node->pChildren[i] = node->pChildren[i - 1];
+                }
+
+                node->mKeys[position] = byte;
+                node->pChildren[position] = child;
+                node->mCount++;
+            }
+
+            /**
+             * @brief Adds child to inner node referenced by slot, growing node to the next size when full.
+             */
+            void addChild(Node*& reference, unsigned char byte, Node* child)
+            {
+                switch (reference->mType)
+                {
+                    case NodeType::Node4:
+                    {
+                        Node4* node = static_cast<Node4*>(reference);
+
+                        if (node->mCount < 4)
+                        {
+                            insertSorted(node, byte, child);
+                            return;
+                        }
+
+                        Node16* grown = this->template createNode<Node16>();
+
+                        copyHeader(node, grown);
+                        std::memcpy(grown->mKeys, node->mKeys, sizeof(node->mKeys));
+                        std::memcpy(grown->pChildren, node->pChildren, sizeof(node->pChildren));
+
+                        insertSorted(grown, byte, child);
+                        reference = grown;
+                        this->destroyNode(node);
+                        return;
+                    }
+                    case NodeType::Node16:
+                    {
+                        Node16* node = static_cast<Node16*>(reference);
+
+                        if (node->mCount < 16)
+                        {
+                            insertSorted(node, byte, child);
+                            return;
+                        }
+
+                        Node48* grown = this->template createNode<Node48>();
+
+                        copyHeader(node, grown);
+
+                        for (size_t i = 0; i < 16; i++)
+                        {
+                            grown->mIndex[node->mKeys[i]] = static_cast<unsigned char>(i + 1);
+                            grown->pChildren[i] = node->pChildren[i];
+                        }
+
+                        reference = grown;
+                        this->destroyNode(node);
+                        this->addChild(reference, byte, child);
+                        return;
+                    }
+                    case NodeType::Node48:
+                    {
+                        Node48* node = static_cast<Node48*>(reference);
+
+                        if (node->mCount < 48)
+                        {
+                            size_t slot = 0;
+
+                            while (node->pChildren[slot] != nullptr)
+                            {
+                                slot++;
+                            }
+
+                            node->pChildren[slot] = child;
+                            node->mIndex[byte] = static_cast<unsigned char>(slot + 1);
+                            node->mCount++;
+                            return;
+                        }
+
+                        Node256* grown = this->template createNode<Node256>();
+
+                        copyHeader(node, grown);
+
+                        for (size_t c = 0; c < 256; c++)
+                        {
+                            if (node->mIndex[c] != 0)
+                                grown->pChildren[c] = node->pChildren[node->mIndex[c] - 1];
+                        }
+
+                        reference = grown;
+                        this->destroyNode(node);
+                        this->addChild(reference, byte, child);
+                        return;
+                    }
+                    case NodeType::Node256:
+                    {
+                        Node256* node = static_cast<Node256*>(reference);
+
+                        node->pChildren[byte] = child;
+                        node->mCount++;
+                        return;
+                    }
+                    default:
+                        return;
+                }
+            }
+
+            /**
+             * @brief Removes child of key byte from inner node.
+             */
+            static void removeChild(InnerNode* inner, unsigned char byte)
+            {
+                switch (inner->mType)
+                {
+                    case NodeType::Node4:
+                    case NodeType::Node16:
+                    {
+                        unsigned char* keys = inner->mType == NodeType::Node4 ? static_cast<Node4*>(inner)->mKeys : static_cast<Node16*>(inner)->mKeys;
+                        Node** children = inner->mType == NodeType::Node4 ? static_cast<Node4*>(inner)->pChildren : static_cast<Node16*>(inner)->pChildren;
+                        size_t position = 0;
+
+                        while (keys[position] != byte)
+                        {
+                            position++;
+                        }
+
+                        for (size_t i = position + 1; i < inner->mCount; i++)
+                        {
+                            keys[i - 1] = keys[i];
+                            children[i - 1] = children[i];
+                        }
+
+                        break;
+                    }
+                    case NodeType::Node48:
+                    {
+                        Node48* node = static_cast<Node48*>(inner);
+
+                        node->pChildren[node->mIndex[byte] - 1] = nullptr;
+                        node->mIndex[byte] = 0;
+                        break;
+                    }
+                    case NodeType::Node256:
+                        static_cast<Node256*>(inner)->pChildren[byte] = nullptr;
+                        break;
+                    default:
+                        break;
+                }
+
+                inner->mCount--;
+            }
+
+            /**
+             * @brief Replaces underfull inner node referenced by slot with smaller node, its only child or its terminal leaf.
+             */
+            void shrink(Node*& reference)
+            {
+                InnerNode* inner = static_cast<InnerNode*>(reference);
+
+                switch (inner->mType)
+                {
+                    case NodeType::Node4:
+                    {
+                        Node4* node = static_cast<Node4*>(inner);
+
+                        if (node->mCount == 0)
+                        {
+                            // Only the terminal key is left, its leaf holds the full key and can replace the node.
+                            reference = node->pTerminal;
+                            this->destroyNode(node);
+                        }
+                        else if (node->mCount == 1 && node->pTerminal == nullptr)
+                        {
+                            Node* child = node->pChildren[0];
+
+                            if (child->mType != NodeType::Leaf)
+                            {
+                                // Path of this node, its key byte and path of child are merged into path of child.
+                                InnerNode* childInner = static_cast<InnerNode*>(child);
+                                unsigned char merged[MaxPrefixLength];
+                                size_t length = std::min<size_t>(node->mPrefixLength, MaxPrefixLength);
+
+                                std::memcpy(merged, node->mPrefix, length);
+
+                                if (length < MaxPrefixLength)
+                                    merged[length++] = node->mKeys[0];
+
+                                size_t childStored = std::min<size_t>(childInner->mPrefixLength, MaxPrefixLength - length);
+
+                                std::memcpy(merged + length, childInner->mPrefix, childStored);
+                                std::memcpy(childInner->mPrefix, merged, length + childStored);
+                                childInner->mPrefixLength += node->mPrefixLength + 1;
+                            }
+
+                            reference = child;
+                            this->destroyNode(node);
+                        }
+
+                        return;
+                    }
+                    case NodeType::Node16:
+                    {
+                        Node16* node = static_cast<Node16*>(inner);
+
+                        if (node->mCount > 3)
+                            return;
+
+                        Node4* shrunk = this->template createNode<Node4>();
+
+                        copyHeader(node, shrunk);
+                        std::memcpy(shrunk->mKeys, node->mKeys, node->mCount);
+                        std::memcpy(shrunk->pChildren, node->pChildren, node->mCount * sizeof(Node*));
+
+                        reference = shrunk;
+                        this->destroyNode(node);
+                        return;
+                    }
+                    case NodeType::Node48:
+                    {
+                        Node48* node = static_cast<Node48*>(inner);
+
+                        if (node->mCount > 12)
+                            return;
+
+                        Node16* shrunk = this->template createNode<Node16>();
+
+                        copyHeader(node, shrunk);
+                        shrunk->mCount = 0;
+
+                        for (size_t c = 0; c < 256; c++)
+                        {
+                            if (node->mIndex[c] != 0)
+                            {
+                                shrunk->mKeys[shrunk->mCount] = static_cast<unsigned char>(c);
+                                shrunk->pChildren[shrunk->mCount] = node->pChildren[node->mIndex[c] - 1];
+                                shrunk->mCount++;
+                            }
+                        }
+
+                        reference = shrunk;
+                        this->destroyNode(node);
+                        return;
+                    }
+                    case NodeType::Node256:
+                    {
+                        Node256* node = static_cast<Node256*>(inner);
+
+                        if (node->mCount > 36)
+                            return;
+
+                        Node48* shrunk = this->template createNode<Node48>();
+
+                        copyHeader(node, shrunk);
+                        shrunk->mCount = 0;
+
+                        for (size_t c = 0; c < 256; c++)
+                        {
+                            if (node->pChildren[c] != nullptr)
+                            {
+                                shrunk->pChildren[shrunk->mCount] = node->pChildren[c];
+                                shrunk->mCount++;
+                                shrunk->mIndex[c] = static_cast<unsigned char>(shrunk->mCount);
+                            }
+                        }
+
+                        reference = shrunk;
+                        this->destroyNode(node);
+                        return;
+                    }
+                    default:
+                        return;
+                }
+            }
+
+            /**
+             * @brief Removes key from subtree referenced by slot.
+             */
+            bool erase(Node*& reference, std::string_view key, size_t depth)
+            {
+                Node* node = reference;
+
+                if (node == nullptr)
+                    return false;
+
+                if (node->mType == NodeType::Leaf)
+                {
+                    if (static_cast<Leaf*>(node)->getKey() != key)
+                        return false;
+
+                    this->destroyNode(node);
+                    reference = nullptr;
+                    return true;
+                }
+
+                InnerNode* inner = static_cast<InnerNode*>(node);
+
+                if (inner->mPrefixLength != 0)
+                {
+                    if (prefixMismatch(inner, key, depth) != inner->mPrefixLength)
+                        return false;
+
+                    depth += inner->mPrefixLength;
+                }
+
+                if (depth == key.size())
+                {
+                    if (inner->pTerminal == nullptr)
+                        return false;
+
+                    this->destroyNode(inner->pTerminal);
+                    inner->pTerminal = nullptr;
+                    this->shrink(reference);
+                    return true;
+                }
+
+                unsigned char byte = static_cast<unsigned char>(key[depth]);
+                Node** child = findChild(inner, byte);
+
+                if (child == nullptr || !this->erase(*child, key, depth + 1))
+                    return false;
+
+                if (*child == nullptr)
+                    removeChild(inner, byte);
+
+                this->shrink(reference);
+                return true;
+            }
+    };
+}
@@ -0,0 +1,362 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <dsa/utility/thread_joiner.h>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
+
+/**
+ * Allocation policies decide where DynamicArray buffers live. A policy provides static functions
+ * allocate(count), returning buffer of count constructed elements, and deallocate(elements, count),
+ * destroying and releasing it, constant ValueInitializes telling whether allocated elements are
+ * already value-initialized and constant GrowsGeometrically telling whether a full array doubles
+ * its capacity when an element is added instead of growing by one slot.
+ */
+namespace dsa::utility
+{
+    constexpr size_t CacheLineSize = 64;    /// Size of cache line on common x86-64 and ARM64 CPUs.
+
+    /**
+     * @brief Allocates buffers with new[], elements are default-initialized.
+     * @tparam T Type of elements.
+     */
+    template<typename T>
+    class DefaultAllocationPolicy
+    {
+        public:
+            static constexpr bool ValueInitializes = false;     /// Trivial elements are left uninitialized.
+            static constexpr bool GrowsGeometrically = false;   /// Full array grows by one slot.
+
+            /**
+             * @brief Allocates buffer of default-initialized elements.
+             * @param count Number of elements.
+             * @return Pointer to buffer.
+             */
+            static T* allocate(size_t count)
+            {
+                return new T[count];
+            }
+
+            /**
+             * @brief Destroys elements and releases buffer.
+             * @param elements Pointer to buffer.
+             * @param count Number of elements.
+             */
+            static void deallocate(T* elements, size_t count)
+            {
+                (void)count;
+
+                delete[] elements;
+            }
+    };
+
+    /**
+     * @brief Allocates buffers whose first element is aligned to given boundary.
+     *
+     * With Alignment of 32 or 64 bytes buffers of floats or integers can be processed by aligned
+     * AVX or AVX-512 loads and every buffer starts at cache line boundary.
+     *
+     * @tparam T Type of elements.
+     * @tparam Alignment Alignment in bytes, power of two not smaller than alignment of T.
+     */
+    template<typename T, size_t Alignment>
+    class AlignedAllocationPolicy
+    {
+        static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be power of two not smaller than alignment of element type");
+
+        public:
+            static constexpr bool ValueInitializes = false;     /// Trivial elements are left uninitialized.
+            static constexpr bool GrowsGeometrically = false;   /// Full array grows by one slot.
+
+            /**
+             * @brief Allocates aligned buffer of default-initialized elements.
+             * @param count Number of elements.
+             * @return Pointer to buffer.
+             * @throws std::bad_alloc if memory cannot be allocated.
+             */
+            static T* allocate(size_t count)
+            {
+                T* elements = static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+
+                if constexpr (!std::is_trivially_default_constructible_v<T>)
+                {
+                    size_t constructed = 0;
+
+                    try
+                    {
+                        for (; constructed < count; constructed++)
+                        {
+                            new (elements + constructed) T;
+                        }
+                    }
+                    catch (...)
+                    {
+                        destroy(elements, constructed);
+                        ::operator delete(static_cast<void*>(elements), std::align_val_t(Alignment));
+                        throw;
+                    }
+                }
+
+                return elements;
+            }
+
+            /**
+             * @brief Destroys elements and releases buffer.
+             * @param elements Pointer to buffer.
+             * @param count Number of elements.
+             */
+            static void deallocate(T* elements, size_t count)
+            {
+                destroy(elements, count);
+
+                ::operator delete(static_cast<void*>(elements), std::align_val_t(Alignment));
+            }
+
+        private:
+            /**
+             * @brief Destroys first count elements.
+             */
+            static void destroy(T* elements, size_t count)
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        elements[i].~T();
+                    }
+                }
+            }
+    };
+
+    /**
+     * @brief Maps large buffers directly from the kernel and backs them by transparent huge pages.
+     *
+     * Buffers of at least HugePageSize bytes are mapped by mmap at 2 MiB aligned address and marked
+     * by madvise(MADV_HUGEPAGE), so one TLB entry covers 2 MiB instead of 4 KiB and random access over
+     * gigabytes misses TLB far less often. Smaller buffers and platforms other than Linux fall back
+     * to new[]. If transparent huge pages are disabled, mapping still works with regular pages.
+     *
+     * With ParallelFirstTouch set, pages of a large buffer are faulted in by one thread per hardware
+     * thread, each pinned to its CPU and owning a contiguous range of whole huge pages. Linux places
+     * a page on the NUMA node of the thread that touches it first, so the buffer ends up spread over
+     * nodes in the same static partition parallel workers typically use, instead of all pages
+     * landing on the node of the allocating thread.
+     *
+     * Elements are value-initialized: trivial ones are zero bytes from the kernel, others are
+     * constructed in place.
+     *
+     * Every reallocation maps a new buffer, copies all elements and unmaps the old one, so a full
+     * array doubles its capacity when an element is added. Arrays of known size should still be
+     * sized up front by constructor or reserve() to avoid reallocations altogether.
+     *
+     * @tparam T Type of elements.
+     * @tparam ParallelFirstTouch Whether large buffers are touched in parallel on allocation.
+     */
+    template<typename T, bool ParallelFirstTouch = false>
+    class HugePageAllocationPolicy
+    {
+        public:
+            static constexpr bool ValueInitializes = true;              /// Elements are value-initialized.
+            static constexpr bool GrowsGeometrically = true;            /// Full array doubles its capacity.
+            static constexpr size_t HugePageSize = 2 * 1024 * 1024;     /// Size of transparent huge page.
+            static constexpr size_t PageSize = 4096;                    /// Size of regular page.
+
+            /**
+             * @brief Allocates buffer of value-initialized elements.
+             * @param count Number of elements.
+             * @return Pointer to buffer.
+             * @throws std::bad_alloc if memory cannot be mapped.
+             */
+            static T* allocate(size_t count)
+            {
+                size_t bytes = count * sizeof(T);
+
+                if (!isMapped(bytes))
+                    return new T[count]();
+
+#if defined(__linux__)
+                size_t length = roundUp(bytes, HugePageSize);
+                void* raw = mmap(nullptr, length + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+                if (raw == MAP_FAILED)
+                    throw std::bad_alloc();
+
+                uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+                uintptr_t aligned = roundUp(begin, HugePageSize);
+
+                if (aligned != begin)
+                    munmap(raw, aligned - begin);
+
+                if (aligned + length != begin + length + HugePageSize)
+                    munmap(reinterpret_cast<void*>(aligned + length), begin + HugePageSize - aligned);
+
+                madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+
+                T* elements = reinterpret_cast<T*>(aligned);
+
+                try
+                {
+                    if constexpr (ParallelFirstTouch)
+                        touchParallel(elements, count);
+                    else
+                        construct(elements, 0, count);
+                }
+                catch (...)
+                {
+                    munmap(reinterpret_cast<void*>(aligned), length);
+                    throw;
+                }
+
+                return elements;
+#else
+                return new T[count]();
+#endif
+            }
+
+            /**
+             * @brief Destroys elements and releases buffer.
+             * @param elements Pointer to buffer.
+             * @param count Number of elements.
+             */
+            static void deallocate(T* elements, size_t count)
+            {
+                size_t bytes = count * sizeof(T);
+
+                if (!isMapped(bytes))
+                {
+                    delete[] elements;
+                    return;
+                }
+
+#if defined(__linux__)
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        elements[i].~T();
+                    }
+                }
+
+                munmap(static_cast<void*>(elements), roundUp(bytes, HugePageSize));
+#endif
+            }
+
+            /**
+             * @brief Checks whether buffer of given size is mapped instead of allocated by new[].
+             * @param bytes Size of buffer in bytes.
+             * @return True if buffer is backed by huge pages.
+             */
+            static constexpr bool isMapped(size_t bytes)
+            {
+#if defined(__linux__)
+                return bytes >= HugePageSize;
+#else
+                (void)bytes;
+                return false;
+#endif
+            }
+
+        private:
+            /**
+             * @brief Rounds value up to multiple of alignment.
+             */
+            static constexpr size_t roundUp(size_t value, size_t alignment)
+            {
+                return (value + alignment - 1) / alignment * alignment;
+            }
+
+            /**
+             * @brief Value-initializes elements of range in place, trivial elements are already zero.
+             * @param elements Pointer to buffer.
+             * @param from Index of first element.
+             * @param to Index past the last element.
+             */
+            static void construct(T* elements, size_t from, size_t to)
+            {
+                if constexpr (!std::is_trivially_default_constructible_v<T>)
+                {
+                    for (size_t i = from; i < to; i++)
+                    {
+                        new (elements + i) T();
+                    }
+                }
+            }
+
+            /**
+             * @brief Faults in pages of buffer by pinned threads, each owning contiguous whole huge pages.
+             *
+             * Pages of threads that cannot be started are touched by the calling thread without pinning it.
+             *
+             * @param elements Pointer to buffer.
+             * @param count Number of elements.
+             */
+            static void touchParallel(T* elements, size_t count)
+            {
+#if defined(__linux__)
+                size_t bytes = count * sizeof(T);
+                size_t pages = roundUp(bytes, HugePageSize) / HugePageSize;
+                size_t threadCount = std::min<size_t>(pages, std::max<size_t>(1, std::thread::hardware_concurrency()));
+                size_t pagesPerThread = (pages + threadCount - 1) / threadCount;
+
+                auto touch = [elements, count, bytes, pagesPerThread](size_t thread, bool pin)
+                {
+                    if (pin)
+                    {
+                        cpu_set_t cpus;
+                        CPU_ZERO(&cpus);
+                        CPU_SET(static_cast<int>(thread % CPU_SETSIZE), &cpus);
+                        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+                    }
+
+                    size_t firstByte = std::min(bytes, thread * pagesPerThread * HugePageSize);
+                    size_t lastByte = std::min(bytes, (thread + 1) * pagesPerThread * HugePageSize);
+                    unsigned char* memory = reinterpret_cast<unsigned char*>(elements);
+
+                    for (size_t offset = firstByte; offset < lastByte; offset += PageSize)
+                    {
+                        memory[offset] = 0;
+                    }
+
+                    size_t from = (firstByte + sizeof(T) - 1) / sizeof(T);
+                    size_t to = std::min(count, (lastByte + sizeof(T) - 1) / sizeof(T));
+
+                    construct(elements, from, to);
+                };
+
+                std::unique_ptr<std::thread[]> threads(new std::thread[threadCount]);
+                ThreadJoiner joiner(threads.get(), threadCount);
+                size_t started = 0;
+
+                try
+                {
+                    for (; started < threadCount; started++)
+                    {
+                        threads[started] = std::thread(touch, started, true);
+                    }
+                }
+                catch (const std::system_error&)
+                {
+                    for (size_t thread = started; thread < threadCount; thread++)
+                    {
+                        touch(thread, false);
+                    }
+                }
+
+                joiner.join();
+#else
+                construct(elements, 0, count);
+#endif
+            }
+    };
+}
@@ -0,0 +1,914 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/instrumentation.h>
+
+/**
+ * @brief Defines and registers benchmark function.
+ *
+ * Body receives `state` of type dsa::utility::benchmark::State. Code before `while (state.keepRunning())`
+ * is setup and is neither timed nor counted, body of the loop is the measured operation.
+ *
+ * @param group Name of benchmarked structure or algorithm.
+ * @param name Name of benchmarked operation.
+ */
+#define DSA_BENCHMARK(group, name)                                                                                  \
+    static void dsaBenchmark_##group##_##name(::dsa::utility::benchmark::State& state);                             \
+    static const bool dsaBenchmarkRegistered_##group##_##name =                                                     \
+        ::dsa::utility::benchmark::registerBenchmark(#group "/" #name, &dsaBenchmark_##group##_##name);             \
+    static void dsaBenchmark_##group##_##name(::dsa::utility::benchmark::State& state)
+
+namespace dsa::utility::benchmark
+{
+    /**
+     * @brief Named value reported by benchmark besides timing, e.g. compression ratio.
+     */
+    struct Counter
+    {
+        std::string name;               /// Name of counter.
+        double value = 0;               /// Value of counter.
+    };
+
+    /**
+     * @brief Measured result of single benchmark.
+     */
+    struct Result
+    {
+        std::string name;               /// Name of benchmark in form group/name.
+        size_t iterations = 0;          /// Number of iterations of measured run.
+        double nsPerOp = 0;             /// Nanoseconds per iteration, minimum over repetitions.
+        double allocationsPerOp = 0;    /// Container allocations per iteration.
+        double bytesPerOp = 0;          /// Bytes allocated by containers per iteration.
+        double gflops = 0;              /// Billions of floating point operations per second, 0 if not reported.
+        double gbps = 0;                /// Gigabytes processed per second, 0 if not reported.
+        bool deterministicAllocations = true;   /// False if allocation counts depend on scheduling or randomness.
+        dsa::structures::arrays::DynamicArray<Counter> counters;   /// Custom counters of benchmark.
+    };
+
+    /**
+     * @brief Results of benchmark run together with the build they were measured in.
+     */
+    struct Report
+    {
+        std::string build;              /// Build type, see getBuildType().
+        bool instrumented = false;      /// True if allocations were counted.
+        dsa::structures::arrays::DynamicArray<Result> results;     /// Results in registration order.
+    };
+
+    /**
+     * @brief Gets type of the running build. Times are comparable only between builds of the same type.
+     * @return "optimized" or "unoptimized".
+     */
+    inline std::string getBuildType()
+    {
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && defined(NDEBUG))
+        return "optimized";
+#else
+        return "unoptimized";
+#endif
+    }
+
+    /**
+     * @brief State of running benchmark, controls number of measured iterations.
+     */
+    class State
+    {
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            size_t mIterations;                         /// Number of iterations to run.
+            size_t mRemaining;                          /// Number of iterations not yet started.
+            bool mStarted;                              /// True once the first iteration was started.
+            Clock::time_point mStart;                   /// Time of first iteration start.
+            double mElapsedNs;                          /// Duration of all iterations in nanoseconds.
+            instrumentation::Statistics mBefore;        /// Global statistics before the first iteration.
+            instrumentation::Statistics mDelta;         /// Global statistics accumulated by all iterations.
+            double mFlopsPerOp;                         /// Floating point operations of one iteration.
+            double mBytesProcessedPerOp;                /// Bytes processed by one iteration.
+            bool mDeterministicAllocations;             /// False if allocation counts legitimately vary between runs.
+            dsa::structures::arrays::DynamicArray<Counter> mCounters;     /// Custom counters.
+
+        public:
+            /**
+             * @brief Constructs state for given number of iterations.
+             * @param iterations Number of iterations to run.
+             */
+            explicit State(size_t iterations)
+                : mIterations(iterations), mRemaining(iterations), mStarted(false), mStart(), mElapsedNs(0), mBefore(), mDelta(), mFlopsPerOp(0), mBytesProcessedPerOp(0), mDeterministicAllocations(true), mCounters() {}
+
+            /**
+             * @brief Starts next iteration. Starts measurement before first iteration and stops it after the last one.
+             * @return True while there are iterations to run.
+             */
+            bool keepRunning()
+            {
+                if (!this->mStarted)
+                {
+                    this->mStarted = true;
+                    this->mBefore = instrumentation::getGlobalStatistics();
+                    this->mStart = Clock::now();
+                }
+
+                if (this->mRemaining != 0)
+                {
+                    this->mRemaining--;
+                    return true;
+                }
+
+                Clock::time_point stop = Clock::now();
+
+                this->mDelta = instrumentation::getGlobalStatistics() - this->mBefore;
+                this->mElapsedNs = std::chrono::duration<double, std::nano>(stop - this->mStart).count();
+
+                return false;
+            }
+
+            /**
+             * @brief Returns the number of iterations of this run.
+             * @return Number of iterations.
+             */
+            size_t getIterations() const
+            {
+                return this->mIterations;
+            }
+
+            /**
+             * @brief Returns duration of all iterations, valid after keepRunning() returned false.
+             * @return Duration in nanoseconds.
+             */
+            double getElapsedNs() const
+            {
+                return this->mElapsedNs;
+            }
+
+            /**
+             * @brief Returns container statistics accumulated by all iterations.
+             * @return Statistics difference over the measured loop.
+             */
+            const instrumentation::Statistics& getStatistics() const
+            {
+                return this->mDelta;
+            }
+
+            /**
+             * @brief Declares floating point operations done by one iteration, result then reports GFLOP/s.
+             * @param flops Number of operations, e.g. 2 * n * n * n for multiply of n x n matrices.
+             */
+            void setFlopsPerOp(double flops)
+            {
+                this->mFlopsPerOp = flops;
+            }
+
+            /**
+             * @brief Returns floating point operations of one iteration.
+             * @return Number of operations, 0 if not declared.
+             */
+            double getFlopsPerOp() const
+            {
+                return this->mFlopsPerOp;
+            }
+
+            /**
+             * @brief Declares bytes processed by one iteration, result then reports GB/s.
+             * @param bytes Number of bytes, e.g. size of decoded output.
+             */
+            void setBytesProcessedPerOp(double bytes)
+            {
+                this->mBytesProcessedPerOp = bytes;
+            }
+
+            /**
+             * @brief Returns bytes processed by one iteration.
+             * @return Number of bytes, 0 if not declared.
+             */
+            double getBytesProcessedPerOp() const
+            {
+                return this->mBytesProcessedPerOp;
+            }
+
+            /**
+             * @brief Declares whether allocation counts are the same in every run.
+             *
+             * Benchmarks whose allocations depend on thread scheduling or random choices, e.g. heights of
+             * skip list towers, set false and are then not checked against baseline allocations.
+             *
+             * @param deterministic False if allocation counts vary between runs.
+             */
+            void setDeterministicAllocations(bool deterministic)
+            {
+                this->mDeterministicAllocations = deterministic;
+            }
+
+            /**
+             * @brief Checks whether allocation counts are the same in every run.
+             * @return False if benchmark declared varying allocations.
+             */
+            bool hasDeterministicAllocations() const
+            {
+                return this->mDeterministicAllocations;
+            }
+
+            /**
+             * @brief Reports named value with result, setting the same name again overwrites it.
+             * @param name Name of counter.
+             * @param value Value of counter.
+             */
+            void setCounter(const std::string& name, double value)
+            {
+                for (Counter& counter : this->mCounters)
+                {
+                    if (counter.name == name)
+                    {
+                        counter.value = value;
+                        return;
+                    }
+                }
+
+                Counter counter;
+
+                counter.name = name;
+                counter.value = value;
+
+                this->mCounters.addLast(counter);
+            }
+
+            /**
+             * @brief Returns custom counters.
+             * @return Counters in order of first setCounter() call.
+             */
+            const dsa::structures::arrays::DynamicArray<Counter>& getCounters() const
+            {
+                return this->mCounters;
+            }
+    };
+
+    /**
+     * @brief Registered benchmark.
+     */
+    struct Benchmark
+    {
+        const char* name = nullptr;             /// Name of benchmark in form group/name.
+        void (*function)(State&) = nullptr;     /// Benchmark function.
+    };
+
+    /**
+     * @brief Options of benchmark run.
+     */
+    struct Options
+    {
+        std::string filter;                 /// Only benchmarks whose name contains filter are run.
+        double minTimeMs = 20;              /// Minimal duration of measured run in milliseconds.
+        size_t repetitions = 5;             /// Number of measured runs, the fastest one is reported.
+        double tolerance = 1.0;             /// Allowed relative slowdown against baseline, 1.0 means twice as slow.
+        double allocationTolerance = 0;     /// Allowed relative increase of allocations and bytes against baseline.
+    };
+
+    /**
+     * @brief Gets list of all registered benchmarks.
+     * @return Reference to benchmark registry.
+     */
+    inline dsa::structures::arrays::DynamicArray<Benchmark>& getRegistry()
+    {
+        static dsa::structures::arrays::DynamicArray<Benchmark> registry;
+        return registry;
+    }
+
+    /**
+     * @brief Registers benchmark function, used by DSA_BENCHMARK.
+     * @param name Name of benchmark.
+     * @param function Benchmark function.
+     * @return Always true.
+     */
+    inline bool registerBenchmark(const char* name, void (*function)(State&))
+    {
+        Benchmark benchmark;
+
+        benchmark.name = name;
+        benchmark.function = function;
+
+        getRegistry().addLast(benchmark);
+
+        return true;
+    }
+
+    /**
+     * @brief Prevents compiler from optimizing away computation of value.
+     * @param value Value that must be computed.
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Runs single benchmark. Iteration count grows until one run lasts at least minTimeMs.
+     * @param benchmark Benchmark to run.
+     * @param options Options of run.
+     * @return Measured result.
+     */
+    inline Result run(const Benchmark& benchmark, const Options& options)
+    {
+        const double minTimeNs = options.minTimeMs * 1e6;
+        size_t iterations = 1;
+
+        while (true)
+        {
+            State state(iterations);
+            benchmark.function(state);
+
+            double elapsed = state.getElapsedNs();
+
+            if (elapsed >= minTimeNs || iterations >= 1000000000)
+                break;
+
+            double estimate = elapsed > 0 ? minTimeNs * 1.4 / elapsed * iterations : iterations * 100.0;
+            double next = std::min(std::max(estimate, iterations * 2.0), iterations * 100.0);
+
+            iterations = static_cast<size_t>(next);
+        }
+
+        Result result;
+
+        result.name = benchmark.name;
+        result.iterations = iterations;
+
+        for (size_t r = 0; r < options.repetitions; r++)
+        {
+            State state(iterations);
+            benchmark.function(state);
+
+            double nsPerOp = state.getElapsedNs() / iterations;
+
+            if (r == 0 || nsPerOp < result.nsPerOp)
+                result.nsPerOp = nsPerOp;
+
+            result.allocationsPerOp = static_cast<double>(state.getStatistics().allocations) / iterations;
+            result.bytesPerOp = static_cast<double>(state.getStatistics().bytesAllocated) / iterations;
+            result.gflops = state.getFlopsPerOp() / result.nsPerOp;
+            result.gbps = state.getBytesProcessedPerOp() / result.nsPerOp;
+            result.deterministicAllocations = state.hasDeterministicAllocations();
+            result.counters = state.getCounters();
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Runs all registered benchmarks matching filter of options.
+     * @param options Options of run.
+     * @return Results in registration order.
+     */
+    inline dsa::structures::arrays::DynamicArray<Result> runAll(const Options& options)
+    {
+        dsa::structures::arrays::DynamicArray<Result> results;
+
+        for (const Benchmark& benchmark : getRegistry())
+        {
+            if (std::string(benchmark.name).find(options.filter) == std::string::npos)
+                continue;
+
+            results.addLast(run(benchmark, options));
+        }
+
+        return results;
+    }
+
+    /**
+     * @brief Writes report as JSON document.
+     * @param os Output stream.
+     * @param report Report to write.
+     */
+    inline void writeJson(std::ostream& os, const Report& report)
+    {
+        const dsa::structures::arrays::DynamicArray<Result>& results = report.results;
+
+        os << "{\n";
+        os << "  \"build\": \"" << report.build << "\",\n";
+        os << "  \"instrumented\": " << (report.instrumented ? "true" : "false") << ",\n";
+        os << "  \"benchmarks\": [";
+
+        for (size_t i = 0; i < results.getSize(); i++)
+        {
+            const Result& result = results[i];
+
+            os << (i == 0 ? "\n" : ",\n");
+            os << "    {\"name\": \"" << result.name << "\", "
+               << "\"iterations\": " << result.iterations << ", "
+               << std::fixed << std::setprecision(3)
+               << "\"nsPerOp\": " << result.nsPerOp << ", "
+               << "\"allocationsPerOp\": " << result.allocationsPerOp << ", "
+               << "\"bytesPerOp\": " << result.bytesPerOp;
+
+            if (result.gflops > 0)
+                os << ", \"gflops\": " << result.gflops;
+
+            if (result.gbps > 0)
+                os << ", \"gbps\": " << result.gbps;
+
+            if (!result.deterministicAllocations)
+                os << ", \"deterministicAllocations\": false";
+
+            for (size_t c = 0; c < result.counters.getSize(); c++)
+            {
+                os << ", \"" << result.counters[c].name << "\": " << result.counters[c].value;
+            }
+
+            os << "}" << std::defaultfloat;
+        }
+
+        os << "\n  ]\n}\n";
+    }
+
+    /**
+     * @brief Minimal reader of JSON documents written by writeJson.
+     */
+    class JsonReader
+    {
+        private:
+            const std::string& mText;       /// Parsed document.
+            size_t mPosition;               /// Position of next unread character.
+
+        public:
+            /**
+             * @brief Constructs reader of document.
+             * @param text JSON document.
+             */
+            explicit JsonReader(const std::string& text) : mText(text), mPosition(0) {}
+
+            /**
+             * @brief Reads report from document.
+             * @return Report with results listed in "benchmarks" array, build is empty if not recorded.
+             * @throws std::runtime_error if document is malformed.
+             */
+            Report readReport()
+            {
+                Report report;
+
+                this->expect('{');
+
+                if (this->consume('}'))
+                    return report;
+
+                do
+                {
+                    std::string key = this->readString();
+                    this->expect(':');
+
+                    if (key == "build")
+                    {
+                        report.build = this->readString();
+                        continue;
+                    }
+
+                    if (key == "instrumented")
+                    {
+                        report.instrumented = this->readBoolean();
+                        continue;
+                    }
+
+                    if (key != "benchmarks")
+                    {
+                        this->skipValue();
+                        continue;
+                    }
+
+                    this->expect('[');
+
+                    if (this->consume(']'))
+                        continue;
+
+                    do
+                    {
+                        report.results.addLast(this->readResult());
+                    } while (this->consume(','));
+
+                    this->expect(']');
+                } while (this->consume(','));
+
+                this->expect('}');
+
+                return report;
+            }
+
+        private:
+            /**
+             * @brief Reads single result object.
+             * @return Parsed result.
+             */
+            Result readResult()
+            {
+                Result result;
+
+                this->expect('{');
+
+                if (this->consume('}'))
+                    return result;
+
+                do
+                {
+                    std::string key = this->readString();
+                    this->expect(':');
+
+                    if (key == "name")
+                        result.name = this->readString();
+                    else if (key == "iterations")
+                        result.iterations = static_cast<size_t>(this->readNumber());
+                    else if (key == "nsPerOp")
+                        result.nsPerOp = this->readNumber();
+                    else if (key == "allocationsPerOp")
+                        result.allocationsPerOp = this->readNumber();
+                    else if (key == "bytesPerOp")
+                        result.bytesPerOp = this->readNumber();
+                    else if (key == "gflops")
+                        result.gflops = this->readNumber();
+                    else if (key == "gbps")
+                        result.gbps = this->readNumber();
+                    else if (key == "deterministicAllocations")
+                        result.deterministicAllocations = this->readBoolean();
+                    else
+                        this->skipValue();
+                } while (this->consume(','));
+
+                this->expect('}');
+
+                return result;
+            }
+
+            /**
+             * @brief Skips any JSON value.
+             */
+            void skipValue()
+            {
+                char c = this->peek();
+
+                if (c == '"')
+                {
+                    this->readString();
+                }
+                else if (c == '{' || c == '[')
+                {
+                    char close = c == '{' ? '}' : ']';
+
+                    this->expect(c);
+
+                    if (this->consume(close))
+                        return;
+
+                    do
+                    {
+                        if (c == '{')
+                        {
+                            this->readString();
+                            this->expect(':');
+                        }
+
+                        this->skipValue();
+                    } while (this->consume(','));
+
+                    this->expect(close);
+                }
+                else if (c == '-' || std::isdigit(static_cast<unsigned char>(c)))
+                {
+                    this->readNumber();
+                }
+                else
+                {
+                    while (this->mPosition < this->mText.size() && std::isalpha(static_cast<unsigned char>(this->mText[this->mPosition])))
+                        this->mPosition++;
+                }
+            }
+
+            /**
+             * @brief Reads string literal.
+             * @return Unescaped string.
+             */
+            std::string readString()
+            {
+                this->expect('"');
+
+                std::string value;
+
+                while (this->mPosition < this->mText.size() && this->mText[this->mPosition] != '"')
+                {
+                    if (this->mText[this->mPosition] == '\\')
+                        this->mPosition++;
+
+                    if (this->mPosition < this->mText.size())
+                        value += this->mText[this->mPosition++];
+                }
+
+                this->expect('"');
+
+                return value;
+            }
+
+            /**
+             * @brief Reads number literal.
+             * @return Parsed number.
+             */
+            double readNumber()
+            {
+                this->peek();
+
+                const char* begin = this->mText.c_str() + this->mPosition;
+                char* end = nullptr;
+                double value = std::strtod(begin, &end);
+
+                if (end == begin)
+                    throw std::runtime_error("Expected number in benchmark JSON");
+
+                this->mPosition += static_cast<size_t>(end - begin);
+
+                return value;
+            }
+
+            /**
+             * @brief Reads true or false literal.
+             * @return Parsed value.
+             * @throws std::runtime_error if next value is not a boolean.
+             */
+            bool readBoolean()
+            {
+                this->peek();
+
+                if (this->mText.compare(this->mPosition, 4, "true") == 0)
+                {
+                    this->mPosition += 4;
+                    return true;
+                }
+
+                if (this->mText.compare(this->mPosition, 5, "false") == 0)
+                {
+                    this->mPosition += 5;
+                    return false;
+                }
+
+                throw std::runtime_error("Expected boolean in benchmark JSON");
+            }
+
+            /**
+             * @brief Skips whitespace and returns next character.
+             * @return Next character, '\0' at the end of document.
+             */
+            char peek()
+            {
+                while (this->mPosition < this->mText.size() && std::isspace(static_cast<unsigned char>(this->mText[this->mPosition])))
+                    this->mPosition++;
+
+                return this->mPosition < this->mText.size() ? this->mText[this->mPosition] : '\0';
+            }
+
+            /**
+             * @brief Consumes next character if it matches.
+             * @param c Expected character.
+             * @return True if character was consumed.
+             */
+            bool consume(char c)
+            {
+                if (this->peek() != c)
+                    return false;
+
+                this->mPosition++;
+                return true;
+            }
+
+            /**
+             * @brief Consumes next character.
+             * @param c Expected character.
+             * @throws std::runtime_error if next character differs.
+             */
+            void expect(char c)
+            {
+                if (!this->consume(c))
+                    throw std::runtime_error(std::string("Expected '") + c + "' in benchmark JSON");
+            }
+    };
+
+    /**
+     * @brief Reads report from JSON document written by writeJson.
+     * @param is Input stream with document.
+     * @return Parsed report.
+     * @throws std::runtime_error if document is malformed.
+     */
+    inline Report readJson(std::istream& is)
+    {
+        std::stringstream buffer;
+        buffer << is.rdbuf();
+
+        std::string text = buffer.str();
+
+        return JsonReader(text).readReport();
+    }
+
+    /**
+     * @brief Writes throughput and custom counters of result in report line.
+     * @param os Output stream.
+     * @param result Result to describe.
+     */
+    inline void writeMetrics(std::ostream& os, const Result& result)
+    {
+        if (result.gflops > 0)
+            os << "  " << result.gflops << " GFLOP/s";
+
+        if (result.gbps > 0)
+            os << "  " << result.gbps << " GB/s";
+
+        for (size_t i = 0; i < result.counters.getSize(); i++)
+        {
+            os << "  " << result.counters[i].name << "=" << result.counters[i].value;
+        }
+    }
+
+    /**
+     * @brief Compares results with baseline and reports differences.
+     *
+     * Time is a regression when it exceeds baseline by more than the tolerance. Absolute times only
+     * mean something on the machine and build type that recorded the baseline, so times are compared
+     * only when build types match and the baseline has to be recorded again on every other machine.
+     * Allocation counts and bytes are a regression when they exceed baseline by more than the
+     * allocation tolerance; they are compared only when both reports are instrumented and skipped
+     * for benchmarks declaring non-deterministic allocations. Benchmarks missing in baseline are
+     * reported as new.
+     *
+     * @param current Current report.
+     * @param baseline Baseline report.
+     * @param options Options with tolerances.
+     * @param os Output stream for report.
+     * @return True if no benchmark regressed.
+     */
+    inline bool compare(const Report& current, const Report& baseline, const Options& options, std::ostream& os)
+    {
+        const dsa::structures::arrays::DynamicArray<Result>& results = current.results;
+        bool comparesTime = current.build == baseline.build;
+        bool comparesAllocations = current.instrumented && baseline.instrumented;
+        bool passed = true;
+
+        if (!comparesTime)
+        {
+            os << "Baseline was recorded in " << (baseline.build.empty() ? "unknown" : baseline.build) << " build, this is "
+               << current.build << " build, times are not compared\n";
+        }
+
+        for (size_t i = 0; i < results.getSize(); i++)
+        {
+            const Result& result = results[i];
+            const Result* base = nullptr;
+
+            for (size_t j = 0; j < baseline.results.getSize(); j++)
+            {
+                if (baseline.results[j].name == result.name)
+                {
+                    base = &baseline.results[j];
+                    break;
+                }
+            }
+
+            os << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(1);
+
+            if (base == nullptr)
+            {
+                os << std::setw(12) << result.nsPerOp << " ns/op  NEW";
+                writeMetrics(os, result);
+                os << "\n" << std::defaultfloat;
+                continue;
+            }
+
+            double ratio = base->nsPerOp > 0 ? result.nsPerOp / base->nsPerOp : 1.0;
+            double allowed = 1.0 + options.allocationTolerance;
+            bool slower = comparesTime && ratio > 1.0 + options.tolerance;
+            bool allocates = comparesAllocations && result.deterministicAllocations && base->deterministicAllocations
+                && (result.allocationsPerOp > base->allocationsPerOp * allowed + 1e-6 || result.bytesPerOp > base->bytesPerOp * allowed + 1e-6);
+
+            os << std::setw(12) << result.nsPerOp << " ns/op " << std::setw(7) << std::setprecision(2) << ratio << "x";
+
+            writeMetrics(os, result);
+
+            if (slower)
+                os << "  REGRESSION (time)";
+
+            if (allocates)
+                os << "  REGRESSION (allocations " << base->allocationsPerOp << " -> " << result.allocationsPerOp << ")";
+
+            os << "\n" << std::defaultfloat;
+
+            passed = passed && !slower && !allocates;
+        }
+
+        return passed;
+    }
+
+    /**
+     * @brief Runs benchmarks according to command line arguments.
+     *
+     * Supported arguments are --filter <text>, --min-time <ms>, --repetitions <count>, --output <file>
+     * to write JSON results into file instead of standard output, --baseline <file> to compare results
+     * with baseline JSON, --tolerance <ratio> to set allowed slowdown against baseline and
+     * --allocation-tolerance <ratio> to set allowed increase of allocations against baseline.
+     *
+     * @param argc Number of arguments.
+     * @param argv Arguments, not including program name and mode switch.
+     * @return 0 on success, 1 if some benchmark regressed, 2 on invalid arguments or unreadable baseline.
+     */
+    inline int runFromCommandLine(int argc, char** argv)
+    {
+        Options options;
+        std::string output;
+        std::string baselinePath;
+
+        for (int i = 0; i < argc; i++)
+        {
+            std::string argument = argv[i];
+
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value of " << argument << "\n";
+                return 2;
+            }
+
+            std::string value = argv[++i];
+
+            if (argument == "--filter")
+                options.filter = value;
+            else if (argument == "--min-time")
+                options.minTimeMs = std::atof(value.c_str());
+            else if (argument == "--repetitions")
+                options.repetitions = std::max(1, std::atoi(value.c_str()));
+            else if (argument == "--tolerance")
+                options.tolerance = std::atof(value.c_str());
+            else if (argument == "--allocation-tolerance")
+                options.allocationTolerance = std::atof(value.c_str());
+            else if (argument == "--output")
+                output = value;
+            else if (argument == "--baseline")
+                baselinePath = value;
+            else
+            {
+                std::cerr << "Unknown argument " << argument << "\n";
+                return 2;
+            }
+        }
+
+        Report baseline;
+
+        if (!baselinePath.empty())
+        {
+            std::ifstream file(baselinePath);
+
+            if (!file)
+            {
+                std::cerr << "Cannot open baseline " << baselinePath << "\n";
+                return 2;
+            }
+
+            try
+            {
+                baseline = readJson(file);
+            }
+            catch (const std::runtime_error& error)
+            {
+                std::cerr << baselinePath << ": " << error.what() << "\n";
+                return 2;
+            }
+        }
+
+        Report current;
+
+        current.build = getBuildType();
+        current.instrumented = instrumentation::isEnabled();
+        current.results = runAll(options);
+
+        if (output.empty())
+        {
+            writeJson(std::cout, current);
+        }
+        else
+        {
+            std::ofstream file(output);
+            writeJson(file, current);
+        }
+
+        if (baselinePath.empty())
+            return 0;
+
+        std::ostream& report = output.empty() ? std::cerr : std::cout;
+
+        return compare(current, baseline, options, report) ? 0 : 1;
+    }
+}
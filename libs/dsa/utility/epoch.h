@@ -0,0 +1,227 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/per_thread_array.h>
+
+namespace dsa::utility
+{
+    /**
+     * @brief Epoch based reclamation of memory shared by lock-free data structures.
+     *
+     * Readers of a lock-free structure may still hold a pointer to a node that another thread has
+     * just unlinked, so the node cannot be deleted right away. Every operation runs inside a Guard
+     * that announces the global epoch it started in. Unlinked nodes are retired together with the
+     * epoch of retirement and the global epoch only advances once every active guard has seen the
+     * current one. Node retired in epoch e is therefore unreachable for all guards once global epoch
+     * reaches e + 2 and it is deleted then.
+     *
+     * Guards occupy one of fixed number of cache line padded participant slots, each slot owns its
+     * retired list, so retiring needs no synchronization.
+     */
+    class EpochManager
+    {
+        public:
+            static constexpr size_t DefaultParticipants = 64;   /// Default maximal number of simultaneous guards.
+            static constexpr size_t CollectInterval = 64;       /// Number of retirements between reclamation attempts.
+
+        private:
+            /**
+             * @brief Retired pointer waiting for reclamation.
+             */
+            struct Retired
+            {
+                void* pPointer;                 /// Retired object.
+                void (*pDeleter)(void*);        /// Function releasing the object.
+                uint64_t mEpoch;                /// Global epoch at retirement.
+            };
+
+            /**
+             * @brief State of one participant.
+             */
+            struct Participant
+            {
+                std::atomic<bool> mClaimed{false};                          /// True while a guard owns the slot.
+                std::atomic<uint64_t> mEpoch{0};                            /// Announced epoch, 0 if no guard is active.
+                dsa::structures::arrays::DynamicArray<Retired> mRetired;   /// Objects retired through the slot.
+            };
+
+            std::atomic<uint64_t> mEpoch;                                           /// Global epoch, starts at 1.
+            dsa::structures::arrays::PerThreadArray<Participant> mParticipants;     /// Participant slots.
+
+        public:
+            /**
+             * @brief Guard of one operation on shared structure, pointers read under the guard stay valid until it is destroyed.
+             */
+            class Guard
+            {
+                friend class EpochManager;
+
+                private:
+                    EpochManager* pManager;     /// Owning manager.
+                    Participant* pParticipant;  /// Claimed slot.
+
+                    /**
+                     * @brief Claims a free slot and announces current epoch.
+                     */
+                    explicit Guard(EpochManager* manager) : pManager(manager), pParticipant(manager->claim())
+                    {
+                        // Announcement must not lag behind an epoch advance that happened before it became visible.
+                        while (true)
+                        {
+                            uint64_t epoch = manager->mEpoch.load();
+
+                            this->pParticipant->mEpoch.store(epoch);
+
+                            if (manager->mEpoch.load() == epoch)
+                                break;
+                        }
+                    }
+
+                public:
+                    Guard(const Guard&) = delete;
+                    Guard& operator=(const Guard&) = delete;
+
+                    /**
+                     * @brief Destructor. Leaves the epoch and releases the slot.
+                     */
+                    ~Guard()
+                    {
+                        this->pParticipant->mEpoch.store(0, std::memory_order_release);
+                        this->pParticipant->mClaimed.store(false, std::memory_order_release);
+                    }
+
+                    /**
+                     * @brief Schedules object for deletion once no guard can reference it.
+                     * @param pointer Object already unlinked from shared structure.
+                     * @param deleter Function releasing the object.
+                     */
+                    void retire(void* pointer, void (*deleter)(void*))
+                    {
+                        dsa::structures::arrays::DynamicArray<Retired>& retired = this->pParticipant->mRetired;
+
+                        retired.addLast(Retired{pointer, deleter, this->pManager->mEpoch.load()});
+
+                        if (retired.getSize() % CollectInterval == 0)
+                        {
+                            this->pManager->tryAdvance();
+                            collect(retired, this->pManager->mEpoch.load());
+                        }
+                    }
+            };
+
+        public:
+            /**
+             * @brief Constructs manager.
+             * @param participants Maximal number of simultaneously active guards, further guards wait for a free slot.
+             */
+            explicit EpochManager(size_t participants = DefaultParticipants) : mEpoch(1), mParticipants(participants) {}
+
+            EpochManager(const EpochManager&) = delete;
+            EpochManager& operator=(const EpochManager&) = delete;
+
+            /**
+             * @brief Destructor. Releases all retired objects, no guard may be active.
+             */
+            ~EpochManager()
+            {
+                for (size_t i = 0; i < this->mParticipants.getSize(); i++)
+                {
+                    collect(this->mParticipants[i].mRetired, UINT64_MAX);
+                }
+            }
+
+            /**
+             * @brief Enters current epoch.
+             * @return Guard active until end of its scope.
+             */
+            Guard enter()
+            {
+                return Guard(this);
+            }
+
+            /**
+             * @brief Returns current global epoch.
+             * @return Epoch number.
+             */
+            uint64_t getEpoch() const
+            {
+                return this->mEpoch.load();
+            }
+
+            /**
+             * @brief Returns number of retired objects not yet released, call when no guard is active.
+             * @return Number of pending objects.
+             */
+            size_t getPendingCount() const
+            {
+                size_t count = 0;
+
+                for (size_t i = 0; i < this->mParticipants.getSize(); i++)
+                {
+                    count += this->mParticipants[i].mRetired.getSize();
+                }
+
+                return count;
+            }
+
+        private:
+            /**
+             * @brief Claims free participant slot, starting at slot derived from thread id.
+             */
+            Participant* claim()
+            {
+                size_t size = this->mParticipants.getSize();
+                size_t index = std::hash<std::thread::id>()(std::this_thread::get_id()) % size;
+
+                while (true)
+                {
+                    for (size_t i = 0; i < size; i++, index = index + 1 == size ? 0 : index + 1)
+                    {
+                        Participant& participant = this->mParticipants[index];
+
+                        if (!participant.mClaimed.load(std::memory_order_relaxed) && !participant.mClaimed.exchange(true, std::memory_order_acquire))
+                            return &participant;
+                    }
+
+                    std::this_thread::yield();
+                }
+            }
+
+            /**
+             * @brief Advances global epoch if every active guard announced the current one.
+             */
+            void tryAdvance()
+            {
+                uint64_t epoch = this->mEpoch.load();
+
+                for (size_t i = 0; i < this->mParticipants.getSize(); i++)
+                {
+                    uint64_t announced = this->mParticipants[i].mEpoch.load();
+
+                    if (announced != 0 && announced != epoch)
+                        return;
+                }
+
+                this->mEpoch.compare_exchange_strong(epoch, epoch + 1);
+            }
+
+            /**
+             * @brief Releases retired objects at least two epochs older than given epoch.
+             */
+            static void collect(dsa::structures::arrays::DynamicArray<Retired>& retired, uint64_t epoch)
+            {
+                retired.removeIf([epoch](const Retired& entry) {
+                    if (entry.mEpoch + 2 > epoch)
+                        return false;
+
+                    entry.pDeleter(entry.pPointer);
+                    return true;
+                });
+            }
+    };
+}
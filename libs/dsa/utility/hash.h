@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace dsa::utility
+{
+    /**
+     * @brief Scrambles 64-bit hash so that every input bit affects every output bit (MurmurHash3 finalizer).
+     *
+     * Standard library hashes of integers are often identity, which leaves consecutive keys in
+     * consecutive buckets and high bits unused. Structures that slice one hash into several indices
+     * mix it first.
+     *
+     * @param value Hash to mix.
+     * @return Mixed hash.
+     */
+    constexpr uint64_t mixHash(uint64_t value)
+    {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33;
+
+        return value;
+    }
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <dsa/utility/intrinsics.h>
+
+/**
+ * Instrumentation is opt-in. When DSA_INSTRUMENTATION is defined, containers report allocations,
+ * element copies, element moves and reallocations to counters kept separately for every container
+ * type. Without the definition every DSA_INSTRUMENT_* macro expands to an unevaluated expression
+ * and containers carry no overhead. The definition must be the same in every translation unit of a program.
+ * Macros are skipped during constant evaluation, so they may be used in constexpr functions.
+ */
+#if defined(DSA_INSTRUMENTATION)
+#define DSA_INSTRUMENT_ALLOCATION(Container, bytes) (::dsa::utility::isConstantEvaluated() ? (void)0 : ::dsa::utility::instrumentation::recordAllocation<Container>(bytes))
+#define DSA_INSTRUMENT_DEALLOCATION(Container, bytes) (::dsa::utility::isConstantEvaluated() ? (void)0 : ::dsa::utility::instrumentation::recordDeallocation<Container>(bytes))
+#define DSA_INSTRUMENT_COPIES(Container, count) (::dsa::utility::isConstantEvaluated() ? (void)0 : ::dsa::utility::instrumentation::recordCopies<Container>(count))
+#define DSA_INSTRUMENT_MOVES(Container, count) (::dsa::utility::isConstantEvaluated() ? (void)0 : ::dsa::utility::instrumentation::recordMoves<Container>(count))
+#define DSA_INSTRUMENT_REALLOCATION(Container) (::dsa::utility::isConstantEvaluated() ? (void)0 : ::dsa::utility::instrumentation::recordReallocation<Container>())
+#else
+#define DSA_INSTRUMENT_ALLOCATION(Container, bytes) ((void)sizeof(bytes))
+#define DSA_INSTRUMENT_DEALLOCATION(Container, bytes) ((void)sizeof(bytes))
+#define DSA_INSTRUMENT_COPIES(Container, count) ((void)sizeof(count))
+#define DSA_INSTRUMENT_MOVES(Container, count) ((void)sizeof(count))
+#define DSA_INSTRUMENT_REALLOCATION(Container) ((void)0)
+#endif
+
+namespace dsa::utility::instrumentation
+{
+    /**
+     * @brief Snapshot of instrumentation counters.
+     */
+    struct Statistics
+    {
+        size_t allocations = 0;         /// Number of buffer allocations.
+        size_t deallocations = 0;       /// Number of buffer deallocations.
+        size_t bytesAllocated = 0;      /// Total bytes of allocated buffers.
+        size_t bytesDeallocated = 0;    /// Total bytes of deallocated buffers.
+        size_t elementCopies = 0;       /// Number of elements copied.
+        size_t elementMoves = 0;        /// Number of elements moved.
+        size_t reallocations = 0;       /// Number of times existing elements were transferred to a new buffer.
+        size_t peakBytes = 0;           /// Largest total size of simultaneously live buffers since the last reset.
+
+        /**
+         * @brief Subtraction operator. Computes counter differences, useful for measuring a block of code.
+         *
+         * Peak is not a sum and is taken from this snapshot, see Counters::resetPeak().
+         *
+         * @param other Earlier snapshot.
+         * @return Statistics with differences of all counters.
+         */
+        Statistics operator-(const Statistics& other) const
+        {
+            Statistics result;
+
+            result.allocations = this->allocations - other.allocations;
+            result.deallocations = this->deallocations - other.deallocations;
+            result.bytesAllocated = this->bytesAllocated - other.bytesAllocated;
+            result.bytesDeallocated = this->bytesDeallocated - other.bytesDeallocated;
+            result.elementCopies = this->elementCopies - other.elementCopies;
+            result.elementMoves = this->elementMoves - other.elementMoves;
+            result.reallocations = this->reallocations - other.reallocations;
+            result.peakBytes = this->peakBytes;
+
+            return result;
+        }
+    };
+
+    /**
+     * @brief Thread-safe instrumentation counters.
+     */
+    class Counters
+    {
+        private:
+            std::atomic<size_t> mAllocations{0};          /// Number of buffer allocations.
+            std::atomic<size_t> mDeallocations{0};        /// Number of buffer deallocations.
+            std::atomic<size_t> mBytesAllocated{0};       /// Total bytes of allocated buffers.
+            std::atomic<size_t> mBytesDeallocated{0};     /// Total bytes of deallocated buffers.
+            std::atomic<size_t> mElementCopies{0};        /// Number of elements copied.
+            std::atomic<size_t> mElementMoves{0};         /// Number of elements moved.
+            std::atomic<size_t> mReallocations{0};        /// Number of reallocations.
+            std::atomic<size_t> mLiveBytes{0};            /// Total bytes of buffers not yet deallocated, never reset.
+            std::atomic<size_t> mPeakBytes{0};            /// Largest value of live bytes since the last reset.
+
+        public:
+            /**
+             * @brief Records buffer allocation.
+             * @param bytes Size of buffer in bytes.
+             */
+            void addAllocation(size_t bytes)
+            {
+                this->mAllocations.fetch_add(1, std::memory_order_relaxed);
+                this->mBytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+                size_t live = this->mLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+                size_t peak = this->mPeakBytes.load(std::memory_order_relaxed);
+
+                while (peak < live && !this->mPeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+            }
+
+            /**
+             * @brief Records buffer deallocation.
+             * @param bytes Size of buffer in bytes.
+             */
+            void addDeallocation(size_t bytes)
+            {
+                this->mDeallocations.fetch_add(1, std::memory_order_relaxed);
+                this->mBytesDeallocated.fetch_add(bytes, std::memory_order_relaxed);
+                this->mLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Records copied elements.
+             * @param count Number of elements.
+             */
+            void addCopies(size_t count)
+            {
+                this->mElementCopies.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Records moved elements.
+             * @param count Number of elements.
+             */
+            void addMoves(size_t count)
+            {
+                this->mElementMoves.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Records reallocation.
+             */
+            void addReallocation()
+            {
+                this->mReallocations.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Takes snapshot of all counters.
+             * @return Current values of counters.
+             */
+            Statistics getStatistics() const
+            {
+                Statistics statistics;
+
+                statistics.allocations = this->mAllocations.load(std::memory_order_relaxed);
+                statistics.deallocations = this->mDeallocations.load(std::memory_order_relaxed);
+                statistics.bytesAllocated = this->mBytesAllocated.load(std::memory_order_relaxed);
+                statistics.bytesDeallocated = this->mBytesDeallocated.load(std::memory_order_relaxed);
+                statistics.elementCopies = this->mElementCopies.load(std::memory_order_relaxed);
+                statistics.elementMoves = this->mElementMoves.load(std::memory_order_relaxed);
+                statistics.reallocations = this->mReallocations.load(std::memory_order_relaxed);
+                statistics.peakBytes = this->mPeakBytes.load(std::memory_order_relaxed);
+
+                return statistics;
+            }
+
+            /**
+             * @brief Starts measuring peak from buffers live now, e.g. before a block of code.
+             */
+            void resetPeak()
+            {
+                this->mPeakBytes.store(this->mLiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Sets all counters to zero. Peak restarts from buffers live now.
+             */
+            void reset()
+            {
+                this->mAllocations.store(0, std::memory_order_relaxed);
+                this->mDeallocations.store(0, std::memory_order_relaxed);
+                this->mBytesAllocated.store(0, std::memory_order_relaxed);
+                this->mBytesDeallocated.store(0, std::memory_order_relaxed);
+                this->mElementCopies.store(0, std::memory_order_relaxed);
+                this->mElementMoves.store(0, std::memory_order_relaxed);
+                this->mReallocations.store(0, std::memory_order_relaxed);
+                this->resetPeak();
+            }
+    };
+
+    /**
+     * @brief Checks whether instrumentation was compiled in.
+     * @return True if DSA_INSTRUMENTATION is defined.
+     */
+    constexpr bool isEnabled()
+    {
+#if defined(DSA_INSTRUMENTATION)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Gets counters shared by all container types.
+     * @return Reference to global counters.
+     */
+    inline Counters& getGlobalCounters()
+    {
+        static Counters counters;
+        return counters;
+    }
+
+    /**
+     * @brief Gets counters of specific container type.
+     * @tparam Container Container type, e.g. DynamicArray<int>.
+     * @return Reference to counters of container type.
+     */
+    template<typename Container>
+    Counters& getCounters()
+    {
+        static Counters counters;
+        return counters;
+    }
+
+    /**
+     * @brief Takes snapshot of counters of specific container type.
+     * @tparam Container Container type.
+     * @return Current statistics of container type.
+     */
+    template<typename Container>
+    Statistics getStatistics()
+    {
+        return getCounters<Container>().getStatistics();
+    }
+
+    /**
+     * @brief Takes snapshot of counters summed over all container types.
+     * @return Current global statistics.
+     */
+    inline Statistics getGlobalStatistics()
+    {
+        return getGlobalCounters().getStatistics();
+    }
+
+    /**
+     * @brief Records buffer allocation of container type.
+     * @tparam Container Container type.
+     * @param bytes Size of buffer in bytes.
+     */
+    template<typename Container>
+    void recordAllocation(size_t bytes)
+    {
+        getCounters<Container>().addAllocation(bytes);
+        getGlobalCounters().addAllocation(bytes);
+    }
+
+    /**
+     * @brief Records buffer deallocation of container type.
+     * @tparam Container Container type.
+     * @param bytes Size of buffer in bytes.
+     */
+    template<typename Container>
+    void recordDeallocation(size_t bytes)
+    {
+        getCounters<Container>().addDeallocation(bytes);
+        getGlobalCounters().addDeallocation(bytes);
+    }
+
+    /**
+     * @brief Records copied elements of container type.
+     * @tparam Container Container type.
+     * @param count Number of elements.
+     */
+    template<typename Container>
+    void recordCopies(size_t count)
+    {
+        getCounters<Container>().addCopies(count);
+        getGlobalCounters().addCopies(count);
+    }
+
+    /**
+     * @brief Records moved elements of container type.
+     * @tparam Container Container type.
+     * @param count Number of elements.
+     */
+    template<typename Container>
+    void recordMoves(size_t count)
+    {
+        getCounters<Container>().addMoves(count);
+        getGlobalCounters().addMoves(count);
+    }
+
+    /**
+     * @brief Records reallocation of container type.
+     * @tparam Container Container type.
+     */
+    template<typename Container>
+    void recordReallocation()
+    {
+        getCounters<Container>().addReallocation();
+        getGlobalCounters().addReallocation();
+    }
+}
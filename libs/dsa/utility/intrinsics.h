@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace dsa::utility
+{
+    /**
+     * @brief Detects whether the call is evaluated as part of a constant expression.
+     *
+     * Lets constexpr functions take a runtime-only path (memcpy, counters, intrinsics) when executed
+     * at runtime and a plain path during compile-time evaluation.
+     *
+     * @return True during constant evaluation.
+     */
+    constexpr bool isConstantEvaluated() noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+        return __builtin_is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Hints CPU to load cache line containing given address for reading.
+     * @param address Address to prefetch, may point outside of valid memory.
+     */
+    inline void prefetch(const void* address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    /**
+     * @brief Counts set bits of 64-bit word.
+     * @param value Word to inspect.
+     * @return Number of set bits.
+     */
+    inline unsigned popcount(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<unsigned>(__popcnt64(value));
+#else
+        value = value - ((value >> 1) & 0x5555555555555555ULL);
+        value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+        value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<unsigned>((value * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /**
+     * @brief Counts trailing zero bits of 64-bit word.
+     * @param value Word to inspect, must not be zero.
+     * @return Index of lowest set bit.
+     */
+    inline unsigned countTrailingZeros(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<unsigned>(index);
+#else
+        unsigned count = 0;
+
+        while ((value & 1) == 0)
+        {
+            value >>= 1;
+            count++;
+        }
+
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Counts leading zero bits of 64-bit word.
+     * @param value Word to inspect, must not be zero.
+     * @return Number of zero bits above highest set bit.
+     */
+    inline unsigned countLeadingZeros(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return 63 - static_cast<unsigned>(index);
+#else
+        unsigned count = 0;
+
+        while ((value & (uint64_t(1) << 63)) == 0)
+        {
+            value <<= 1;
+            count++;
+        }
+
+        return count;
+#endif
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <dsa/utility/intrinsics.h>
+
+namespace dsa::utility
+{
+    /**
+     * @brief Copies elements between non-overlapping ranges of constructed objects.
+     *
+     * Trivially copyable types are copied by a single memcpy, other types are copy assigned one by one.
+     * During constant evaluation elements are always assigned one by one.
+     *
+     * @param source Pointer to first source element.
+     * @param count Number of elements to copy.
+     * @param destination Pointer to first destination element.
+     */
+    template<typename T>
+    constexpr void copyElements(const T* source, size_t count, T* destination)
+    {
+        if (count == 0)
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (!isConstantEvaluated())
+            {
+                std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            destination[i] = source[i];
+        }
+    }
+
+    /**
+     * @brief Moves elements between non-overlapping ranges of constructed objects.
+     *
+     * Trivially copyable types are copied by a single memcpy, other types are move assigned one by one.
+     * During constant evaluation elements are always move assigned.
+     *
+     * @param source Pointer to first source element.
+     * @param count Number of elements to move.
+     * @param destination Pointer to first destination element.
+     */
+    template<typename T>
+    constexpr void moveElements(T* source, size_t count, T* destination)
+    {
+        if (count == 0)
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (!isConstantEvaluated())
+            {
+                std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            destination[i] = std::move(source[i]);
+        }
+    }
+
+    /**
+     * @brief Moves elements between possibly overlapping ranges of constructed objects within one buffer.
+     *
+     * Trivially copyable types are moved by a single memmove, other types are move assigned one by one
+     * in the direction that never overwrites an element before it is moved. During constant evaluation
+     * elements are always move assigned.
+     *
+     * @param source Pointer to first source element.
+     * @param count Number of elements to move.
+     * @param destination Pointer to first destination element.
+     */
+    template<typename T>
+    constexpr void shiftElements(T* source, size_t count, T* destination)
+    {
+        if (count == 0 || source == destination)
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (!isConstantEvaluated())
+            {
+                std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+                return;
+            }
+        }
+
+        if (destination < source)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                destination[i] = std::move(source[i]);
+            }
+        }
+        else
+        {
+            for (size_t i = count; i > 0; i--)
+            {
+                destination[i - 1] = std::move(source[i - 1]);
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/thread_joiner.h>
+
+namespace dsa::utility
+{
+    /**
+     * @brief Resolves requested number of threads.
+     * @param threadCount Requested number of threads, 0 for hardware concurrency.
+     * @return Number of threads, at least 1.
+     */
+    inline size_t resolveThreadCount(size_t threadCount)
+    {
+        return threadCount != 0 ? threadCount : std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief Gets number of chunks range should be split into.
+     * @param size Number of items.
+     * @param threadCount Number of threads, 0 for hardware concurrency.
+     * @param minimumChunk Smallest number of items worth a thread of its own.
+     * @return Number of chunks between 1 and thread count.
+     */
+    inline size_t getChunkCount(size_t size, size_t threadCount, size_t minimumChunk)
+    {
+        return std::max<size_t>(1, std::min(resolveThreadCount(threadCount), size / std::max<size_t>(1, minimumChunk)));
+    }
+
+    /**
+     * @brief Splits range [0, size) into contiguous chunks of nearly equal size, each processed by its own thread.
+     *
+     * The calling thread processes chunk 0 and joins the rest, so a single chunk runs without
+     * starting any thread. Started threads are joined even if starting another thread or a chunk
+     * throws, and the exception is rethrown once every chunk has finished.
+     *
+     * @param size Number of items.
+     * @param chunkCount Number of chunks, see getChunkCount().
+     * @param function Callable taking begin and end of chunk and index of chunk.
+     * @throws Exception thrown by function for the lowest failing chunk, or std::system_error if a thread cannot be started.
+     */
+    template<typename Function>
+    void parallelFor(size_t size, size_t chunkCount, Function function)
+    {
+        chunkCount = std::max<size_t>(1, chunkCount);
+
+        dsa::structures::arrays::DynamicArray<std::thread> threads(chunkCount - 1);
+        dsa::structures::arrays::DynamicArray<std::exception_ptr> errors(chunkCount - 1);
+        auto runChunk = [&function, size, chunkCount](size_t chunk)
+        {
+            function(size * chunk / chunkCount, size * (chunk + 1) / chunkCount, chunk);
+        };
+
+        {
+            ThreadJoiner joiner(threads.getData(), threads.getSize());
+
+            for (size_t chunk = 1; chunk < chunkCount; chunk++)
+            {
+                threads[chunk - 1] = std::thread([&runChunk, &errors, chunk]()
+                {
+                    try
+                    {
+                        runChunk(chunk);
+                    }
+                    catch (...)
+                    {
+                        errors[chunk - 1] = std::current_exception();
+                    }
+                });
+            }
+
+            runChunk(0);
+        }
+
+        for (size_t chunk = 1; chunk < chunkCount; chunk++)
+        {
+            if (errors[chunk - 1])
+                std::rethrow_exception(errors[chunk - 1]);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+namespace dsa::utility
+{
+    /**
+     * @brief Joins started threads when leaving scope, so threads are never destroyed joinable during stack unwinding.
+     *
+     * Joiner depends on no container, so it can be used by allocation policies that containers themselves depend on.
+     */
+    class ThreadJoiner
+    {
+        private:
+            std::thread* pThreads;      /// Pointer to first thread.
+            size_t mCount;              /// Number of threads.
+
+        public:
+            /**
+             * @brief Constructs joiner of given threads.
+             * @param threads Pointer to first thread, threads may be started later.
+             * @param count Number of threads.
+             */
+            ThreadJoiner(std::thread* threads, size_t count) : pThreads(threads), mCount(count) {}
+
+            ThreadJoiner(const ThreadJoiner&) = delete;
+            ThreadJoiner& operator=(const ThreadJoiner&) = delete;
+
+            /**
+             * @brief Destructor. Joins every thread that is still joinable.
+             */
+            ~ThreadJoiner()
+            {
+                this->join();
+            }
+
+            /**
+             * @brief Joins every thread that is still joinable.
+             */
+            void join()
+            {
+                for (size_t i = 0; i < this->mCount; i++)
+                {
+                    if (this->pThreads[i].joinable())
+                        this->pThreads[i].join();
+                }
+            }
+    };
+}
@@ -0,0 +1,570 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+
+/**
+ * Lazy views over contiguous containers (DynamicArray, StaticArray, InplaceVector or any type with
+ * getData() and getSize()). Views are composed with operator| and do no work until iterated, so a
+ * chain like array | map(f) | filter(p) | take(n) runs as one loop over the source without
+ * intermediate arrays. Nothing is allocated until collect() materializes the result. Views refer to
+ * source containers, which must outlive them.
+ */
+namespace dsa::views
+{
+    namespace detail
+    {
+        /**
+         * @brief Base of all views, marks types that can be composed without wrapping.
+         */
+        struct ViewBase {};
+
+        /**
+         * @brief Base of all view adapters accepted on the right side of operator|.
+         */
+        struct AdapterBase {};
+
+        template<typename Type>
+        constexpr bool IsView = std::is_base_of_v<ViewBase, std::decay_t<Type>>;
+
+        template<typename Type>
+        constexpr bool IsAdapter = std::is_base_of_v<AdapterBase, std::decay_t<Type>>;
+
+        /**
+         * @brief View over elements of contiguous container.
+         * @tparam T Type of elements, const qualified for const containers.
+         */
+        template<typename T>
+        class ContiguousView : public ViewBase
+        {
+            private:
+                T* pBegin;      /// Pointer to first element.
+                T* pEnd;        /// Pointer past the last element.
+
+            public:
+                using ValueType = std::remove_const_t<T>;
+                using Iterator = T*;
+
+            public:
+                ContiguousView(T* begin, T* end) : pBegin(begin), pEnd(end) {}
+
+                Iterator begin() const
+                {
+                    return this->pBegin;
+                }
+
+                Iterator end() const
+                {
+                    return this->pEnd;
+                }
+        };
+
+        /**
+         * @brief Wraps container into view, views are passed through unchanged.
+         * @param range Container with getData() and getSize(), or view.
+         * @return View over range.
+         */
+        template<typename Range>
+        auto toView(Range& range)
+        {
+            if constexpr (IsView<Range>)
+            {
+                return range;
+            }
+            else
+            {
+                auto* data = range.getData();
+
+                return ContiguousView<std::remove_pointer_t<decltype(data)>>(data, data + range.getSize());
+            }
+        }
+
+        /**
+         * @brief Passes temporary views through, temporary containers are rejected as they would dangle.
+         */
+        template<typename Range, typename = std::enable_if_t<!std::is_lvalue_reference_v<Range>>>
+        auto toView(Range&& range)
+        {
+            static_assert(IsView<Range>, "Views cannot refer to temporary containers");
+
+            return std::move(range);
+        }
+
+        template<typename View>
+        using IteratorOf = typename std::decay_t<View>::Iterator;
+
+        template<typename Iterator>
+        using ReferenceOf = decltype(*std::declval<Iterator&>());
+
+        /**
+         * @brief View applying function to every element of inner view.
+         */
+        template<typename Inner, typename Function>
+        class MapView : public ViewBase
+        {
+            private:
+                using InnerIterator = IteratorOf<Inner>;
+
+                Inner mInner;               /// Underlying view.
+                Function mFunction;         /// Applied function.
+
+            public:
+                using ValueType = std::decay_t<std::invoke_result_t<const Function&, ReferenceOf<InnerIterator>>>;
+
+                /**
+                 * @brief Iterator calling function on dereference.
+                 */
+                class Iterator
+                {
+                    private:
+                        InnerIterator mInner;           /// Position in underlying view.
+                        const Function* pFunction;      /// Applied function.
+
+                    public:
+                        Iterator(InnerIterator inner, const Function* function) : mInner(inner), pFunction(function) {}
+
+                        decltype(auto) operator*() const
+                        {
+                            return (*this->pFunction)(*this->mInner);
+                        }
+
+                        Iterator& operator++()
+                        {
+                            ++this->mInner;
+                            return *this;
+                        }
+
+                        bool operator!=(const Iterator& other) const
+                        {
+                            return this->mInner != other.mInner;
+                        }
+                };
+
+            public:
+                MapView(Inner inner, Function function) : mInner(std::move(inner)), mFunction(std::move(function)) {}
+
+                Iterator begin() const
+                {
+                    return Iterator(this->mInner.begin(), &this->mFunction);
+                }
+
+                Iterator end() const
+                {
+                    return Iterator(this->mInner.end(), &this->mFunction);
+                }
+        };
+
+        /**
+         * @brief View skipping elements of inner view not satisfying predicate.
+         */
+        template<typename Inner, typename Predicate>
+        class FilterView : public ViewBase
+        {
+            private:
+                using InnerIterator = IteratorOf<Inner>;
+
+                Inner mInner;               /// Underlying view.
+                Predicate mPredicate;       /// Predicate selecting elements.
+
+            public:
+                using ValueType = typename std::decay_t<Inner>::ValueType;
+
+                /**
+                 * @brief Iterator advancing to next element satisfying predicate.
+                 */
+                class Iterator
+                {
+                    private:
+                        InnerIterator mInner;           /// Position in underlying view.
+                        InnerIterator mEnd;             /// End of underlying view.
+                        const Predicate* pPredicate;    /// Predicate selecting elements.
+
+                        void skip()
+                        {
+                            while (this->mInner != this->mEnd && !(*this->pPredicate)(*this->mInner))
+                                ++this->mInner;
+                        }
+
+                    public:
+                        Iterator(InnerIterator inner, InnerIterator end, const Predicate* predicate) : mInner(inner), mEnd(end), pPredicate(predicate)
+                        {
+                            this->skip();
+                        }
+
+                        decltype(auto) operator*() const
+                        {
+                            return *this->mInner;
+                        }
+
+                        Iterator& operator++()
+                        {
+                            ++this->mInner;
+                            this->skip();
+                            return *this;
+                        }
+
+                        bool operator!=(const Iterator& other) const
+                        {
+                            return this->mInner != other.mInner;
+                        }
+                };
+
+            public:
+                FilterView(Inner inner, Predicate predicate) : mInner(std::move(inner)), mPredicate(std::move(predicate)) {}
+
+                Iterator begin() const
+                {
+                    return Iterator(this->mInner.begin(), this->mInner.end(), &this->mPredicate);
+                }
+
+                Iterator end() const
+                {
+                    return Iterator(this->mInner.end(), this->mInner.end(), &this->mPredicate);
+                }
+        };
+
+        /**
+         * @brief View of at most count first elements of inner view.
+         */
+        template<typename Inner>
+        class TakeView : public ViewBase
+        {
+            private:
+                using InnerIterator = IteratorOf<Inner>;
+
+                Inner mInner;               /// Underlying view.
+                size_t mCount;              /// Maximal number of elements.
+
+            public:
+                using ValueType = typename std::decay_t<Inner>::ValueType;
+
+                /**
+                 * @brief Iterator counting remaining elements.
+                 */
+                class Iterator
+                {
+                    private:
+                        InnerIterator mInner;           /// Position in underlying view.
+                        InnerIterator mEnd;             /// End of underlying view.
+                        size_t mRemaining;              /// Number of elements left to take.
+
+                        bool isDone() const
+                        {
+                            return this->mRemaining == 0 || !(this->mInner != this->mEnd);
+                        }
+
+                    public:
+                        Iterator(InnerIterator inner, InnerIterator end, size_t remaining) : mInner(inner), mEnd(end), mRemaining(remaining) {}
+
+                        decltype(auto) operator*() const
+                        {
+                            return *this->mInner;
+                        }
+
+                        Iterator& operator++()
+                        {
+                            ++this->mInner;
+                            --this->mRemaining;
+                            return *this;
+                        }
+
+                        bool operator!=(const Iterator& other) const
+                        {
+                            if (this->isDone() || other.isDone())
+                                return this->isDone() != other.isDone();
+
+                            return this->mInner != other.mInner;
+                        }
+                };
+
+            public:
+                TakeView(Inner inner, size_t count) : mInner(std::move(inner)), mCount(count) {}
+
+                Iterator begin() const
+                {
+                    return Iterator(this->mInner.begin(), this->mInner.end(), this->mCount);
+                }
+
+                Iterator end() const
+                {
+                    return Iterator(this->mInner.end(), this->mInner.end(), 0);
+                }
+        };
+
+        /**
+         * @brief View of pairs of elements at the same position of two views, as long as the shorter one.
+         */
+        template<typename First, typename Second>
+        class ZipView : public ViewBase
+        {
+            private:
+                using FirstIterator = IteratorOf<First>;
+                using SecondIterator = IteratorOf<Second>;
+
+                First mFirst;               /// First underlying view.
+                Second mSecond;             /// Second underlying view.
+
+            public:
+                using ValueType = std::pair<typename std::decay_t<First>::ValueType, typename std::decay_t<Second>::ValueType>;
+
+                /**
+                 * @brief Iterator advancing both views together.
+                 */
+                class Iterator
+                {
+                    private:
+                        FirstIterator mFirst;           /// Position in first view.
+                        SecondIterator mSecond;         /// Position in second view.
+
+                    public:
+                        Iterator(FirstIterator first, SecondIterator second) : mFirst(first), mSecond(second) {}
+
+                        std::pair<ReferenceOf<FirstIterator>, ReferenceOf<SecondIterator>> operator*() const
+                        {
+                            return std::pair<ReferenceOf<FirstIterator>, ReferenceOf<SecondIterator>>(*this->mFirst, *this->mSecond);
+                        }
+
+                        Iterator& operator++()
+                        {
+                            ++this->mFirst;
+                            ++this->mSecond;
+                            return *this;
+                        }
+
+                        bool operator!=(const Iterator& other) const
+                        {
+                            return this->mFirst != other.mFirst && this->mSecond != other.mSecond;
+                        }
+                };
+
+            public:
+                ZipView(First first, Second second) : mFirst(std::move(first)), mSecond(std::move(second)) {}
+
+                Iterator begin() const
+                {
+                    return Iterator(this->mFirst.begin(), this->mSecond.begin());
+                }
+
+                Iterator end() const
+                {
+                    return Iterator(this->mFirst.end(), this->mSecond.end());
+                }
+        };
+
+        /**
+         * @brief View of pairs of position and element of inner view.
+         */
+        template<typename Inner>
+        class EnumerateView : public ViewBase
+        {
+            private:
+                using InnerIterator = IteratorOf<Inner>;
+
+                Inner mInner;               /// Underlying view.
+
+            public:
+                using ValueType = std::pair<size_t, typename std::decay_t<Inner>::ValueType>;
+
+                /**
+                 * @brief Iterator counting positions.
+                 */
+                class Iterator
+                {
+                    private:
+                        InnerIterator mInner;           /// Position in underlying view.
+                        size_t mIndex;                  /// Index of current element.
+
+                    public:
+                        Iterator(InnerIterator inner, size_t index) : mInner(inner), mIndex(index) {}
+
+                        std::pair<size_t, ReferenceOf<InnerIterator>> operator*() const
+                        {
+                            return std::pair<size_t, ReferenceOf<InnerIterator>>(this->mIndex, *this->mInner);
+                        }
+
+                        Iterator& operator++()
+                        {
+                            ++this->mInner;
+                            ++this->mIndex;
+                            return *this;
+                        }
+
+                        bool operator!=(const Iterator& other) const
+                        {
+                            return this->mInner != other.mInner;
+                        }
+                };
+
+            public:
+                explicit EnumerateView(Inner inner) : mInner(std::move(inner)) {}
+
+                Iterator begin() const
+                {
+                    return Iterator(this->mInner.begin(), 0);
+                }
+
+                Iterator end() const
+                {
+                    return Iterator(this->mInner.end(), 0);
+                }
+        };
+
+        /**
+         * @brief Adapter creating MapView.
+         */
+        template<typename Function>
+        struct MapAdapter : AdapterBase
+        {
+            Function mFunction;     /// Applied function.
+
+            template<typename View>
+            auto apply(View view) const
+            {
+                return MapView<View, Function>(std::move(view), this->mFunction);
+            }
+        };
+
+        /**
+         * @brief Adapter creating FilterView.
+         */
+        template<typename Predicate>
+        struct FilterAdapter : AdapterBase
+        {
+            Predicate mPredicate;   /// Predicate selecting elements.
+
+            template<typename View>
+            auto apply(View view) const
+            {
+                return FilterView<View, Predicate>(std::move(view), this->mPredicate);
+            }
+        };
+
+        /**
+         * @brief Adapter creating TakeView.
+         */
+        struct TakeAdapter : AdapterBase
+        {
+            size_t mCount;          /// Maximal number of elements.
+
+            template<typename View>
+            auto apply(View view) const
+            {
+                return TakeView<View>(std::move(view), this->mCount);
+            }
+        };
+
+        /**
+         * @brief Adapter creating EnumerateView.
+         */
+        struct EnumerateAdapter : AdapterBase
+        {
+            template<typename View>
+            auto apply(View view) const
+            {
+                return EnumerateView<View>(std::move(view));
+            }
+        };
+
+        /**
+         * @brief Adapter materializing view into DynamicArray.
+         */
+        struct CollectAdapter : AdapterBase
+        {
+            template<typename View>
+            auto apply(const View& view) const
+            {
+                using ValueType = typename View::ValueType;
+
+                dsa::structures::arrays::DynamicArray<ValueType> result;
+
+                for (auto&& value : view)
+                {
+                    if (result.getSize() == result.getCapacity())
+                        result.reserve(result.getCapacity() == 0 ? 16 : result.getCapacity() * 2);
+
+                    result.addLast(ValueType(std::forward<decltype(value)>(value)));
+                }
+
+                return result;
+            }
+        };
+        /**
+         * @brief Applies adapter to container or view, found by argument dependent lookup on adapter.
+         * @param range Container with getData() and getSize(), or view.
+         * @param adapter Adapter created by map, filter, take, enumerate or collect.
+         * @return New view, or DynamicArray for collect.
+         */
+        template<typename Range, typename Adapter, typename = std::enable_if_t<IsAdapter<Adapter>>>
+        auto operator|(Range&& range, const Adapter& adapter)
+        {
+            return adapter.apply(toView(std::forward<Range>(range)));
+        }
+    }
+
+    /**
+     * @brief Creates adapter transforming every element by function.
+     * @param function Callable taking element and returning transformed value.
+     * @return Adapter for operator|.
+     */
+    template<typename Function>
+    detail::MapAdapter<Function> map(Function function)
+    {
+        return detail::MapAdapter<Function>{{}, std::move(function)};
+    }
+
+    /**
+     * @brief Creates adapter keeping only elements satisfying predicate.
+     * @param predicate Callable taking element and returning bool.
+     * @return Adapter for operator|.
+     */
+    template<typename Predicate>
+    detail::FilterAdapter<Predicate> filter(Predicate predicate)
+    {
+        return detail::FilterAdapter<Predicate>{{}, std::move(predicate)};
+    }
+
+    /**
+     * @brief Creates adapter keeping at most count first elements.
+     * @param count Maximal number of elements.
+     * @return Adapter for operator|.
+     */
+    inline detail::TakeAdapter take(size_t count)
+    {
+        return detail::TakeAdapter{{}, count};
+    }
+
+    /**
+     * @brief Creates adapter pairing every element with its position.
+     * @return Adapter for operator|.
+     */
+    inline detail::EnumerateAdapter enumerate()
+    {
+        return detail::EnumerateAdapter{};
+    }
+
+    /**
+     * @brief Creates adapter copying elements of view into new DynamicArray, the only step that allocates.
+     * @return Adapter for operator|.
+     */
+    inline detail::CollectAdapter collect()
+    {
+        return detail::CollectAdapter{};
+    }
+
+    /**
+     * @brief Creates view of pairs of elements at the same positions, as long as the shorter range.
+     * @param first First container or view.
+     * @param second Second container or view.
+     * @return Zipped view.
+     */
+    template<typename First, typename Second>
+    auto zip(First&& first, Second&& second)
+    {
+        auto firstView = detail::toView(std::forward<First>(first));
+        auto secondView = detail::toView(std::forward<Second>(second));
+
+        return detail::ZipView<decltype(firstView), decltype(secondView)>(std::move(firstView), std::move(secondView));
+    }
+}
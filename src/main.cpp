@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <gtest/gtest.h>
+#include <dsa/utility/benchmark.h>
 
 int main(int argc, char** argv)
 {
@@ -35,4 +36,7 @@ int main(int argc, char** argv)
         ::testing::InitGoogleTest(&argc, argv);
         return RUN_ALL_TESTS();
     }
+
+    if (argc > 1 && std::string(argv[1]) == "--bench")
+        return dsa::utility::benchmark::runFromCommandLine(argc - 2, argv + 2);
 }
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+#include <dsa/algorithms/graphs/breadth_first_search.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+#include "../../structures/graphs/random_edges.h"
+
+using namespace dsa::algorithms::graphs;
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::graphs::CsrGraph;
+
+class BreadthFirstSearchTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+
+        static std::vector<uint32_t> naiveSearch(const CsrGraph& graph, uint32_t source)
+        {
+            std::vector<uint32_t> distances(graph.getVertexCount(), Unreachable);
+            std::queue<uint32_t> queue;
+
+            distances[source] = 0;
+            queue.push(source);
+
+            while (!queue.empty())
+            {
+                uint32_t vertex = queue.front();
+                queue.pop();
+
+                for (size_t i = 0; i < graph.getDegree(vertex); i++)
+                {
+                    uint32_t neighbor = graph.getNeighbors(vertex)[i];
+
+                    if (distances[neighbor] == Unreachable)
+                    {
+                        distances[neighbor] = distances[vertex] + 1;
+                        queue.push(neighbor);
+                    }
+                }
+            }
+
+            return distances;
+        }
+
+        static void expectDistances(DynamicArray<uint32_t> distances, const std::vector<uint32_t>& expected)
+        {
+            ASSERT_EQ(distances.getSize(), expected.size());
+
+            for (size_t v = 0; v < expected.size(); v++)
+            {
+                ASSERT_EQ(distances[v], expected[v]) << "vertex " << v;
+            }
+        }
+};
+
+TEST_F(BreadthFirstSearchTest, PathAndUnreachableVertices)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = {{0, 1}, {1, 2}, {2, 3}, {5, 4}};
+    CsrGraph graph(6, edges);
+
+    expectDistances(breadthFirstSearch(graph, 0), {0, 1, 2, 3, Unreachable, Unreachable});
+    expectDistances(breadthFirstSearch(graph, graph.transpose(), 0), {0, 1, 2, 3, Unreachable, Unreachable});
+    expectDistances(breadthFirstSearch(CsrGraph(6, edges, true), 4), {Unreachable, Unreachable, Unreachable, Unreachable, 0, 1});
+}
+
+TEST_F(BreadthFirstSearchTest, InvalidSourceThrows)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = {{0, 1}};
+    CsrGraph graph(2, edges);
+
+    EXPECT_THROW(breadthFirstSearch(graph, 2), std::out_of_range);
+    EXPECT_THROW(breadthFirstSearch(graph, CsrGraph(), 0), std::invalid_argument);
+}
+
+TEST_F(BreadthFirstSearchTest, UndirectedMatchesNaiveSearch)
+{
+    constexpr size_t vertexCount = 5000;
+    CsrGraph graph(vertexCount, makeEdges(vertexCount, 20000, 3), true);
+
+    for (uint32_t source : {0u, 17u, 4999u})
+    {
+        std::vector<uint32_t> expected = naiveSearch(graph, source);
+
+        for (size_t threadCount : {1, 4})
+        {
+            expectDistances(breadthFirstSearch(graph, source, threadCount), expected);
+        }
+    }
+}
+
+TEST_F(BreadthFirstSearchTest, DirectedMatchesNaiveSearch)
+{
+    constexpr size_t vertexCount = 5000;
+    CsrGraph graph(vertexCount, makeEdges(vertexCount, 30000, 4));
+    CsrGraph transposed = graph.transpose();
+
+    for (uint32_t source : {0u, 123u})
+    {
+        std::vector<uint32_t> expected = naiveSearch(graph, source);
+
+        for (size_t threadCount : {1, 4})
+        {
+            expectDistances(breadthFirstSearch(graph, source, threadCount), expected);
+            expectDistances(breadthFirstSearch(graph, transposed, source, threadCount), expected);
+        }
+    }
+}
+
+TEST_F(BreadthFirstSearchTest, LargeGraphMatchesNaiveSearch)
+{
+    constexpr size_t vertexCount = 1 << 18;
+    CsrGraph graph(vertexCount, makeEdges(vertexCount, 1 << 20, 5), true, 4);
+    std::vector<uint32_t> expected = naiveSearch(graph, 1);
+
+    expectDistances(breadthFirstSearch(graph, 1, 4), expected);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <dsa/algorithms/graphs/connected_components.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+#include "../../structures/graphs/random_edges.h"
+
+using namespace dsa::algorithms::graphs;
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::graphs::CsrGraph;
+
+class ConnectedComponentsTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+
+        static uint32_t find(std::vector<uint32_t>& parents, uint32_t vertex)
+        {
+            while (parents[vertex] != vertex)
+            {
+                vertex = parents[vertex] = parents[parents[vertex]];
+            }
+
+            return vertex;
+        }
+
+        static std::vector<uint32_t> naiveComponents(size_t vertexCount, DynamicArray<CsrGraph::EdgeType>& edges)
+        {
+            std::vector<uint32_t> parents(vertexCount);
+            std::iota(parents.begin(), parents.end(), 0);
+
+            for (size_t i = 0; i < edges.getSize(); i++)
+            {
+                uint32_t first = find(parents, edges[i].first);
+                uint32_t second = find(parents, edges[i].second);
+                parents[std::max(first, second)] = std::min(first, second);
+            }
+
+            for (size_t v = 0; v < vertexCount; v++)
+            {
+                parents[v] = find(parents, static_cast<uint32_t>(v));
+            }
+
+            return parents;
+        }
+
+        static void expectLabels(DynamicArray<uint32_t> labels, const std::vector<uint32_t>& expected)
+        {
+            ASSERT_EQ(labels.getSize(), expected.size());
+
+            for (size_t v = 0; v < expected.size(); v++)
+            {
+                ASSERT_EQ(labels[v], expected[v]) << "vertex " << v;
+            }
+        }
+};
+
+TEST_F(ConnectedComponentsTest, EmptyGraph)
+{
+    EXPECT_EQ(connectedComponents(CsrGraph()).getSize(), 0);
+}
+
+TEST_F(ConnectedComponentsTest, LabelsAreSmallestVertices)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = {{4, 2}, {2, 6}, {5, 1}, {3, 3}};
+
+    expectLabels(connectedComponents(CsrGraph(7, edges, true)), {0, 1, 2, 3, 2, 1, 2});
+    expectLabels(connectedComponents(CsrGraph(7, edges)), {0, 1, 2, 3, 2, 1, 2});
+}
+
+TEST_F(ConnectedComponentsTest, RandomGraphsMatchNaiveUnionFind)
+{
+    constexpr size_t vertexCount = 20000;
+
+    for (size_t edgeCount : {5000, 10000, 40000})
+    {
+        DynamicArray<CsrGraph::EdgeType> edges = makeEdges(vertexCount, edgeCount, static_cast<unsigned>(edgeCount));
+        std::vector<uint32_t> expected = naiveComponents(vertexCount, edges);
+
+        for (bool undirected : {false, true})
+        {
+            CsrGraph graph(vertexCount, edges, undirected);
+
+            for (size_t threadCount : {1, 4})
+            {
+                expectLabels(connectedComponents(graph, threadCount), expected);
+            }
+        }
+    }
+}
+
+TEST_F(ConnectedComponentsTest, LargeGraphMatchesNaiveUnionFind)
+{
+    constexpr size_t vertexCount = 1 << 18;
+    DynamicArray<CsrGraph::EdgeType> edges = makeEdges(vertexCount, 1 << 18, 6);
+
+    expectLabels(connectedComponents(CsrGraph(vertexCount, edges, true, 4), 4), naiveComponents(vertexCount, edges));
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <dsa/algorithms/modifying/fill.h>
+#include <dsa/structures/arrays/static_array.h>
+
+using namespace dsa::algorithms::modifying;
+using dsa::structures::arrays::StaticArray;
+
+namespace
+{
+    /**
+     * @brief Computes entry of reflected CRC-32 lookup table.
+     */
+    constexpr uint32_t crc32OfByte(size_t byte)
+    {
+        uint32_t crc = static_cast<uint32_t>(byte);
+
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+
+        return crc;
+    }
+
+    constexpr StaticArray<uint32_t, 256> Crc32Table = makeTable<uint32_t, 256>(crc32OfByte);
+}
+
+class FillTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(FillTest, FillAndIota)
+{
+    std::string words[3];
+    int numbers[4] = {};
+
+    fill(words, 3, std::string("x"));
+    iota(numbers, 4, 10);
+
+    EXPECT_EQ(words[2], "x");
+    EXPECT_EQ(numbers[0], 10);
+    EXPECT_EQ(numbers[3], 13);
+}
+
+TEST_F(FillTest, GeneratePassesIndex)
+{
+    int squares[5] = {};
+
+    generate(squares, 5, [](size_t i) { return static_cast<int>(i * i); });
+
+    EXPECT_EQ(squares[4], 16);
+}
+
+TEST_F(FillTest, FillsAtCompileTime)
+{
+    constexpr StaticArray<int, 4> filled = []()
+    {
+        StaticArray<int, 4> array;
+
+        fill(array.getData(), 2, 7);
+        iota(array.getData() + 2, 2, 1);
+
+        return array;
+    }();
+
+    static_assert(filled[1] == 7 && filled[2] == 1 && filled[3] == 2);
+    EXPECT_EQ(filled[0], 7);
+}
+
+TEST_F(FillTest, Crc32TableBuiltAtCompileTime)
+{
+    static_assert(Crc32Table[0] == 0x00000000u);
+    static_assert(Crc32Table[1] == 0x77073096u);
+    static_assert(Crc32Table[255] == 0x2D02EF8Du);
+
+    const char* text = "123456789";
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (const char* c = text; *c != '\0'; c++) {
+        crc = Crc32Table[(crc ^ static_cast<uint8_t>(*c)) & 0xFF] ^ (crc >> 8);
+    }
+
+    EXPECT_EQ(crc ^ 0xFFFFFFFFu, 0xCBF43926u);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <dsa/algorithms/numeric/matrix_multiply.h>
+
+using namespace dsa::algorithms::numeric;
+
+class MatrixMultiplyTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+
+        template<typename T>
+        static std::vector<T> makeInput(size_t size, unsigned seed)
+        {
+            std::mt19937 random(seed);
+            std::vector<T> data(size);
+
+            for (T& value : data) {
+                value = static_cast<T>(random() % 7) - static_cast<T>(3);
+            }
+
+            return data;
+        }
+
+        template<typename T>
+        static std::vector<T> naiveMultiply(const std::vector<T>& a, const std::vector<T>& b, size_t rows, size_t depth, size_t columns)
+        {
+            std::vector<T> c(rows * columns, T());
+
+            for (size_t i = 0; i < rows; i++) {
+                for (size_t j = 0; j < columns; j++) {
+                    for (size_t p = 0; p < depth; p++) {
+                        c[i * columns + j] += a[i * depth + p] * b[p * columns + j];
+                    }
+                }
+            }
+
+            return c;
+        }
+};
+
+TEST_F(MatrixMultiplyTest, MatchesNaiveOnOddSizes)
+{
+    // Sizes cross block boundaries and leave remainders of the 4x8 kernel.
+    const size_t shapes[][3] = {{1, 1, 1}, {3, 5, 7}, {4, 8, 8}, {67, 130, 259}, {9, 300, 17}};
+
+    for (const auto& shape : shapes)
+    {
+        std::vector<float> a = makeInput<float>(shape[0] * shape[1], 1);
+        std::vector<float> b = makeInput<float>(shape[1] * shape[2], 2);
+        std::vector<float> c(shape[0] * shape[2]);
+
+        multiply(a.data(), b.data(), c.data(), shape[0], shape[1], shape[2]);
+
+        EXPECT_EQ(c, naiveMultiply(a, b, shape[0], shape[1], shape[2]));
+    }
+}
+
+TEST_F(MatrixMultiplyTest, IntegerAndDoubleElements)
+{
+    std::vector<int64_t> a = makeInput<int64_t>(70 * 33, 3);
+    std::vector<int64_t> b = makeInput<int64_t>(33 * 45, 4);
+    std::vector<int64_t> c(70 * 45);
+
+    multiply(a.data(), b.data(), c.data(), 70, 33, 45);
+    EXPECT_EQ(c, naiveMultiply(a, b, 70, 33, 45));
+
+    std::vector<double> x = makeInput<double>(20 * 20, 5);
+    std::vector<double> y(20 * 20);
+
+    multiply(x.data(), x.data(), y.data(), 20, 20, 20);
+    EXPECT_EQ(y, naiveMultiply(x, x, 20, 20, 20));
+}
+
+TEST_F(MatrixMultiplyTest, ParallelMatchesSequential)
+{
+    const size_t n = 200;
+    std::vector<float> a = makeInput<float>(n * n, 6);
+    std::vector<float> b = makeInput<float>(n * n, 7);
+    std::vector<float> sequential(n * n);
+    std::vector<float> parallel(n * n);
+
+    multiply(a.data(), b.data(), sequential.data(), n, n, n);
+    parallelMultiply(a.data(), b.data(), parallel.data(), n, n, n, 3);
+
+    EXPECT_EQ(parallel, sequential);
+}
+
+TEST_F(MatrixMultiplyTest, Transpose)
+{
+    const size_t rows = 45;
+    const size_t columns = 70;
+    std::vector<int> input(rows * columns);
+    std::vector<int> output(rows * columns);
+
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<int>(i);
+    }
+
+    transpose(input.data(), rows, columns, output.data());
+
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < columns; j++) {
+            EXPECT_EQ(output[j * rows + i], input[i * columns + j]);
+        }
+    }
+}
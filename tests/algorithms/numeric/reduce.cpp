@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <dsa/algorithms/numeric/reduce.h>
+#include <dsa/structures/arrays/static_array.h>
+
+using namespace dsa::algorithms::numeric;
+using dsa::structures::arrays::StaticArray;
+
+class ReduceTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(ReduceTest, ReduceWithOperations)
+{
+    int data[] = {1, 2, 3, 4};
+
+    EXPECT_EQ(reduce(data, 4, 0), 10);
+    EXPECT_EQ(reduce(data, 4, 1, std::multiplies<int>()), 24);
+    EXPECT_EQ(reduce(data, 0, 5), 5);
+
+    std::string words[] = {"a", "b", "c"};
+    EXPECT_EQ(reduce(words, 3, std::string(">")), ">abc");
+}
+
+TEST_F(ReduceTest, CountAndExtremes)
+{
+    int data[] = {5, -2, 9, -2, 9};
+
+    EXPECT_EQ(countIf(data, 5, [](int value) { return value < 0; }), 2);
+    EXPECT_EQ(minElement(data, 5), 1);
+    EXPECT_EQ(maxElement(data, 5), 2);
+    EXPECT_EQ(maxElement(data, 5, std::greater<int>()), 1);
+    EXPECT_EQ(minElement(data, 0), 0);
+}
+
+TEST_F(ReduceTest, ReducesAtCompileTime)
+{
+    constexpr StaticArray<int, 5> data{3, 1, 4, 1, 5};
+
+    static_assert(reduce(data.getData(), data.getSize(), 0) == 14);
+    static_assert(reduce(data.getData(), data.getSize(), 0, [](int a, int b) { return a > b ? a : b; }) == 5);
+    static_assert(countIf(data.getData(), data.getSize(), [](int value) { return value == 1; }) == 2);
+    static_assert(minElement(data.getData(), data.getSize()) == 1);
+    static_assert(maxElement(data.getData(), data.getSize()) == 4);
+
+    EXPECT_EQ(reduce(data.getData(), data.getSize(), 0), 14);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <dsa/algorithms/numeric/scan.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+
+using namespace dsa::algorithms::numeric;
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::StaticArray;
+
+class ScanTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+
+        template<typename T>
+        static std::vector<T> makeInput(size_t size)
+        {
+            std::mt19937 random(static_cast<unsigned>(size));
+            std::vector<T> data(size);
+
+            for (T& value : data) {
+                value = static_cast<T>(random() % 100);
+            }
+
+            return data;
+        }
+};
+
+TEST_F(ScanTest, InclusiveMatchesStd)
+{
+    for (size_t size : { 0, 1, 3, 4, 5, 8, 17, 1000 }) {
+        std::vector<int32_t> input = makeInput<int32_t>(size);
+        std::vector<int32_t> expected(size);
+        std::vector<int32_t> output(size);
+
+        std::partial_sum(input.begin(), input.end(), expected.begin());
+        inclusiveScan(input.data(), size, output.data());
+
+        EXPECT_EQ(output, expected) << size;
+    }
+}
+
+TEST_F(ScanTest, ExclusiveMatchesStd)
+{
+    for (size_t size : { 0, 1, 3, 4, 5, 8, 17, 1000 }) {
+        std::vector<uint32_t> input = makeInput<uint32_t>(size);
+        std::vector<uint32_t> expected(size);
+        std::vector<uint32_t> output(size);
+
+        std::exclusive_scan(input.begin(), input.end(), expected.begin(), 10u);
+        exclusiveScan(input.data(), size, output.data(), 10u);
+
+        EXPECT_EQ(output, expected) << size;
+    }
+}
+
+TEST_F(ScanTest, FloatScan)
+{
+    std::vector<float> input = makeInput<float>(37);
+    std::vector<float> expected(input.size());
+    std::vector<float> output(input.size());
+
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+    inclusiveScan(input.data(), input.size(), output.data());
+
+    for (size_t i = 0; i < input.size(); ++i) {
+        EXPECT_FLOAT_EQ(output[i], expected[i]);
+    }
+}
+
+TEST_F(ScanTest, CustomOperation)
+{
+    std::vector<int64_t> input = { 3, 1, 4, 1, 5, 9, 2, 6 };
+    std::vector<int64_t> output(input.size());
+
+    inclusiveScan(input.data(), input.size(), output.data(), [](int64_t a, int64_t b) { return std::max(a, b); });
+
+    EXPECT_EQ(output, std::vector<int64_t>({ 3, 3, 4, 4, 5, 9, 9, 9 }));
+
+    exclusiveScan(input.data(), input.size(), output.data(), int64_t(1), std::multiplies<int64_t>());
+
+    EXPECT_EQ(output[0], 1);
+    EXPECT_EQ(output[3], 12);
+    EXPECT_EQ(output[7], 1080);
+}
+
+TEST_F(ScanTest, InPlaceContainers)
+{
+    DynamicArray<int> dynamic{1, 2, 3, 4, 5};
+    StaticArray<int, 4> fixed = {1, 1, 1, 1};
+
+    inclusiveScan(dynamic);
+    exclusiveScan(fixed, 0);
+
+    EXPECT_EQ(dynamic[4], 15);
+    EXPECT_EQ(dynamic[2], 6);
+    EXPECT_EQ(fixed[0], 0);
+    EXPECT_EQ(fixed[3], 3);
+}
+
+TEST_F(ScanTest, ParallelMatchesSequential)
+{
+    const size_t size = 300000;
+    std::vector<int32_t> input = makeInput<int32_t>(size);
+    std::vector<int32_t> expected(size);
+    std::vector<int32_t> output(size);
+
+    for (size_t threads : { 1, 2, 3, 8 }) {
+        std::partial_sum(input.begin(), input.end(), expected.begin());
+        parallelInclusiveScan(input.data(), size, output.data(), std::plus<int32_t>(), threads);
+
+        EXPECT_EQ(output, expected) << threads;
+
+        std::exclusive_scan(input.begin(), input.end(), expected.begin(), 5);
+        parallelExclusiveScan(input.data(), size, output.data(), 5, std::plus<int32_t>(), threads);
+
+        EXPECT_EQ(output, expected) << threads;
+    }
+}
+
+TEST_F(ScanTest, ParallelGenericOperationInPlace)
+{
+    const size_t size = 200000;
+    DynamicArray<int64_t> arr(size);
+    std::vector<int64_t> expected(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        arr[i] = static_cast<int64_t>(i % 7);
+        expected[i] = arr[i];
+    }
+
+    std::partial_sum(expected.begin(), expected.end(), expected.begin());
+    parallelInclusiveScan(arr, std::plus<int64_t>(), 4);
+
+    for (size_t i = 0; i < size; i += 997) {
+        EXPECT_EQ(arr[i], expected[i]);
+    }
+
+    EXPECT_EQ(arr[size - 1], expected[size - 1]);
+}
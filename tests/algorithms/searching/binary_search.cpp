@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include <dsa/algorithms/searching/binary_search.h>
+
+using namespace dsa::algorithms::searching;
+
+class BinarySearchTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(BinarySearchTest, BranchlessLowerBoundMatchesStd)
+{
+    for (size_t size = 0; size < 40; ++size) {
+        std::vector<int> data;
+
+        for (size_t i = 0; i < size; ++i) {
+            data.push_back(static_cast<int>(i * 2));
+        }
+
+        for (int key = -1; key <= static_cast<int>(size * 2) + 1; ++key) {
+            size_t expected = static_cast<size_t>(std::lower_bound(data.begin(), data.end(), key) - data.begin());
+            EXPECT_EQ(branchlessLowerBound(data.data(), size, key), expected);
+        }
+    }
+}
+
+TEST_F(BinarySearchTest, EytzingerLayoutAndTraversal)
+{
+    std::vector<int> sorted{1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> tree(sorted.size());
+
+    eytzingerLayout(sorted.data(), tree.data(), sorted.size());
+
+    EXPECT_EQ(tree, (std::vector<int>{4, 2, 6, 1, 3, 5, 7}));
+
+    std::vector<int> inOrder;
+
+    for (size_t k = eytzingerFirst(tree.size()); k != 0; k = eytzingerNext(k, tree.size())) {
+        inOrder.push_back(tree[k - 1]);
+    }
+
+    EXPECT_EQ(inOrder, (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(eytzingerFirst(0), 0);
+}
+
+TEST_F(BinarySearchTest, EytzingerLowerBoundMatchesStd)
+{
+    for (size_t size = 0; size < 70; ++size) {
+        std::vector<int> sorted;
+
+        for (size_t i = 0; i < size; ++i) {
+            sorted.push_back(static_cast<int>(i * 3));
+        }
+
+        std::vector<int> copy = sorted;
+        std::vector<int> tree(size);
+        eytzingerLayout(copy.data(), tree.data(), size);
+
+        for (int key = -1; key <= static_cast<int>(size * 3) + 1; ++key) {
+            auto it = std::lower_bound(sorted.begin(), sorted.end(), key);
+            size_t k = eytzingerLowerBound(tree.data(), size, key);
+
+            if (it == sorted.end()) {
+                EXPECT_EQ(k, 0);
+            }
+            else {
+                ASSERT_NE(k, 0);
+                EXPECT_EQ(tree[k - 1], *it);
+            }
+        }
+    }
+}
+
+TEST_F(BinarySearchTest, BranchlessLowerBoundAtCompileTime)
+{
+    constexpr int sorted[] = {2, 4, 6, 8};
+
+    static_assert(branchlessLowerBound(sorted, 4, 5) == 2);
+    static_assert(eytzingerFirst(7) == 4);
+
+    EXPECT_EQ(branchlessLowerBound(sorted, 4, 9), 4);
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <dsa/algorithms/searching/linear_search.h>
+#include <dsa/structures/arrays/static_array.h>
+
+using namespace dsa::algorithms::searching;
+using dsa::structures::arrays::StaticArray;
+
+class LinearSearchTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(LinearSearchTest, FindReturnsFirstMatch)
+{
+    int data[] = {4, 8, 15, 8, 23};
+
+    EXPECT_EQ(find(data, 5, 8), 1);
+    EXPECT_EQ(find(data, 5, 42), 5);
+    EXPECT_EQ(find<int>(nullptr, 0, 1), 0);
+}
+
+TEST_F(LinearSearchTest, FindIf)
+{
+    int data[] = {1, 3, 6, 7};
+
+    EXPECT_EQ(findIf(data, 4, [](int value) { return value % 2 == 0; }), 2);
+    EXPECT_EQ(findIf(data, 4, [](int value) { return value > 10; }), 4);
+}
+
+TEST_F(LinearSearchTest, SearchesAtCompileTime)
+{
+    constexpr StaticArray<char, 5> vowels{'a', 'e', 'i', 'o', 'u'};
+
+    static_assert(find(vowels.getData(), vowels.getSize(), 'o') == 3);
+    static_assert(findIf(vowels.getData(), vowels.getSize(), [](char c) { return c > 'h'; }) == 2);
+
+    EXPECT_EQ(find(vowels.getData(), vowels.getSize(), 'x'), 5);
+}
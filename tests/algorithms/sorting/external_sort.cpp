@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <dsa/algorithms/sorting/external_sort.h>
+#include <dsa/utility/instrumentation.h>
+
+using namespace dsa::algorithms::sorting;
+using dsa::structures::arrays::DynamicArray;
+namespace instrumentation = dsa::utility::instrumentation;
+
+namespace
+{
+    struct Record
+    {
+        uint32_t key;
+        uint32_t payload;
+    };
+
+    struct RecordCompare
+    {
+        bool operator()(const Record& first, const Record& second) const
+        {
+            return first.key < second.key;
+        }
+    };
+}
+
+class ExternalSortTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(ExternalSortTest, SortsDatasetLargerThanBudget)
+{
+    const size_t budget = 64 * 1024;
+    const size_t count = 8 * budget / sizeof(uint64_t);
+
+    std::mt19937_64 random(5);
+    std::vector<uint64_t> expected;
+    std::vector<uint64_t> sorted;
+
+    ExternalSorter<uint64_t> sorter(budget);
+
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t value = random();
+
+        expected.push_back(value);
+        sorter.add(value);
+    }
+
+    EXPECT_GE(sorter.getRunCount(), 7);
+
+    sorter.finish([&](const uint64_t& value) { sorted.push_back(value); });
+
+    std::sort(expected.begin(), expected.end());
+
+    EXPECT_EQ(sorted, expected);
+    EXPECT_EQ(sorter.getRunCount(), 0);
+}
+
+TEST_F(ExternalSortTest, FitsInMemoryWithoutRuns)
+{
+    ExternalSorter<int> sorter(1024);
+    std::vector<int> sorted;
+
+    for (int value : { 5, 1, 4, 2, 3 }) {
+        sorter.add(value);
+    }
+
+    sorter.finish([&](const int& value) { sorted.push_back(value); });
+
+    EXPECT_EQ(sorter.getRunCount(), 0);
+    EXPECT_EQ(sorted, std::vector<int>({ 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(ExternalSortTest, EmptyInput)
+{
+    ExternalSorter<int> sorter(1024);
+    size_t emitted = 0;
+
+    sorter.finish([&](const int&) { emitted++; });
+
+    EXPECT_EQ(emitted, 0);
+}
+
+TEST_F(ExternalSortTest, CustomComparatorAndDuplicates)
+{
+    ExternalSorter<Record, RecordCompare> sorter(10 * sizeof(Record));
+    std::vector<Record> sorted;
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        sorter.add(Record{ (i * 7919) % 50, i });
+    }
+
+    sorter.finish([&](const Record& record) { sorted.push_back(record); });
+
+    ASSERT_EQ(sorted.size(), 1000);
+
+    for (size_t i = 1; i < sorted.size(); ++i) {
+        EXPECT_LE(sorted[i - 1].key, sorted[i].key);
+    }
+}
+
+TEST_F(ExternalSortTest, SortsBinaryStream)
+{
+    std::vector<int32_t> values(20000);
+    std::mt19937 random(9);
+
+    for (int32_t& value : values) {
+        value = static_cast<int32_t>(random());
+    }
+
+    std::stringstream input;
+    std::stringstream output;
+
+    input.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(int32_t)));
+
+    size_t runs = externalSort<int32_t>(input, output, 4096);
+
+    std::string bytes = output.str();
+    std::vector<int32_t> sorted(bytes.size() / sizeof(int32_t));
+
+    std::copy(bytes.begin(), bytes.end(), reinterpret_cast<char*>(sorted.data()));
+    std::sort(values.begin(), values.end());
+
+    EXPECT_GT(runs, 1);
+    EXPECT_EQ(sorted, values);
+}
+
+TEST_F(ExternalSortTest, TruncatedRecordThrows)
+{
+    std::stringstream input(std::string("abcdefg"));
+    std::stringstream output;
+
+    EXPECT_THROW(externalSort<int32_t>(input, output, 1024), std::runtime_error);
+}
+
+TEST_F(ExternalSortTest, MergesManyRunsInBoundedPasses)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("dsa-external-sort-test-" + std::to_string(std::random_device()()));
+    std::filesystem::create_directories(directory);
+
+    {
+        ExternalSorter<uint64_t> sorter(4 * sizeof(uint64_t), directory);
+        std::mt19937_64 random(11);
+        std::vector<uint64_t> expected;
+        std::vector<uint64_t> sorted;
+
+        for (size_t i = 0; i < 8000; ++i) {
+            expected.push_back(random());
+            sorter.add(expected.back());
+        }
+
+        EXPECT_GT(sorter.getRunCount(), ExternalSorter<uint64_t>::MaxFanIn);
+
+        sorter.finish([&](const uint64_t& value) { sorted.push_back(value); });
+
+        std::sort(expected.begin(), expected.end());
+
+        EXPECT_EQ(sorted, expected);
+        EXPECT_TRUE(std::filesystem::is_empty(directory));
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(ExternalSortTest, RecordBuffersStayWithinBudget)
+{
+    if (!instrumentation::isEnabled())
+        GTEST_SKIP() << "Instrumentation is not compiled in";
+
+    const size_t budget = 256 * sizeof(Record);
+    instrumentation::Counters& counters = instrumentation::getCounters<DynamicArray<Record>>();
+
+    for (size_t count : {100, 256 * 10, 256 * 100}) {
+        for (bool toStream : {false, true}) {
+            ExternalSorter<Record, RecordCompare> sorter(budget);
+            std::ostringstream output;
+            size_t emitted = 0;
+
+            counters.resetPeak();
+
+            for (size_t i = 0; i < count; ++i) {
+                sorter.add(Record{static_cast<uint32_t>((i * 7919) % count), static_cast<uint32_t>(i)});
+            }
+
+            if (toStream)
+                sorter.finishToStream(output);
+            else
+                sorter.finish([&](const Record&) { emitted++; });
+
+            EXPECT_EQ(toStream ? output.str().size() / sizeof(Record) : emitted, count);
+            EXPECT_LE(counters.getStatistics().peakBytes, budget) << count << (toStream ? " records to stream" : " records");
+        }
+    }
+}
+
+TEST_F(ExternalSortTest, SortersSharingDirectoryDoNotCollide)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("dsa-external-sort-test-" + std::to_string(std::random_device()()));
+    std::filesystem::create_directories(directory);
+
+    {
+        ExternalSorter<int> first(16 * sizeof(int), directory);
+        ExternalSorter<int> second(16 * sizeof(int), directory);
+        std::vector<int> firstSorted;
+        std::vector<int> secondSorted;
+
+        for (int i = 0; i < 1000; ++i) {
+            first.add((i * 7919) % 1000);
+            second.add(-((i * 7907) % 1000));
+        }
+
+        EXPECT_EQ(static_cast<size_t>(std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator())),
+            first.getRunCount() + second.getRunCount());
+
+        first.finish([&](const int& value) { firstSorted.push_back(value); });
+        second.finish([&](const int& value) { secondSorted.push_back(value); });
+
+        ASSERT_EQ(firstSorted.size(), 1000);
+        ASSERT_EQ(secondSorted.size(), 1000);
+
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(firstSorted[i], i);
+            EXPECT_EQ(secondSorted[i], i - 999);
+        }
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <dsa/algorithms/sorting/heap_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+
+using namespace dsa::algorithms::sorting;
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::StaticArray;
+
+class HeapSortTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(HeapSortTest, MatchesStdSort)
+{
+    std::mt19937 random(7);
+
+    for (size_t size = 0; size < 200; size += 7) {
+        std::vector<int> data(size);
+
+        for (int& value : data) {
+            value = static_cast<int>(random() % 50);
+        }
+
+        std::vector<int> expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        heapSort(data.begin(), data.end());
+
+        EXPECT_EQ(data, expected);
+    }
+}
+
+TEST_F(HeapSortTest, CustomComparatorAndStrings)
+{
+    std::vector<std::string> data{"pear", "apple", "fig", "banana"};
+
+    heapSort(data.begin(), data.end(), std::greater<std::string>());
+
+    EXPECT_EQ(data, (std::vector<std::string>{"pear", "fig", "banana", "apple"}));
+}
+
+TEST_F(HeapSortTest, ArrayOverloads)
+{
+    DynamicArray<int> dynamic{3, 1, 2};
+    StaticArray<int, 4> fixed{4, 3, 2, 1};
+
+    heapSort(dynamic);
+    heapSort(fixed, std::greater<int>());
+
+    EXPECT_EQ(dynamic[0], 1);
+    EXPECT_EQ(dynamic[2], 3);
+    EXPECT_EQ(fixed[0], 4);
+    EXPECT_EQ(fixed[3], 1);
+}
+
+TEST_F(HeapSortTest, SortsAtCompileTime)
+{
+    constexpr StaticArray<int, 6> sorted = []()
+    {
+        StaticArray<int, 6> array{5, 3, 6, 1, 4, 2};
+
+        heapSort(array);
+
+        return array;
+    }();
+
+    static_assert(sorted[0] == 1 && sorted[5] == 6);
+
+    for (size_t i = 0; i < sorted.getSize(); ++i) {
+        EXPECT_EQ(sorted[i], static_cast<int>(i) + 1);
+    }
+}
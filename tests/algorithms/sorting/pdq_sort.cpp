@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <dsa/algorithms/sorting/pdq_sort.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+
+using namespace dsa::algorithms::sorting;
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::StaticArray;
+
+class PdqSortTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+
+        static std::vector<int> makeDistribution(const std::string& kind, size_t size, std::mt19937& random)
+        {
+            std::vector<int> data(size);
+
+            for (size_t i = 0; i < size; ++i) {
+                if (kind == "random")
+                    data[i] = static_cast<int>(random());
+                else if (kind == "sorted")
+                    data[i] = static_cast<int>(i);
+                else if (kind == "reversed")
+                    data[i] = static_cast<int>(size - i);
+                else if (kind == "fewUnique")
+                    data[i] = static_cast<int>(random() % 4);
+                else if (kind == "organPipe")
+                    data[i] = static_cast<int>(i < size / 2 ? i : size - i);
+                else if (kind == "sawtooth")
+                    data[i] = static_cast<int>(i % 32);
+                else
+                    data[i] = 7;
+            }
+
+            return data;
+        }
+};
+
+TEST_F(PdqSortTest, MatchesStdSortOnDistributions)
+{
+    std::mt19937 random(42);
+    const char* kinds[] = { "random", "sorted", "reversed", "fewUnique", "organPipe", "sawtooth", "equal" };
+    const size_t sizes[] = { 0, 1, 2, 3, 10, 23, 24, 25, 100, 129, 1000, 10000 };
+
+    for (const char* kind : kinds) {
+        for (size_t size : sizes) {
+            std::vector<int> data = makeDistribution(kind, size, random);
+            std::vector<int> expected = data;
+
+            std::sort(expected.begin(), expected.end());
+            pdqSort(data.begin(), data.end());
+
+            EXPECT_EQ(data, expected) << kind << " " << size;
+        }
+    }
+}
+
+TEST_F(PdqSortTest, CustomComparator)
+{
+    std::mt19937 random(7);
+    std::vector<int> data = makeDistribution("random", 5000, random);
+    std::vector<int> expected = data;
+
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+    pdqSort(data.begin(), data.end(), std::greater<int>());
+
+    EXPECT_EQ(data, expected);
+}
+
+TEST_F(PdqSortTest, BranchlessWithRawPointers)
+{
+    std::mt19937 random(3);
+
+    for (size_t size : { 5, 64, 65, 200, 4096, 100000 }) {
+        std::vector<double> data(size);
+
+        for (double& value : data) {
+            value = static_cast<double>(random() % 1000) / 10.0;
+        }
+
+        std::vector<double> expected = data;
+
+        std::sort(expected.begin(), expected.end());
+        pdqSortBranchless(data.data(), data.data() + data.size(), std::less<double>());
+
+        EXPECT_EQ(data, expected) << size;
+    }
+}
+
+TEST_F(PdqSortTest, NonTrivialElements)
+{
+    std::mt19937 random(11);
+    std::vector<std::string> data;
+
+    for (int i = 0; i < 3000; ++i) {
+        data.push_back(std::to_string(random() % 500));
+    }
+
+    std::vector<std::string> expected = data;
+
+    std::sort(expected.begin(), expected.end());
+    pdqSort(data.begin(), data.end());
+
+    EXPECT_EQ(data, expected);
+}
+
+TEST_F(PdqSortTest, DynamicArrayOverload)
+{
+    DynamicArray<int> arr{5, 3, 9, 1, 7, 3, 0};
+
+    pdqSort(arr);
+
+    for (size_t i = 1; i < arr.getSize(); ++i) {
+        EXPECT_LE(arr[i - 1], arr[i]);
+    }
+
+    pdqSort(arr, std::greater<int>());
+
+    EXPECT_EQ(arr[0], 9);
+    EXPECT_EQ(arr[6], 0);
+
+    DynamicArray<int> empty;
+    pdqSort(empty);
+    EXPECT_EQ(empty.getSize(), 0);
+}
+
+TEST_F(PdqSortTest, StaticArrayOverload)
+{
+    StaticArray<int, 6> arr = {4, 2, 6, 1, 5, 3};
+
+    pdqSort(arr);
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_EQ(arr[i], i + 1);
+    }
+}
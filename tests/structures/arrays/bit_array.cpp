@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include <dsa/structures/arrays/bit_array.h>
+
+using dsa::structures::arrays::BitArray;
+using dsa::structures::arrays::StaticBitArray;
+
+class BitArrayTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(BitArrayTest, DefaultConstructor)
+{
+    BitArray bits;
+
+    EXPECT_EQ(bits.getSize(), 0);
+    EXPECT_EQ(bits.popcount(), 0);
+    EXPECT_EQ(bits.findFirstSet(), 0);
+    EXPECT_TRUE(bits.none());
+}
+
+TEST_F(BitArrayTest, SizeConstructor)
+{
+    BitArray cleared(130);
+    BitArray filled(130, true);
+
+    EXPECT_EQ(cleared.getSize(), 130);
+    EXPECT_EQ(cleared.getWordCount(), 3);
+    EXPECT_EQ(cleared.popcount(), 0);
+
+    EXPECT_EQ(filled.popcount(), 130);
+    EXPECT_TRUE(filled.all());
+}
+
+TEST_F(BitArrayTest, SetTestResetFlip)
+{
+    BitArray bits(100);
+
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(99);
+
+    EXPECT_TRUE(bits.test(0));
+    EXPECT_TRUE(bits[63]);
+    EXPECT_TRUE(bits[64]);
+    EXPECT_FALSE(bits[65]);
+    EXPECT_EQ(bits.popcount(), 4);
+
+    bits.reset(63);
+    bits.flip(1);
+    bits.flip(99);
+
+    EXPECT_FALSE(bits[63]);
+    EXPECT_TRUE(bits[1]);
+    EXPECT_FALSE(bits[99]);
+
+    EXPECT_THROW(bits.test(100), std::out_of_range);
+    EXPECT_THROW(bits.set(100), std::out_of_range);
+    EXPECT_THROW(bits.flip(1000), std::out_of_range);
+}
+
+TEST_F(BitArrayTest, FindFirstAndNextSet)
+{
+    BitArray bits(300);
+    std::vector<size_t> expected{3, 64, 65, 200, 299};
+
+    for (size_t index : expected) {
+        bits.set(index);
+    }
+
+    std::vector<size_t> found;
+
+    for (size_t i = bits.findFirstSet(); i < bits.getSize(); i = bits.findNextSet(i)) {
+        found.push_back(i);
+    }
+
+    EXPECT_EQ(found, expected);
+    EXPECT_EQ(bits.findNextSet(299), 300);
+    EXPECT_EQ(BitArray(10).findFirstSet(), 10);
+}
+
+TEST_F(BitArrayTest, WordParallelOperators)
+{
+    BitArray a(70);
+    BitArray b(70);
+
+    a.set(1);
+    a.set(69);
+    b.set(1);
+    b.set(2);
+
+    EXPECT_EQ((a & b).popcount(), 1);
+    EXPECT_EQ((a | b).popcount(), 3);
+    EXPECT_EQ((a ^ b).popcount(), 2);
+
+    BitArray inverted = ~a;
+    EXPECT_EQ(inverted.popcount(), 68);
+    EXPECT_FALSE(inverted[69]);
+
+    BitArray difference = a;
+    difference.subtract(b);
+    EXPECT_EQ(difference.popcount(), 1);
+    EXPECT_TRUE(difference[69]);
+
+    BitArray other(71);
+    EXPECT_THROW(a &= other, std::invalid_argument);
+}
+
+TEST_F(BitArrayTest, FlipAllKeepsTailClear)
+{
+    BitArray bits(65);
+
+    bits.flipAll();
+    EXPECT_EQ(bits.popcount(), 65);
+    EXPECT_TRUE(bits.all());
+
+    bits.flipAll();
+    EXPECT_TRUE(bits.none());
+}
+
+TEST_F(BitArrayTest, Resize)
+{
+    BitArray bits(10, true);
+
+    bits.resize(200);
+    EXPECT_EQ(bits.getSize(), 200);
+    EXPECT_EQ(bits.popcount(), 10);
+
+    bits.resize(5);
+    EXPECT_EQ(bits.popcount(), 5);
+
+    bits.resize(64);
+    EXPECT_EQ(bits.popcount(), 5);
+}
+
+TEST_F(BitArrayTest, EqualityAndStreamOutput)
+{
+    BitArray a(5);
+    BitArray b(5);
+
+    a.set(1);
+    a.set(4);
+    EXPECT_NE(a, b);
+
+    b.set(1);
+    b.set(4);
+    EXPECT_EQ(a, b);
+
+    std::ostringstream oss;
+    oss << a;
+    EXPECT_EQ(oss.str(), "01001");
+}
+
+TEST_F(BitArrayTest, StaticBitArray)
+{
+    StaticBitArray<100> a;
+    StaticBitArray<100> b(true);
+
+    EXPECT_EQ(a.getSize(), 100);
+    EXPECT_EQ(a.getWordCount(), 2);
+    EXPECT_EQ(b.popcount(), 100);
+
+    a.set(42);
+    a.set(77);
+
+    EXPECT_EQ((a & b).popcount(), 2);
+    EXPECT_EQ(a.findFirstSet(), 42);
+    EXPECT_EQ(a.findNextSet(42), 77);
+    EXPECT_EQ((~a).popcount(), 98);
+
+    StaticBitArray<0> empty;
+    EXPECT_EQ(empty.popcount(), 0);
+    EXPECT_EQ(empty.findFirstSet(), 0);
+}
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dsa/structures/arrays/cow_dynamic_array.h>
+
+using dsa::structures::arrays::CowDynamicArray;
+using dsa::structures::arrays::DynamicArray;
+
+class CowDynamicArrayTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(CowDynamicArrayTest, DefaultConstructor)
+{
+    CowDynamicArray<int> arr;
+
+    EXPECT_EQ(arr.getSize(), 0);
+    EXPECT_EQ(arr.getReferenceCount(), 0);
+    EXPECT_EQ(arr.getData(), nullptr);
+    EXPECT_TRUE(arr.begin() == arr.end());
+}
+
+TEST_F(CowDynamicArrayTest, CopySharesStorage)
+{
+    CowDynamicArray<int> original{1, 2, 3};
+    CowDynamicArray<int> copy(original);
+
+    EXPECT_EQ(original.getReferenceCount(), 2);
+    EXPECT_TRUE(copy.isShared());
+    EXPECT_EQ(copy.getData(), original.getData());
+    EXPECT_EQ(copy[1], 2);
+}
+
+TEST_F(CowDynamicArrayTest, ConstAccessDoesNotDetach)
+{
+    CowDynamicArray<int> original{1, 2, 3};
+    const CowDynamicArray<int> copy = original;
+
+    EXPECT_EQ(copy.get(0), 1);
+    EXPECT_EQ(copy[2], 3);
+    EXPECT_EQ(copy.first(), 1);
+    EXPECT_EQ(copy.last(), 3);
+
+    int sum = 0;
+
+    for (int value : copy) {
+        sum += value;
+    }
+
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(copy.getData(), original.getData());
+    EXPECT_THROW(copy.get(3), std::out_of_range);
+}
+
+TEST_F(CowDynamicArrayTest, MutationDetaches)
+{
+    CowDynamicArray<int> original{1, 2, 3};
+    CowDynamicArray<int> copy = original;
+
+    copy.set(0, 100);
+
+    EXPECT_FALSE(original.isShared());
+    EXPECT_FALSE(copy.isShared());
+    EXPECT_NE(copy.getData(), original.getData());
+    EXPECT_EQ(original[0], 1);
+    EXPECT_EQ(copy[0], 100);
+}
+
+TEST_F(CowDynamicArrayTest, EveryMutatorDetaches)
+{
+    CowDynamicArray<int> original{1, 2, 3};
+
+    CowDynamicArray<int> a = original;
+    a[1] = 20;
+
+    CowDynamicArray<int> b = original;
+    b.addLast(4);
+
+    CowDynamicArray<int> c = original;
+    c.addFirst(0);
+
+    CowDynamicArray<int> d = original;
+    d.removeAt(1);
+
+    CowDynamicArray<int> e = original;
+    e.removeFirst();
+    e.removeLast();
+
+    CowDynamicArray<int> f = original;
+    *f.begin() = 10;
+
+    EXPECT_EQ(original.getSize(), 3);
+    EXPECT_EQ(original[0], 1);
+    EXPECT_EQ(original[1], 2);
+    EXPECT_EQ(original.getReferenceCount(), 1);
+
+    EXPECT_EQ(a[1], 20);
+    EXPECT_EQ(b.last(), 4);
+    EXPECT_EQ(c.first(), 0);
+    EXPECT_EQ(d[1], 3);
+    EXPECT_EQ(e.getSize(), 1);
+    EXPECT_EQ(f[0], 10);
+}
+
+TEST_F(CowDynamicArrayTest, UniqueMutationDoesNotCopy)
+{
+    CowDynamicArray<int> arr{1, 2, 3};
+    const int* data = arr.getData();
+
+    arr.set(0, 5);
+    arr[1] = 6;
+
+    EXPECT_EQ(arr.getData(), data);
+}
+
+TEST_F(CowDynamicArrayTest, ReferenceTakenBeforeCopyDoesNotReachCopy)
+{
+    CowDynamicArray<int> original{1, 2, 3};
+    int& element = original[0];
+    auto it = original.begin();
+
+    EXPECT_FALSE(original.isShareable());
+
+    CowDynamicArray<int> copy(original);
+    CowDynamicArray<int> assigned;
+
+    assigned = original;
+    element = 10;
+    ++it;
+    *it = 20;
+
+    EXPECT_FALSE(original.isShared());
+    EXPECT_NE(copy.getData(), original.getData());
+    EXPECT_EQ(copy[0], 1);
+    EXPECT_EQ(copy[1], 2);
+    EXPECT_EQ(assigned.get(0), 1);
+    EXPECT_EQ(original.get(0), 10);
+    EXPECT_EQ(original.get(1), 20);
+
+    CowDynamicArray<int> shareable{1, 2, 3};
+    const CowDynamicArray<int>& view = shareable;
+
+    shareable.set(0, 5);
+    EXPECT_EQ(view[0], 5);
+    EXPECT_TRUE(shareable.isShareable());
+
+    CowDynamicArray<int> shared(shareable);
+
+    EXPECT_EQ(shared.getData(), shareable.getData());
+}
+
+TEST_F(CowDynamicArrayTest, AssignmentOperators)
+{
+    CowDynamicArray<int> a{1, 2};
+    CowDynamicArray<int> b{3, 4, 5};
+
+    b = a;
+    EXPECT_EQ(a.getReferenceCount(), 2);
+    EXPECT_EQ(b.getSize(), 2);
+
+    b = b;
+    EXPECT_EQ(b.getReferenceCount(), 2);
+
+    CowDynamicArray<int> c;
+    c = std::move(b);
+    EXPECT_EQ(c.getReferenceCount(), 2);
+    EXPECT_EQ(b.getSize(), 0);
+
+    c = {7, 8, 9, 10};
+    EXPECT_EQ(c.getSize(), 4);
+    EXPECT_EQ(a.getReferenceCount(), 1);
+}
+
+TEST_F(CowDynamicArrayTest, FromDynamicArrayAndStreamOutput)
+{
+    CowDynamicArray<std::string> arr(DynamicArray<std::string>{"a", "b"});
+    std::ostringstream oss;
+
+    oss << arr;
+
+    EXPECT_EQ(oss.str(), "Index: 0 | Value: a\nIndex: 1 | Value: b\n");
+}
+
+TEST_F(CowDynamicArrayTest, EmptyArrayMutation)
+{
+    CowDynamicArray<int> arr;
+
+    EXPECT_THROW(arr.removeLast(), std::runtime_error);
+    EXPECT_THROW(arr.removeFirst(), std::runtime_error);
+    EXPECT_THROW(arr.removeAt(0), std::out_of_range);
+    EXPECT_THROW(arr.first(), std::out_of_range);
+
+    arr.addLast(1);
+    EXPECT_EQ(arr.getSize(), 1);
+}
+
+TEST_F(CowDynamicArrayTest, SnapshotsAcrossThreads)
+{
+    CowDynamicArray<int> source;
+
+    for (int i = 0; i < 1000; ++i) {
+        source.addLast(i);
+    }
+
+    std::vector<std::thread> workers;
+    std::vector<long long> sums(4, 0);
+
+    for (size_t t = 0; t < sums.size(); ++t) {
+        CowDynamicArray<int> snapshot = source;
+
+        workers.emplace_back([snapshot, &sums, t]() mutable {
+            const CowDynamicArray<int>& view = snapshot;
+
+            for (int value : view) {
+                sums[t] += value;
+            }
+
+            snapshot.set(0, static_cast<int>(t));
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (long long sum : sums) {
+        EXPECT_EQ(sum, 499500);
+    }
+
+    EXPECT_EQ(source[0], 0);
+    EXPECT_EQ(source.getReferenceCount(), 1);
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <dsa/structures/arrays/dynamic_array.h>
 
+using dsa::structures::arrays::AlignedDynamicArray;
 using dsa::structures::arrays::DynamicArray;
 
 
@@ -38,6 +42,34 @@ TEST_F(DynamicArrayTest, EmptyInitializerList)
     EXPECT_EQ(arr.getSize(), 0);
 }
 
+TEST_F(DynamicArrayTest, SizeConstructor)
+{
+    DynamicArray<int> arr(4);
+
+    EXPECT_EQ(arr.getSize(), 4);
+
+    for (size_t i = 0; i < arr.getSize(); ++i) {
+        EXPECT_EQ(arr[i], 0);
+    }
+
+    DynamicArray<int> empty(0);
+    EXPECT_EQ(empty.getSize(), 0);
+    EXPECT_EQ(empty.getData(), nullptr);
+}
+
+TEST_F(DynamicArrayTest, GetDataMethod)
+{
+    DynamicArray<int> arr{1, 2, 3};
+
+    EXPECT_EQ(arr.getData(), &arr[0]);
+
+    arr.getData()[2] = 30;
+    EXPECT_EQ(arr[2], 30);
+
+    const DynamicArray<int>& constArr = arr;
+    EXPECT_EQ(constArr.getData()[1], 2);
+}
+
 TEST_F(DynamicArrayTest, CopyConstructor)
 {
     DynamicArray<int> original{10, 20, 30};
@@ -447,3 +479,125 @@ TEST_F(DynamicArrayTest, StressTest)
     EXPECT_EQ(arr.getSize(), 500);
     EXPECT_EQ(arr.last(), 499);
 }
+
+TEST_F(DynamicArrayTest, RemoveKeepsCapacity)
+{
+    DynamicArray<int> arr{1, 2, 3, 4, 5};
+    int* data = arr.getData();
+
+    arr.removeFirst();
+    arr.removeAt(1);
+    arr.removeLast();
+
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(arr.getCapacity(), 5);
+    EXPECT_EQ(arr.getData(), data);
+    EXPECT_EQ(arr[0], 2);
+    EXPECT_EQ(arr[1], 4);
+
+    arr.addLast(6);
+    arr.addFirst(0);
+
+    EXPECT_EQ(arr.getData(), data);
+    EXPECT_EQ(arr.getSize(), 4);
+    EXPECT_EQ(arr[0], 0);
+    EXPECT_EQ(arr[3], 6);
+}
+
+TEST_F(DynamicArrayTest, ReserveMethod)
+{
+    DynamicArray<int> arr{1, 2};
+
+    arr.reserve(10);
+    EXPECT_EQ(arr.getCapacity(), 10);
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(arr[1], 2);
+
+    arr.reserve(4);
+    EXPECT_EQ(arr.getCapacity(), 10);
+}
+
+TEST_F(DynamicArrayTest, SwapRemoveMethod)
+{
+    DynamicArray<int> arr{10, 20, 30, 40};
+
+    arr.swapRemove(1);
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[0], 10);
+    EXPECT_EQ(arr[1], 40);
+    EXPECT_EQ(arr[2], 30);
+
+    arr.swapRemove(2);
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(arr[1], 40);
+
+    EXPECT_THROW(arr.swapRemove(2), std::out_of_range);
+}
+
+TEST_F(DynamicArrayTest, RemoveIfMethod)
+{
+    DynamicArray<int> arr{1, 2, 3, 4, 5, 6, 7};
+
+    size_t removed = arr.removeIf([](const int& value) { return value % 2 == 0; });
+
+    EXPECT_EQ(removed, 3);
+    EXPECT_EQ(arr.getSize(), 4);
+    EXPECT_EQ(arr[0], 1);
+    EXPECT_EQ(arr[1], 3);
+    EXPECT_EQ(arr[2], 5);
+    EXPECT_EQ(arr[3], 7);
+
+    EXPECT_EQ(arr.removeIf([](const int&) { return false; }), 0);
+    EXPECT_EQ(arr.removeIf([](const int&) { return true; }), 4);
+    EXPECT_EQ(arr.getSize(), 0);
+}
+
+TEST_F(DynamicArrayTest, InPlaceRemovalWithStrings)
+{
+    DynamicArray<std::string> arr{"a", "bb", "ccc", "dddd"};
+
+    arr.removeAt(1);
+    arr.removeIf([](const std::string& value) { return value.size() == 4; });
+    arr.addLast("e");
+
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[0], "a");
+    EXPECT_EQ(arr[1], "ccc");
+    EXPECT_EQ(arr[2], "e");
+}
+
+TEST_F(DynamicArrayTest, GrowthMovesMoveOnlyElements)
+{
+    DynamicArray<std::unique_ptr<int>> arr;
+
+    for (int i = 0; i < 10; ++i) {
+        arr.addLast(std::make_unique<int>(i));
+    }
+
+    arr.addFirst(std::make_unique<int>(-1));
+
+    ASSERT_EQ(arr.getSize(), 11);
+    EXPECT_EQ(*arr[0], -1);
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(*arr[i + 1], i);
+    }
+}
+
+TEST_F(DynamicArrayTest, AlignedDynamicArray)
+{
+    AlignedDynamicArray<float, 32> arr{1.0f, 2.0f, 3.0f};
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.getData()) % 32, 0);
+
+    for (int i = 0; i < 20; ++i) {
+        arr.addLast(static_cast<float>(i));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.getData()) % 32, 0);
+    }
+
+    AlignedDynamicArray<float, 32> copy(arr);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(copy.getData()) % 32, 0);
+    EXPECT_EQ(copy.getSize(), 23);
+    EXPECT_EQ(copy[2], 3.0f);
+}
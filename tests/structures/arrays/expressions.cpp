@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <dsa/structures/arrays/expressions.h>
+#include <dsa/utility/instrumentation.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::StaticArray;
+using dsa::structures::arrays::assign;
+using dsa::structures::arrays::evaluate;
+using dsa::utility::instrumentation::Statistics;
+using dsa::utility::instrumentation::getGlobalStatistics;
+
+class ExpressionsTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(ExpressionsTest, StaticArrayExpression)
+{
+    StaticArray<int, 4> a{1, 2, 3, 4};
+    StaticArray<int, 4> b{2, 2, 2, 2};
+    StaticArray<int, 4> c{1, 2, 3, 4};
+
+    auto result = evaluate(a + b * c);
+
+    static_assert(std::is_same_v<decltype(result), StaticArray<int, 4>>);
+    EXPECT_EQ(result[0], 3);
+    EXPECT_EQ(result[1], 6);
+    EXPECT_EQ(result[2], 9);
+    EXPECT_EQ(result[3], 12);
+}
+
+TEST_F(ExpressionsTest, DynamicArrayExpression)
+{
+    DynamicArray<double> a{1.0, 2.0, 3.0};
+    DynamicArray<double> b{4.0, 5.0, 6.0};
+
+    auto result = evaluate((a - b) / 2.0);
+
+    static_assert(std::is_same_v<decltype(result), DynamicArray<double>>);
+    EXPECT_EQ(result.getSize(), 3);
+    EXPECT_DOUBLE_EQ(result[0], -1.5);
+    EXPECT_DOUBLE_EQ(result[2], -1.5);
+}
+
+TEST_F(ExpressionsTest, MixedArraysAndScalars)
+{
+    StaticArray<int, 3> a{1, 2, 3};
+    DynamicArray<int> b{10, 20, 30};
+
+    auto result = evaluate(2 * a + b - 1);
+
+    static_assert(std::is_same_v<decltype(result), StaticArray<int, 3>>);
+    EXPECT_EQ(result[0], 11);
+    EXPECT_EQ(result[1], 23);
+    EXPECT_EQ(result[2], 35);
+
+    auto negated = evaluate(-b);
+
+    EXPECT_EQ(negated[1], -20);
+}
+
+TEST_F(ExpressionsTest, RuntimeSizeMismatchThrows)
+{
+    DynamicArray<int> a{1, 2, 3};
+    DynamicArray<int> b{1, 2};
+    StaticArray<int, 2> c{1, 2};
+
+    EXPECT_THROW(a + b, std::runtime_error);
+    EXPECT_THROW(a * c, std::runtime_error);
+    EXPECT_THROW(assign(a, b + c), std::runtime_error);
+    EXPECT_THROW(a += b, std::runtime_error);
+}
+
+TEST_F(ExpressionsTest, AssignWithoutAllocation)
+{
+    DynamicArray<int> a{1, 2, 3};
+    DynamicArray<int> b{4, 5, 6};
+
+    Statistics before = getGlobalStatistics();
+
+    assign(a, a * b + a);
+
+    EXPECT_EQ((getGlobalStatistics() - before).allocations, 0);
+    EXPECT_EQ(a[0], 5);
+    EXPECT_EQ(a[1], 12);
+    EXPECT_EQ(a[2], 21);
+}
+
+TEST_F(ExpressionsTest, CompoundAssignment)
+{
+    StaticArray<int, 3> a{1, 2, 3};
+    StaticArray<int, 3> b{1, 1, 1};
+
+    a += b * 2;
+    EXPECT_EQ(a[0], 3);
+    EXPECT_EQ(a[2], 5);
+
+    a -= 1;
+    EXPECT_EQ(a[0], 2);
+
+    a *= a;
+    EXPECT_EQ(a[1], 9);
+
+    a /= b + 1;
+    EXPECT_EQ(a[2], 8);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <dsa/structures/arrays/inplace_vector.h>
+#include <dsa/utility/instrumentation.h>
+
+using dsa::structures::arrays::InplaceVector;
+
+class InplaceVectorTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(InplaceVectorTest, DefaultConstructor)
+{
+    InplaceVector<int, 4> arr;
+
+    EXPECT_EQ(arr.getSize(), 0);
+    EXPECT_EQ(arr.getCapacity(), 4);
+    EXPECT_TRUE(arr.isEmpty());
+}
+
+TEST_F(InplaceVectorTest, InitializerListConstructor)
+{
+    InplaceVector<int, 4> arr{1, 2, 3};
+
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[0], 1);
+    EXPECT_EQ(arr[2], 3);
+
+    EXPECT_THROW((InplaceVector<int, 2>{1, 2, 3}), std::runtime_error);
+}
+
+TEST_F(InplaceVectorTest, AddLastUntilFull)
+{
+    InplaceVector<int, 3> arr;
+
+    arr.addLast(1);
+    arr.addLast(2);
+    arr.addLast(3);
+
+    EXPECT_TRUE(arr.isFull());
+    EXPECT_EQ(arr.last(), 3);
+    EXPECT_THROW(arr.addLast(4), std::runtime_error);
+}
+
+TEST_F(InplaceVectorTest, EmplaceLast)
+{
+    InplaceVector<std::string, 2> arr;
+
+    std::string& value = arr.emplaceLast(3, 'x');
+
+    EXPECT_EQ(value, "xxx");
+    EXPECT_EQ(arr.getSize(), 1);
+}
+
+TEST_F(InplaceVectorTest, RemoveMethods)
+{
+    InplaceVector<int, 8> arr{10, 20, 30, 40, 50, 60};
+
+    arr.removeAt(1);
+    EXPECT_EQ(arr[1], 30);
+
+    arr.removeFirst();
+    EXPECT_EQ(arr.first(), 30);
+
+    arr.removeLast();
+    EXPECT_EQ(arr.last(), 50);
+
+    arr.swapRemove(0);
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(arr[0], 50);
+    EXPECT_EQ(arr[1], 40);
+
+    EXPECT_THROW(arr.removeAt(2), std::out_of_range);
+
+    arr.removeLast();
+    arr.removeLast();
+    EXPECT_THROW(arr.removeLast(), std::runtime_error);
+}
+
+TEST_F(InplaceVectorTest, RemoveIfMethod)
+{
+    InplaceVector<int, 8> arr{1, 2, 3, 4, 5, 6};
+
+    EXPECT_EQ(arr.removeIf([](const int& value) { return value % 3 == 0; }), 2);
+    EXPECT_EQ(arr.getSize(), 4);
+    EXPECT_EQ(arr[2], 4);
+    EXPECT_EQ(arr[3], 5);
+}
+
+TEST_F(InplaceVectorTest, DestroysElements)
+{
+    std::shared_ptr<int> shared = std::make_shared<int>(1);
+
+    {
+        InplaceVector<std::shared_ptr<int>, 4> arr;
+
+        arr.addLast(shared);
+        arr.addLast(shared);
+        EXPECT_EQ(shared.use_count(), 3);
+
+        arr.removeLast();
+        EXPECT_EQ(shared.use_count(), 2);
+    }
+
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(InplaceVectorTest, CopyAndMove)
+{
+    InplaceVector<std::string, 4> arr{"a", "b"};
+    InplaceVector<std::string, 4> copy(arr);
+
+    copy.addLast("c");
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(copy.getSize(), 3);
+
+    InplaceVector<std::string, 4> moved(std::move(copy));
+    EXPECT_EQ(moved[2], "c");
+
+    arr = moved;
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[0], "a");
+
+    InplaceVector<std::string, 4> other;
+    other = std::move(arr);
+    EXPECT_EQ(other[1], "b");
+}
+
+TEST_F(InplaceVectorTest, Iteration)
+{
+    InplaceVector<int, 5> arr{1, 2, 3, 4};
+    int sum = 0;
+
+    for (int value : arr) {
+        sum += value;
+    }
+
+    EXPECT_EQ(sum, 10);
+}
+
+TEST_F(InplaceVectorTest, NoHeapAllocation)
+{
+    using namespace dsa::utility::instrumentation;
+
+    Statistics before = getGlobalStatistics();
+
+    InplaceVector<int, 16> arr;
+
+    for (int i = 0; i < 16; ++i) {
+        arr.addLast(i);
+    }
+
+    InplaceVector<int, 16> copy(arr);
+
+    EXPECT_EQ((getGlobalStatistics() - before).allocations, 0);
+    EXPECT_EQ(copy.getSize(), 16);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <dsa/structures/arrays/packed_int_array.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::PackedIntArray;
+
+class PackedIntArrayTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+
+        static void expectRoundTrip(const std::vector<uint32_t>& values)
+        {
+            PackedIntArray packed(values.data(), values.size());
+            std::vector<uint32_t> decoded(values.size());
+
+            packed.decode(decoded.data());
+
+            ASSERT_EQ(packed.getSize(), values.size());
+            EXPECT_EQ(decoded, values);
+
+            for (size_t i = 0; i < values.size(); i++) {
+                ASSERT_EQ(packed[i], values[i]) << "index " << i;
+            }
+        }
+};
+
+TEST_F(PackedIntArrayTest, EmptyArray)
+{
+    PackedIntArray packed;
+
+    EXPECT_TRUE(packed.isEmpty());
+    EXPECT_EQ(packed.getBlockCount(), 0);
+    EXPECT_EQ(packed.decode().getSize(), 0);
+    EXPECT_THROW(packed.get(0), std::out_of_range);
+}
+
+TEST_F(PackedIntArrayTest, SortedIdsUseDelta)
+{
+    std::vector<uint32_t> ids;
+    uint32_t id = 1000000;
+
+    for (size_t i = 0; i < 1000; i++) {
+        id += static_cast<uint32_t>(1 + i % 5);
+        ids.push_back(id);
+    }
+
+    PackedIntArray packed(ids.data(), ids.size());
+
+    EXPECT_EQ(packed.getBlockCount(), 8);
+    EXPECT_EQ(packed.getEncoding(0), PackedIntArray::Encoding::Delta);
+    EXPECT_LE(packed.getBitWidth(0), 5);
+    EXPECT_GT(packed.getCompressionRatio(), 5.0);
+
+    expectRoundTrip(ids);
+}
+
+TEST_F(PackedIntArrayTest, UnsortedUsesFrameOfReference)
+{
+    std::mt19937 random(7);
+    std::vector<uint32_t> values(300);
+
+    for (uint32_t& value : values) {
+        value = 5000 + random() % 1000;
+    }
+
+    PackedIntArray packed(values.data(), values.size());
+
+    EXPECT_EQ(packed.getEncoding(0), PackedIntArray::Encoding::FrameOfReference);
+    EXPECT_EQ(packed.getBitWidth(0), 10);
+
+    expectRoundTrip(values);
+}
+
+TEST_F(PackedIntArrayTest, EveryBitWidth)
+{
+    for (unsigned width = 0; width <= 32; width++)
+    {
+        std::mt19937 random(width);
+        std::vector<uint32_t> values(PackedIntArray::BlockSize);
+        uint64_t limit = uint64_t(1) << width;
+
+        for (uint32_t& value : values) {
+            value = static_cast<uint32_t>(random() % limit);
+        }
+
+        if (width != 0)
+            values[17] = static_cast<uint32_t>(limit - 1);
+
+        values[3] = 0;
+
+        PackedIntArray packed(values.data(), values.size());
+
+        EXPECT_EQ(packed.getBitWidth(0), width);
+        expectRoundTrip(values);
+    }
+}
+
+TEST_F(PackedIntArrayTest, ExtremeValues)
+{
+    expectRoundTrip({0, 0xFFFFFFFFu, 1, 0x80000000u});
+    expectRoundTrip({42});
+    expectRoundTrip(std::vector<uint32_t>(129, 0xFFFFFFFFu));
+}
+
+TEST_F(PackedIntArrayTest, ForEachAndDecodeBlock)
+{
+    DynamicArray<uint32_t> values(200);
+
+    for (size_t i = 0; i < values.getSize(); i++) {
+        values[i] = static_cast<uint32_t>(i * 3);
+    }
+
+    PackedIntArray packed(values);
+    uint64_t sum = 0;
+    uint32_t buffer[PackedIntArray::BlockSize];
+
+    packed.forEach([&sum](uint32_t value) { sum += value; });
+
+    EXPECT_EQ(sum, 3ull * 199 * 200 / 2);
+    EXPECT_EQ(packed.decodeBlock(1, buffer), 72);
+    EXPECT_EQ(buffer[0], 384);
+    EXPECT_THROW(packed.decodeBlock(2, buffer), std::out_of_range);
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <dsa/structures/arrays/per_thread_array.h>
+
+using dsa::structures::arrays::PerThreadArray;
+using dsa::utility::CacheLineSize;
+
+class PerThreadArrayTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(PerThreadArrayTest, SlotsAreOnSeparateCacheLines)
+{
+    PerThreadArray<uint64_t> counters(4);
+
+    EXPECT_EQ(counters.getSize(), 4);
+
+    for (size_t i = 0; i < counters.getSize(); ++i) {
+        EXPECT_EQ(counters[i], 0);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(&counters[i]) % CacheLineSize, 0);
+    }
+
+    EXPECT_GE(reinterpret_cast<uintptr_t>(&counters[1]) - reinterpret_cast<uintptr_t>(&counters[0]), CacheLineSize);
+    EXPECT_THROW(counters.get(4), std::out_of_range);
+}
+
+TEST_F(PerThreadArrayTest, ThreadsCountIndependently)
+{
+    constexpr size_t threadCount = 4;
+    constexpr uint64_t increments = 10000;
+
+    PerThreadArray<std::atomic<uint64_t>> counters(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&counters, t]() {
+            for (uint64_t i = 0; i < increments; ++i) {
+                counters[t].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counters.reduce(uint64_t(0)), threadCount * increments);
+}
+
+TEST_F(PerThreadArrayTest, ReduceWithOperationAndMove)
+{
+    PerThreadArray<int> values(3);
+
+    values[0] = 2;
+    values[1] = 3;
+    values[2] = 4;
+
+    PerThreadArray<int> moved(std::move(values));
+
+    EXPECT_EQ(values.getSize(), 0);
+    EXPECT_EQ(moved.reduce(1, [](int a, int b) { return a * b; }), 24);
+}
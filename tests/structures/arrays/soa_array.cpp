@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <dsa/structures/arrays/soa_array.h>
+
+using dsa::structures::arrays::SoAArray;
+
+class SoAArrayTest : public ::testing::Test
+{
+    protected:
+        SoAArray<int, double, std::string> arr;
+
+        void SetUp() override {
+            arr.addLast(1, 1.5, "one");
+            arr.addLast(2, 2.5, "two");
+            arr.addLast(3, 3.5, "three");
+        }
+};
+
+TEST_F(SoAArrayTest, DefaultConstructor)
+{
+    SoAArray<int, float> empty;
+
+    EXPECT_EQ(empty.getSize(), 0);
+    EXPECT_EQ(empty.getCapacity(), 0);
+    EXPECT_EQ(empty.column<0>().getSize(), 0);
+}
+
+TEST_F(SoAArrayTest, AddLastMethod)
+{
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_GE(arr.getCapacity(), 3);
+
+    EXPECT_EQ(arr[0].get<0>(), 1);
+    EXPECT_DOUBLE_EQ(arr[1].get<1>(), 2.5);
+    EXPECT_EQ(arr[2].get<2>(), "three");
+}
+
+TEST_F(SoAArrayTest, GetMethod)
+{
+    auto row = arr.get(1);
+
+    EXPECT_EQ(row.getIndex(), 1);
+    EXPECT_EQ(row.get<0>(), 2);
+    EXPECT_EQ(row.get<2>(), "two");
+
+    row.get<0>() = 20;
+    EXPECT_EQ(arr.column<0>()[1], 20);
+
+    EXPECT_THROW(arr.get(3), std::out_of_range);
+}
+
+TEST_F(SoAArrayTest, ConstGetMethod)
+{
+    const SoAArray<int, double, std::string>& constArr = arr;
+
+    EXPECT_EQ(constArr.get(2).get<0>(), 3);
+    EXPECT_EQ(constArr[0].toTuple(), std::make_tuple(1, 1.5, std::string("one")));
+
+    EXPECT_THROW(constArr.get(10), std::out_of_range);
+}
+
+TEST_F(SoAArrayTest, SetMethod)
+{
+    arr.set(0, 10, 10.5, "ten");
+
+    EXPECT_EQ(arr[0].get<0>(), 10);
+    EXPECT_DOUBLE_EQ(arr[0].get<1>(), 10.5);
+    EXPECT_EQ(arr[0].get<2>(), "ten");
+
+    EXPECT_THROW(arr.set(3, 0, 0.0, ""), std::out_of_range);
+}
+
+TEST_F(SoAArrayTest, ColumnIsContiguous)
+{
+    auto ids = arr.column<0>();
+
+    EXPECT_EQ(ids.getSize(), 3);
+    EXPECT_EQ(ids.getData() + 1, &arr[1].get<0>());
+    EXPECT_EQ(ids.getData() + 2, &arr[2].get<0>());
+
+    int sum = 0;
+
+    for (int id : ids) {
+        sum += id;
+    }
+
+    EXPECT_EQ(sum, 6);
+    EXPECT_THROW(ids.get(3), std::out_of_range);
+}
+
+TEST_F(SoAArrayTest, RemoveAtMethod)
+{
+    arr.removeAt(1);
+
+    EXPECT_EQ(arr.getSize(), 2);
+    EXPECT_EQ(arr[0].get<2>(), "one");
+    EXPECT_EQ(arr[1].get<0>(), 3);
+    EXPECT_DOUBLE_EQ(arr[1].get<1>(), 3.5);
+    EXPECT_EQ(arr[1].get<2>(), "three");
+
+    EXPECT_THROW(arr.removeAt(2), std::out_of_range);
+}
+
+TEST_F(SoAArrayTest, RemoveLastMethod)
+{
+    arr.removeLast();
+    arr.removeLast();
+    arr.removeLast();
+
+    EXPECT_EQ(arr.getSize(), 0);
+    EXPECT_THROW(arr.removeLast(), std::runtime_error);
+}
+
+TEST_F(SoAArrayTest, ReserveKeepsRows)
+{
+    arr.reserve(100);
+
+    EXPECT_EQ(arr.getCapacity(), 100);
+    EXPECT_EQ(arr.getSize(), 3);
+    EXPECT_EQ(arr[2].get<2>(), "three");
+}
+
+TEST_F(SoAArrayTest, CopyConstructor)
+{
+    SoAArray<int, double, std::string> copy(arr);
+
+    EXPECT_EQ(copy.getSize(), 3);
+    EXPECT_EQ(copy[1].get<2>(), "two");
+
+    arr[1].get<2>() = "changed";
+    EXPECT_EQ(copy[1].get<2>(), "two");
+}
+
+TEST_F(SoAArrayTest, MoveConstructorAndAssignment)
+{
+    SoAArray<int, double, std::string> moved(std::move(arr));
+
+    EXPECT_EQ(moved.getSize(), 3);
+    EXPECT_EQ(arr.getSize(), 0);
+
+    SoAArray<int, double, std::string> assigned;
+    assigned = std::move(moved);
+
+    EXPECT_EQ(assigned.getSize(), 3);
+    EXPECT_EQ(assigned[0].get<0>(), 1);
+    EXPECT_EQ(moved.getSize(), 0);
+}
+
+TEST_F(SoAArrayTest, CopyAssignmentOperator)
+{
+    SoAArray<int, double, std::string> other;
+    other.addLast(9, 9.5, "nine");
+
+    other = arr;
+    EXPECT_EQ(other.getSize(), 3);
+    EXPECT_EQ(other[2].get<0>(), 3);
+
+    other = other;
+    EXPECT_EQ(other.getSize(), 3);
+}
+
+TEST_F(SoAArrayTest, RowIterator)
+{
+    std::vector<int> ids;
+
+    for (auto row : arr) {
+        ids.push_back(row.get<0>());
+        row.get<1>() *= 2;
+    }
+
+    EXPECT_EQ(ids, (std::vector<int>{1, 2, 3}));
+    EXPECT_DOUBLE_EQ(arr[2].get<1>(), 7.0);
+}
+
+TEST_F(SoAArrayTest, ConstRowIterator)
+{
+    const SoAArray<int, double, std::string>& view = arr;
+    std::string names;
+
+    for (auto row : view) {
+        names += row.get<2>();
+    }
+
+    EXPECT_EQ(names, "onetwothree");
+}
+
+TEST_F(SoAArrayTest, RowSetMethod)
+{
+    arr[1].set<0>(20);
+    arr[1].set<2>("twenty");
+
+    EXPECT_EQ(arr[1].get<0>(), 20);
+    EXPECT_EQ(arr.column<2>()[1], "twenty");
+    EXPECT_DOUBLE_EQ(arr[1].get<1>(), 2.5);
+}
+
+TEST_F(SoAArrayTest, RemovalReleasesFields)
+{
+    SoAArray<int, std::shared_ptr<int>> owners;
+    std::shared_ptr<int> first = std::make_shared<int>(1);
+    std::shared_ptr<int> second = std::make_shared<int>(2);
+    std::shared_ptr<int> third = std::make_shared<int>(3);
+
+    owners.addLast(1, first);
+    owners.addLast(2, second);
+    owners.addLast(3, third);
+
+    owners.removeLast();
+    EXPECT_EQ(third.use_count(), 1);
+
+    owners.removeAt(0);
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 2);
+
+    owners.clear();
+    EXPECT_EQ(second.use_count(), 1);
+}
+
+TEST_F(SoAArrayTest, StressTest)
+{
+    SoAArray<int, float> big;
+
+    for (int i = 0; i < 1000; ++i) {
+        big.addLast(i, static_cast<float>(i) / 2);
+    }
+
+    EXPECT_EQ(big.getSize(), 1000);
+
+    long long sum = 0;
+
+    for (int value : big.column<0>()) {
+        sum += value;
+    }
+
+    EXPECT_EQ(sum, 499500);
+    EXPECT_FLOAT_EQ(big[999].get<1>(), 499.5f);
+}
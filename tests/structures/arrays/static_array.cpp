@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <stdexcept>
+#include <type_traits>
 #include <dsa/structures/arrays/static_array.h>
 
 using namespace dsa::structures::arrays;
@@ -463,5 +465,60 @@ TEST_F(StaticArrayTest, MemoryManagement)
     {
         StaticArray<int, 5> arr1{1, 2, 3, 4, 5};
         StaticArray<int, 5> arr2 = std::move(arr1);
+        EXPECT_EQ(arr2[4], 5);
     }
 }
+
+TEST_F(StaticArrayTest, GetDataMethod)
+{
+    StaticArray<int, 3> arr = {1, 2, 3};
+
+    EXPECT_EQ(arr.getData(), &arr[0]);
+
+    arr.getData()[1] = 20;
+    EXPECT_EQ(arr[1], 20);
+
+    const StaticArray<int, 3>& constArr = arr;
+    EXPECT_EQ(constArr.getData()[2], 3);
+}
+
+TEST_F(StaticArrayTest, ConstexprArray)
+{
+    constexpr StaticArray<int, 4> arr{1, 2, 3, 4};
+    constexpr StaticArray<int, 4> copy(arr);
+
+    static_assert(StaticArray<int, 4>::getSize() == 4);
+    static_assert(arr[0] == 1 && arr.get(3) == 4);
+    static_assert(copy.getData()[2] == 3);
+
+    constexpr StaticArray<int, 3> squares = []()
+    {
+        StaticArray<int, 3> result;
+
+        for (size_t i = 0; i < result.getSize(); i++)
+            result.set(i, static_cast<int>(i * i));
+
+        return result;
+    }();
+
+    static_assert(squares[2] == 4);
+    EXPECT_EQ(squares[1], 1);
+}
+
+TEST_F(StaticArrayTest, StorageIsInline)
+{
+    EXPECT_EQ(sizeof(StaticArray<int, 16>), 16 * sizeof(int));
+    EXPECT_TRUE((std::is_trivially_destructible_v<StaticArray<int, 16>>));
+}
+
+TEST_F(StaticArrayTest, OverAlignedStorage)
+{
+    StaticArray<float, 5, 32> arr{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+
+    EXPECT_EQ(alignof(StaticArray<float, 5, 32>), 32);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.getData()) % 32, 0);
+    EXPECT_EQ(arr[4], 5.0f);
+
+    constexpr StaticArray<int, 2, 64> aligned{7, 8};
+    static_assert(aligned[1] == 8);
+}
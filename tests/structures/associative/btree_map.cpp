@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <dsa/structures/associative/btree_map.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::associative::BTreeMap;
+
+using SmallBTreeMap = BTreeMap<int, int, std::less<int>, 64>;
+
+namespace
+{
+    template<typename Map>
+    std::vector<std::pair<int, int>> collect(Map& map) {
+        std::vector<std::pair<int, int>> entries;
+
+        for (auto entry : map)
+        {
+            entries.emplace_back(entry.first, entry.second);
+        }
+
+        return entries;
+    }
+}
+
+class BTreeMapTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+};
+
+TEST_F(BTreeMapTest, DefaultConstructor)
+{
+    BTreeMap<int, std::string> map;
+
+    EXPECT_EQ(map.getSize(), 0);
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.getHeight(), 0);
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.find(1), nullptr);
+    EXPECT_THROW(map.get(1), std::out_of_range);
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST_F(BTreeMapTest, InsertAndReplace)
+{
+    BTreeMap<int, std::string> map;
+
+    EXPECT_TRUE(map.insert(3, "three"));
+    EXPECT_TRUE(map.insert(1, "one"));
+    EXPECT_FALSE(map.insert(3, "THREE"));
+
+    EXPECT_EQ(map.getSize(), 2);
+    EXPECT_EQ(map.get(3), "THREE");
+    EXPECT_EQ(map[1], "one");
+
+    map[1] = "uno";
+    EXPECT_EQ(*map.find(1), "uno");
+}
+
+TEST_F(BTreeMapTest, IterationIsSortedAcrossSplits)
+{
+    SmallBTreeMap map;
+    std::vector<std::pair<int, int>> expected;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        map.insert((i * 7919) % 1000, i);
+    }
+
+    for (int i = 0; i < 1000; i++)
+    {
+        expected.emplace_back(i, map.get(i));
+    }
+
+    EXPECT_EQ(map.getSize(), 1000);
+    EXPECT_GT(map.getHeight(), 2);
+    EXPECT_EQ(collect(map), expected);
+}
+
+TEST_F(BTreeMapTest, RandomOperationsMatchStdMap)
+{
+    SmallBTreeMap map;
+    std::map<int, int> reference;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> keys(0, 2000);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = keys(generator);
+
+        if (generator() % 3 == 0)
+        {
+            EXPECT_EQ(map.erase(key), reference.erase(key) == 1);
+        }
+        else
+        {
+            EXPECT_EQ(map.insert(key, i), reference.find(key) == reference.end());
+            reference[key] = i;
+        }
+    }
+
+    EXPECT_EQ(map.getSize(), reference.size());
+
+    std::vector<std::pair<int, int>> expected(reference.begin(), reference.end());
+    EXPECT_EQ(collect(map), expected);
+
+    for (int key = 0; key <= 2000; key++)
+    {
+        EXPECT_EQ(map.contains(key), reference.count(key) == 1);
+    }
+}
+
+TEST_F(BTreeMapTest, EraseToEmpty)
+{
+    SmallBTreeMap map;
+
+    for (int i = 0; i < 500; i++)
+    {
+        map.insert(i, i);
+    }
+
+    for (int i = 0; i < 500; i += 2)
+    {
+        EXPECT_TRUE(map.erase(i));
+    }
+
+    EXPECT_FALSE(map.erase(0));
+    EXPECT_EQ(map.getSize(), 250);
+
+    for (int i = 499; i > 0; i -= 2)
+    {
+        EXPECT_TRUE(map.erase(i));
+    }
+
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.getHeight(), 0);
+    EXPECT_TRUE(map.begin() == map.end());
+
+    map.insert(7, 7);
+    EXPECT_EQ(map.get(7), 7);
+}
+
+TEST_F(BTreeMapTest, RangeScan)
+{
+    SmallBTreeMap map;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        map.insert(i * 2, i);
+    }
+
+    std::vector<int> keys;
+    map.forEachInRange(101, 141, [&keys](const int& key, int& value) {
+        keys.push_back(key);
+        value = -1;
+    });
+
+    std::vector<int> expected;
+
+    for (int key = 102; key < 141; key += 2)
+    {
+        expected.push_back(key);
+    }
+
+    EXPECT_EQ(keys, expected);
+    EXPECT_EQ(map.get(102), -1);
+    EXPECT_EQ(map.get(100), 50);
+    EXPECT_EQ((*map.lowerBound(1997)).first, 1998);
+    EXPECT_TRUE(map.lowerBound(1999) == map.end());
+}
+
+TEST_F(BTreeMapTest, BulkLoad)
+{
+    SmallBTreeMap map;
+    DynamicArray<std::pair<int, int>> entries(1000);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        entries[i] = std::pair<int, int>(i * 3, i);
+    }
+
+    map.insert(1, 1);
+    map.bulkLoad(std::move(entries));
+
+    EXPECT_EQ(map.getSize(), 1000);
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.get(2997), 999);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        map.insert(i * 3 + 1, -i);
+    }
+
+    for (int i = 0; i < 1000; i += 3)
+    {
+        map.erase(i * 3);
+    }
+
+    EXPECT_EQ(map.getSize(), 1666);
+    EXPECT_EQ(map.get(1), 0);
+    EXPECT_FALSE(map.contains(0));
+    EXPECT_EQ(map.get(3), 1);
+}
+
+TEST_F(BTreeMapTest, BulkLoadRejectsUnsortedEntries)
+{
+    SmallBTreeMap map;
+
+    EXPECT_THROW(map.bulkLoad(DynamicArray<std::pair<int, int>>{{1, 1}, {3, 3}, {2, 2}}), std::runtime_error);
+    EXPECT_THROW(map.bulkLoad(DynamicArray<std::pair<int, int>>{{1, 1}, {1, 2}}), std::runtime_error);
+}
+
+TEST_F(BTreeMapTest, MoveTransfersEntries)
+{
+    SmallBTreeMap map;
+
+    for (int i = 0; i < 100; i++)
+    {
+        map.insert(i, i);
+    }
+
+    SmallBTreeMap moved(std::move(map));
+
+    EXPECT_EQ(moved.getSize(), 100);
+    EXPECT_TRUE(map.isEmpty());
+
+    map = std::move(moved);
+    EXPECT_EQ(map.get(99), 99);
+}
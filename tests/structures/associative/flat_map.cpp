@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <dsa/structures/associative/flat_map.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::associative::FlatLayout;
+using dsa::structures::associative::FlatMap;
+
+template<typename Map>
+class FlatMapTest : public ::testing::Test
+{
+};
+
+using FlatMapLayouts = ::testing::Types<
+    FlatMap<int, std::string, std::less<int>, FlatLayout::Sorted>,
+    FlatMap<int, std::string, std::less<int>, FlatLayout::Eytzinger>>;
+
+TYPED_TEST_SUITE(FlatMapTest, FlatMapLayouts);
+
+TYPED_TEST(FlatMapTest, DefaultConstructor)
+{
+    TypeParam map;
+
+    EXPECT_EQ(map.getSize(), 0);
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.find(1), nullptr);
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+TYPED_TEST(FlatMapTest, BuildFromUnsortedEntries)
+{
+    TypeParam map{{5, "five"}, {1, "one"}, {3, "three"}, {9, "nine"}, {7, "seven"}};
+
+    EXPECT_EQ(map.getSize(), 5);
+    EXPECT_EQ(map.get(1), "one");
+    EXPECT_EQ(map.get(9), "nine");
+    EXPECT_EQ(map[7], "seven");
+
+    EXPECT_FALSE(map.contains(0));
+    EXPECT_FALSE(map.contains(4));
+    EXPECT_FALSE(map.contains(10));
+    EXPECT_THROW(map.get(4), std::out_of_range);
+}
+
+TYPED_TEST(FlatMapTest, DuplicateKeysKeepFirstEntry)
+{
+    TypeParam map{{2, "first"}, {1, "one"}, {2, "second"}};
+
+    EXPECT_EQ(map.getSize(), 2);
+    EXPECT_EQ(map.get(2), "first");
+}
+
+TYPED_TEST(FlatMapTest, ValuesAreMutable)
+{
+    TypeParam map{{1, "one"}, {2, "two"}};
+
+    map[2] = "TWO";
+    *map.find(1) = "ONE";
+
+    EXPECT_EQ(map.get(1), "ONE");
+    EXPECT_EQ(map.get(2), "TWO");
+}
+
+TYPED_TEST(FlatMapTest, IterationIsSorted)
+{
+    TypeParam map{{4, "d"}, {2, "b"}, {5, "e"}, {1, "a"}, {3, "c"}, {6, "f"}};
+    std::vector<int> keys;
+    std::string values;
+
+    for (auto entry : map) {
+        keys.push_back(entry.first);
+        values += entry.second;
+    }
+
+    EXPECT_EQ(keys, (std::vector<int>{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(values, "abcdef");
+
+    const TypeParam& constMap = map;
+    int count = 0;
+
+    for (auto entry : constMap) {
+        EXPECT_EQ(entry.first, ++count);
+    }
+
+    EXPECT_EQ(count, 6);
+}
+
+TYPED_TEST(FlatMapTest, MatchesStdMap)
+{
+    std::mt19937 random(7);
+    std::map<int, std::string> reference;
+    DynamicArray<std::pair<int, std::string>> entries;
+
+    for (int i = 0; i < 2000; ++i) {
+        int key = static_cast<int>(random() % 5000);
+        entries.addLast({key, std::to_string(i)});
+        reference.insert({key, std::to_string(i)});
+    }
+
+    TypeParam map(entries);
+
+    EXPECT_EQ(map.getSize(), reference.size());
+
+    for (int key = -1; key <= 5001; ++key) {
+        auto it = reference.find(key);
+
+        if (it == reference.end()) {
+            EXPECT_FALSE(map.contains(key));
+        }
+        else {
+            ASSERT_TRUE(map.contains(key));
+            EXPECT_EQ(map.get(key), it->second);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <set>
+#include <random>
+#include <vector>
+#include <dsa/structures/associative/flat_set.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::associative::FlatLayout;
+using dsa::structures::associative::FlatSet;
+
+template<typename Set>
+class FlatSetTest : public ::testing::Test
+{
+};
+
+using FlatSetLayouts = ::testing::Types<
+    FlatSet<int, std::less<int>, FlatLayout::Sorted>,
+    FlatSet<int, std::less<int>, FlatLayout::Eytzinger>,
+    FlatSet<int, std::greater<int>, FlatLayout::Eytzinger>>;
+
+TYPED_TEST_SUITE(FlatSetTest, FlatSetLayouts);
+
+TYPED_TEST(FlatSetTest, DefaultConstructor)
+{
+    TypeParam set;
+
+    EXPECT_EQ(set.getSize(), 0);
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_FALSE(set.contains(0));
+}
+
+TYPED_TEST(FlatSetTest, BuildRemovesDuplicates)
+{
+    TypeParam set{3, 1, 3, 2, 1};
+
+    EXPECT_EQ(set.getSize(), 3);
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_TRUE(set.contains(2));
+    EXPECT_TRUE(set.contains(3));
+    EXPECT_FALSE(set.contains(4));
+}
+
+TYPED_TEST(FlatSetTest, RebuildReplacesContent)
+{
+    TypeParam set{1, 2, 3};
+
+    set.build(DynamicArray<int>{10, 20});
+
+    EXPECT_EQ(set.getSize(), 2);
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_TRUE(set.contains(20));
+}
+
+TYPED_TEST(FlatSetTest, MatchesStdSet)
+{
+    std::mt19937 random(3);
+    DynamicArray<int> keys;
+    std::set<int> reference;
+
+    for (int i = 0; i < 3000; ++i) {
+        int key = static_cast<int>(random() % 10000);
+        keys.addLast(key);
+        reference.insert(key);
+    }
+
+    TypeParam set(keys);
+
+    EXPECT_EQ(set.getSize(), reference.size());
+
+    for (int key = -5; key < 10005; ++key) {
+        EXPECT_EQ(set.contains(key), reference.count(key) == 1);
+    }
+}
+
+TYPED_TEST(FlatSetTest, IterationFollowsComparator)
+{
+    TypeParam set{8, 3, 5, 1, 9, 2, 7};
+    std::vector<int> keys;
+
+    for (int key : set) {
+        keys.push_back(key);
+    }
+
+    ASSERT_EQ(keys.size(), 7);
+
+    for (size_t i = 1; i < keys.size(); ++i) {
+        EXPECT_NE(keys[i - 1], keys[i]);
+    }
+
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()) || std::is_sorted(keys.rbegin(), keys.rend()));
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dsa/structures/concurrent/lock_free_skip_list.h>
+
+using dsa::structures::concurrent::LockFreeSkipList;
+
+class LockFreeSkipListTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+};
+
+TEST_F(LockFreeSkipListTest, DefaultConstructor)
+{
+    LockFreeSkipList<int, std::string> list;
+    std::string value;
+
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_FALSE(list.find(1, value));
+    EXPECT_FALSE(list.erase(1));
+}
+
+TEST_F(LockFreeSkipListTest, InsertFindErase)
+{
+    LockFreeSkipList<int, std::string> list;
+    std::string value;
+
+    EXPECT_TRUE(list.insert(2, "two"));
+    EXPECT_TRUE(list.insert(1, "one"));
+    EXPECT_FALSE(list.insert(2, "TWO"));
+
+    EXPECT_EQ(list.getSize(), 2);
+    EXPECT_TRUE(list.find(2, value));
+    EXPECT_EQ(value, "two");
+
+    EXPECT_TRUE(list.erase(2));
+    EXPECT_FALSE(list.erase(2));
+    EXPECT_FALSE(list.contains(2));
+    EXPECT_TRUE(list.contains(1));
+
+    EXPECT_TRUE(list.insert(2, "again"));
+    EXPECT_TRUE(list.find(2, value));
+    EXPECT_EQ(value, "again");
+}
+
+TEST_F(LockFreeSkipListTest, RandomOperationsMatchStdMap)
+{
+    LockFreeSkipList<int, int> list;
+    std::map<int, int> reference;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> keys(0, 1000);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = keys(generator);
+
+        if (generator() % 2 == 0)
+            EXPECT_EQ(list.erase(key), reference.erase(key) == 1);
+        else
+            EXPECT_EQ(list.insert(key, i), reference.emplace(key, i).second);
+    }
+
+    std::vector<std::pair<int, int>> entries;
+    list.forEachInRange(0, 1001, [&entries](const int& key, const int& value) {
+        entries.emplace_back(key, value);
+    });
+
+    std::vector<std::pair<int, int>> expected(reference.begin(), reference.end());
+
+    EXPECT_EQ(list.getSize(), reference.size());
+    EXPECT_EQ(entries, expected);
+}
+
+TEST_F(LockFreeSkipListTest, RangeScan)
+{
+    LockFreeSkipList<int, int> list;
+
+    for (int i = 0; i < 100; i++)
+    {
+        list.insert(i * 2, i);
+    }
+
+    std::vector<int> keys;
+    list.forEachInRange(11, 21, [&keys](const int& key, const int&) {
+        keys.push_back(key);
+    });
+
+    EXPECT_EQ(keys, (std::vector<int>{12, 14, 16, 18, 20}));
+}
+
+TEST_F(LockFreeSkipListTest, ConcurrentInsertsOfDisjointKeys)
+{
+    constexpr int threadCount = 4;
+    constexpr int keysPerThread = 5000;
+    LockFreeSkipList<int, int> list;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&list, t]()
+        {
+            for (int i = 0; i < keysPerThread; i++)
+            {
+                EXPECT_TRUE(list.insert(i * threadCount + t, t));
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    int expected = 0;
+    list.forEachInRange(0, threadCount * keysPerThread, [&expected](const int& key, const int& value) {
+        EXPECT_EQ(key, expected);
+        EXPECT_EQ(value, key % threadCount);
+        expected++;
+    });
+
+    EXPECT_EQ(expected, threadCount * keysPerThread);
+    EXPECT_EQ(list.getSize(), threadCount * keysPerThread);
+}
+
+TEST_F(LockFreeSkipListTest, ConcurrentInsertsAndErasesOfSharedKeys)
+{
+    constexpr int threadCount = 4;
+    constexpr int keyRange = 256;
+    LockFreeSkipList<int, int> list;
+    std::vector<std::thread> threads;
+    std::atomic<int> balance{0};
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&list, &balance, t]()
+        {
+            std::mt19937 generator(t);
+
+            for (int i = 0; i < 20000; i++)
+            {
+                int key = static_cast<int>(generator() % keyRange);
+
+                if (generator() % 2 == 0)
+                    balance += list.insert(key, key) ? 1 : 0;
+                else
+                    balance -= list.erase(key) ? 1 : 0;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    int count = 0;
+    int previous = -1;
+    list.forEachInRange(0, keyRange, [&count, &previous](const int& key, const int& value) {
+        EXPECT_LT(previous, key);
+        EXPECT_EQ(key, value);
+        previous = key;
+        count++;
+    });
+
+    EXPECT_EQ(count, balance);
+    EXPECT_EQ(list.getSize(), static_cast<size_t>(balance));
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <dsa/structures/filters/bloom_filter.h>
+
+using dsa::structures::filters::BloomFilter;
+
+class BloomFilterTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+};
+
+TEST_F(BloomFilterTest, EmptyFilterContainsNothing)
+{
+    BloomFilter<int> filter(1000, 0.01);
+
+    EXPECT_EQ(filter.getSize(), 0);
+    EXPECT_EQ(filter.getBitCount() % BloomFilter<int>::BlockBits, 0);
+    EXPECT_EQ(filter.getHashCount(), 7);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_FALSE(filter.contains(i));
+    }
+}
+
+TEST_F(BloomFilterTest, InvalidFalsePositiveRateThrows)
+{
+    EXPECT_THROW(BloomFilter<int>(10, 0), std::invalid_argument);
+    EXPECT_THROW(BloomFilter<int>(10, 1), std::invalid_argument);
+}
+
+TEST_F(BloomFilterTest, NoFalseNegativesAndBoundedFalsePositives)
+{
+    constexpr int count = 100000;
+
+    for (double rate : {0.1, 0.01, 0.001})
+    {
+        BloomFilter<int> filter(count, rate);
+
+        for (int i = 0; i < count; i++)
+        {
+            filter.insert(i * 2);
+        }
+
+        int falsePositives = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            EXPECT_TRUE(filter.contains(i * 2));
+            falsePositives += filter.contains(i * 2 + 1);
+        }
+
+        EXPECT_LT(static_cast<double>(falsePositives) / count, rate * 1.5);
+        EXPECT_GT(filter.getBitsPerKey(), 0);
+    }
+}
+
+TEST_F(BloomFilterTest, ContainsManyMatchesContains)
+{
+    BloomFilter<std::string> filter(1000, 0.05);
+    std::vector<std::string> keys;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        filter.insert("key" + std::to_string(i));
+    }
+
+    for (int i = 0; i < 2000; i += 3)
+    {
+        keys.push_back("key" + std::to_string(i));
+    }
+
+    std::unique_ptr<bool[]> results(new bool[keys.size()]);
+    size_t positives = filter.containsMany(keys.data(), keys.size(), results.get());
+    size_t expected = 0;
+
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(results[i], filter.contains(keys[i]));
+        expected += results[i];
+    }
+
+    EXPECT_EQ(positives, expected);
+
+    filter.clear();
+    EXPECT_FALSE(filter.contains("key0"));
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <dsa/structures/filters/cuckoo_filter.h>
+
+using dsa::structures::filters::CuckooFilter;
+
+class CuckooFilterTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+};
+
+TEST_F(CuckooFilterTest, FingerprintSizeFollowsFalsePositiveRate)
+{
+    EXPECT_EQ(CuckooFilter<int>(100, 0.1).getFingerprintBits(), 7);
+    EXPECT_EQ(CuckooFilter<int>(100, 0.01).getFingerprintBits(), 10);
+    EXPECT_EQ(CuckooFilter<int>(100, 0.000001).getFingerprintBits(), 16);
+    EXPECT_THROW(CuckooFilter<int>(100, 2), std::invalid_argument);
+}
+
+TEST_F(CuckooFilterTest, NoFalseNegativesAndBoundedFalsePositives)
+{
+    constexpr int count = 100000;
+
+    for (double rate : {0.1, 0.01, 0.001})
+    {
+        CuckooFilter<int> filter(count, rate);
+
+        for (int i = 0; i < count; i++)
+        {
+            EXPECT_TRUE(filter.insert(i * 2));
+        }
+
+        EXPECT_FALSE(filter.isFull());
+
+        int falsePositives = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            EXPECT_TRUE(filter.contains(i * 2));
+            falsePositives += filter.contains(i * 2 + 1);
+        }
+
+        EXPECT_LT(static_cast<double>(falsePositives) / count, rate);
+        EXPECT_EQ(filter.getSize(), count);
+    }
+}
+
+TEST_F(CuckooFilterTest, EraseRemovesKeys)
+{
+    CuckooFilter<int> filter(10000, 0.001);
+
+    for (int i = 0; i < 10000; i++)
+    {
+        filter.insert(i);
+    }
+
+    for (int i = 0; i < 10000; i += 2)
+    {
+        EXPECT_TRUE(filter.erase(i));
+    }
+
+    int falsePositives = 0;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        if (i % 2 == 1)
+            EXPECT_TRUE(filter.contains(i));
+        else
+            falsePositives += filter.contains(i);
+    }
+
+    EXPECT_LT(falsePositives, 20);
+    EXPECT_EQ(filter.getSize(), 5000);
+
+    filter.insert(7);
+    EXPECT_TRUE(filter.erase(7));
+    EXPECT_TRUE(filter.contains(7));
+    EXPECT_TRUE(filter.erase(7));
+}
+
+TEST_F(CuckooFilterTest, FillsToHighLoadFactor)
+{
+    CuckooFilter<int> filter(10000, 0.01);
+    int inserted = 0;
+
+    while (filter.insert(inserted))
+    {
+        inserted++;
+    }
+
+    EXPECT_TRUE(filter.isFull());
+    EXPECT_GT(filter.getLoadFactor(), 0.9);
+
+    for (int i = 0; i < inserted; i++)
+    {
+        EXPECT_TRUE(filter.contains(i));
+    }
+
+    for (int i = 0; i < inserted / 2; i++)
+    {
+        EXPECT_TRUE(filter.erase(i));
+    }
+
+    EXPECT_FALSE(filter.isFull());
+    EXPECT_TRUE(filter.contains(inserted - 1));
+    EXPECT_TRUE(filter.insert(inserted));
+}
+
+TEST_F(CuckooFilterTest, ContainsManyMatchesContains)
+{
+    CuckooFilter<std::string> filter(1000, 0.05);
+    std::vector<std::string> keys;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        filter.insert("key" + std::to_string(i));
+    }
+
+    for (int i = 0; i < 2000; i += 3)
+    {
+        keys.push_back("key" + std::to_string(i));
+    }
+
+    std::unique_ptr<bool[]> results(new bool[keys.size()]);
+    size_t positives = filter.containsMany(keys.data(), keys.size(), results.get());
+    size_t expected = 0;
+
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(results[i], filter.contains(keys[i]));
+        expected += results[i];
+    }
+
+    EXPECT_EQ(positives, expected);
+
+    filter.clear();
+    EXPECT_FALSE(filter.contains("key0"));
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+#include "random_edges.h"
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::graphs::CsrGraph;
+
+class CsrGraphTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+
+        static std::vector<std::vector<uint32_t>> makeAdjacency(size_t vertexCount, DynamicArray<CsrGraph::EdgeType>& edges, bool undirected)
+        {
+            std::vector<std::vector<uint32_t>> adjacency(vertexCount);
+
+            for (size_t i = 0; i < edges.getSize(); i++)
+            {
+                adjacency[edges[i].first].push_back(edges[i].second);
+
+                if (undirected)
+                    adjacency[edges[i].second].push_back(edges[i].first);
+            }
+
+            for (std::vector<uint32_t>& neighbors : adjacency)
+            {
+                std::sort(neighbors.begin(), neighbors.end());
+            }
+
+            return adjacency;
+        }
+
+        static void expectAdjacency(const CsrGraph& graph, const std::vector<std::vector<uint32_t>>& adjacency)
+        {
+            ASSERT_EQ(graph.getVertexCount(), adjacency.size());
+
+            for (size_t v = 0; v < adjacency.size(); v++)
+            {
+                ASSERT_EQ(graph.getDegree(v), adjacency[v].size());
+                EXPECT_TRUE(std::equal(adjacency[v].begin(), adjacency[v].end(), graph.getNeighbors(v)));
+            }
+        }
+};
+
+TEST_F(CsrGraphTest, EmptyGraph)
+{
+    CsrGraph graph;
+
+    EXPECT_EQ(graph.getVertexCount(), 0);
+    EXPECT_EQ(graph.getEdgeCount(), 0);
+    EXPECT_FALSE(graph.isUndirected());
+    EXPECT_THROW(graph.getDegree(0), std::out_of_range);
+    EXPECT_THROW(graph.getNeighbors(0), std::out_of_range);
+}
+
+TEST_F(CsrGraphTest, BuildsSortedAdjacency)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = {{0, 2}, {0, 1}, {2, 0}, {3, 3}, {0, 2}};
+    CsrGraph graph(5, edges);
+
+    EXPECT_EQ(graph.getVertexCount(), 5);
+    EXPECT_EQ(graph.getEdgeCount(), 5);
+    EXPECT_EQ(graph.getMemoryBytes(), 6 * sizeof(uint64_t) + 5 * sizeof(uint32_t));
+    expectAdjacency(graph, {{1, 2, 2}, {}, {0}, {3}, {}});
+}
+
+TEST_F(CsrGraphTest, UndirectedStoresBothDirections)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = {{0, 1}, {1, 2}, {3, 1}};
+    CsrGraph graph(4, edges, true);
+
+    EXPECT_TRUE(graph.isUndirected());
+    EXPECT_EQ(graph.getEdgeCount(), 6);
+    expectAdjacency(graph, {{1}, {0, 2, 3}, {1}, {1}});
+}
+
+TEST_F(CsrGraphTest, InvalidVertexThrows)
+{
+    DynamicArray<CsrGraph::EdgeType> edges = {{0, 1}, {1, 4}};
+
+    EXPECT_THROW(CsrGraph(4, edges), std::out_of_range);
+    EXPECT_THROW(CsrGraph(4, edges, true, 4), std::out_of_range);
+}
+
+TEST_F(CsrGraphTest, RandomGraphMatchesAdjacencyLists)
+{
+    constexpr size_t vertexCount = 50000;
+    DynamicArray<CsrGraph::EdgeType> edges = makeEdges(vertexCount, 600000, 1);
+
+    for (bool undirected : {false, true})
+    {
+        std::vector<std::vector<uint32_t>> adjacency = makeAdjacency(vertexCount, edges, undirected);
+
+        for (size_t threadCount : {1, 4})
+        {
+            expectAdjacency(CsrGraph(vertexCount, edges, undirected, threadCount), adjacency);
+        }
+    }
+}
+
+TEST_F(CsrGraphTest, TransposeReversesEdges)
+{
+    constexpr size_t vertexCount = 1000;
+    DynamicArray<CsrGraph::EdgeType> edges = makeEdges(vertexCount, 8000, 2);
+    DynamicArray<CsrGraph::EdgeType> reversed(edges.getSize());
+
+    for (size_t i = 0; i < edges.getSize(); i++)
+    {
+        reversed[i] = CsrGraph::EdgeType(edges[i].second, edges[i].first);
+    }
+
+    CsrGraph graph(vertexCount, edges);
+    CsrGraph transposed = graph.transpose(4);
+
+    EXPECT_FALSE(transposed.isUndirected());
+    expectAdjacency(transposed, makeAdjacency(vertexCount, reversed, false));
+    expectAdjacency(transposed.transpose(), makeAdjacency(vertexCount, edges, false));
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/graphs/csr_graph.h>
+
+/**
+ * @brief Generates edges between uniformly random vertices, shared by graph structure and algorithm tests.
+ * @param vertexCount Number of vertices.
+ * @param edgeCount Number of edges.
+ * @param seed Seed of random generator.
+ * @return Array of edges.
+ */
+inline dsa::structures::arrays::DynamicArray<dsa::structures::graphs::CsrGraph::EdgeType> makeEdges(size_t vertexCount, size_t edgeCount, unsigned seed)
+{
+    std::mt19937 random(seed);
+    dsa::structures::arrays::DynamicArray<dsa::structures::graphs::CsrGraph::EdgeType> edges(edgeCount);
+
+    for (size_t i = 0; i < edgeCount; i++)
+    {
+        edges[i] = dsa::structures::graphs::CsrGraph::EdgeType(random() % vertexCount, random() % vertexCount);
+    }
+
+    return edges;
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <sstream>
+#include <dsa/structures/matrices/matrix.h>
+#include <dsa/utility/allocation_policy.h>
+
+using dsa::structures::matrices::Matrix;
+
+class MatrixTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(MatrixTest, ConstructorsAndAccess)
+{
+    Matrix<int> empty;
+    Matrix<int> zeros(2, 3);
+    Matrix<int> values{{1, 2, 3}, {4, 5, 6}};
+
+    EXPECT_EQ(empty.getSize(), 0);
+    EXPECT_EQ(zeros.getRows(), 2);
+    EXPECT_EQ(zeros.getColumns(), 3);
+    EXPECT_EQ(zeros(1, 2), 0);
+    EXPECT_EQ(values(1, 0), 4);
+    EXPECT_EQ(values.getRow(1)[2], 6);
+    EXPECT_EQ(values.getData()[4], 5);
+
+    values.set(0, 1, 9);
+    EXPECT_EQ(values.get(0, 1), 9);
+
+    EXPECT_THROW(values.get(2, 0), std::out_of_range);
+    EXPECT_THROW(values.get(0, 3), std::out_of_range);
+    EXPECT_THROW((Matrix<int>{{1, 2}, {3}}), std::runtime_error);
+}
+
+TEST_F(MatrixTest, StorageIsContiguousAndAligned)
+{
+    Matrix<float> matrix(5, 7);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(matrix.getData()) % dsa::utility::CacheLineSize, 0);
+    EXPECT_EQ(matrix.getRow(3), matrix.getData() + 21);
+}
+
+TEST_F(MatrixTest, Multiply)
+{
+    Matrix<int> a{{1, 2, 3}, {4, 5, 6}};
+    Matrix<int> b{{7, 8}, {9, 10}, {11, 12}};
+
+    Matrix<int> product = a * b;
+
+    EXPECT_EQ(product, (Matrix<int>{{58, 64}, {139, 154}}));
+    EXPECT_EQ(a * Matrix<int>::identity(3), a);
+    EXPECT_THROW(a * a, std::runtime_error);
+}
+
+TEST_F(MatrixTest, ThreadedMultiplyMatchesSequential)
+{
+    Matrix<float> a(220, 200);
+    Matrix<float> b(200, 190);
+
+    for (size_t i = 0; i < a.getSize(); i++) {
+        a.getData()[i] = static_cast<float>(i % 11);
+    }
+
+    for (size_t i = 0; i < b.getSize(); i++) {
+        b.getData()[i] = static_cast<float>(i % 13);
+    }
+
+    EXPECT_EQ(a.multiply(b, 4), a.multiply(b, 1));
+}
+
+TEST_F(MatrixTest, Transpose)
+{
+    Matrix<int> matrix{{1, 2, 3}, {4, 5, 6}};
+
+    Matrix<int> transposed = matrix.transpose();
+
+    EXPECT_EQ(transposed, (Matrix<int>{{1, 4}, {2, 5}, {3, 6}}));
+    EXPECT_EQ(transposed.transpose(), matrix);
+}
+
+TEST_F(MatrixTest, FillAndOutput)
+{
+    Matrix<int> matrix(2, 2);
+    std::ostringstream os;
+
+    matrix.fill(3);
+    os << matrix;
+
+    EXPECT_EQ(os.str(), "3 3\n3 3\n");
+}
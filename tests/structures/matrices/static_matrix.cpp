@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <dsa/structures/matrices/static_matrix.h>
+
+using dsa::structures::matrices::StaticMatrix;
+
+class StaticMatrixTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(StaticMatrixTest, ConstructorsAndAccess)
+{
+    StaticMatrix<int, 2, 3> zeros;
+    StaticMatrix<int, 2, 3> values{{1, 2, 3}, {4, 5, 6}};
+
+    EXPECT_EQ(zeros(1, 2), 0);
+    EXPECT_EQ(values(1, 0), 4);
+    EXPECT_EQ(values.getData()[5], 6);
+    EXPECT_EQ((StaticMatrix<int, 2, 3>::getSize()), 6);
+    EXPECT_EQ(sizeof(values), 6 * sizeof(int));
+
+    EXPECT_THROW(values.get(2, 0), std::out_of_range);
+    EXPECT_THROW((StaticMatrix<int, 2, 2>{{1, 2}}), std::runtime_error);
+    EXPECT_THROW((StaticMatrix<int, 2, 2>{{1, 2}, {3}}), std::runtime_error);
+}
+
+TEST_F(StaticMatrixTest, MultiplyAndTranspose)
+{
+    StaticMatrix<float, 5, 9> a;
+    StaticMatrix<float, 9, 6> b;
+
+    for (size_t i = 0; i < a.getSize(); i++) {
+        a.getData()[i] = static_cast<float>(i % 5);
+    }
+
+    for (size_t i = 0; i < b.getSize(); i++) {
+        b.getData()[i] = static_cast<float>(i % 3);
+    }
+
+    StaticMatrix<float, 5, 6> product = a * b;
+
+    for (size_t i = 0; i < 5; i++) {
+        for (size_t j = 0; j < 6; j++) {
+            float expected = 0;
+
+            for (size_t p = 0; p < 9; p++) {
+                expected += a(i, p) * b(p, j);
+            }
+
+            EXPECT_EQ(product(i, j), expected);
+        }
+    }
+
+    EXPECT_EQ(a.transpose().transpose(), a);
+    EXPECT_EQ(a.transpose()(3, 2), a(2, 3));
+}
+
+TEST_F(StaticMatrixTest, ConstexprMatrix)
+{
+    constexpr StaticMatrix<int, 2, 2> rotation{{0, -1}, {1, 0}};
+    constexpr StaticMatrix<int, 2, 2> halfTurn = rotation * rotation;
+    constexpr StaticMatrix<int, 2, 2> identity = StaticMatrix<int, 2, 2>::identity();
+
+    static_assert(halfTurn(0, 0) == -1 && halfTurn(1, 1) == -1 && halfTurn(0, 1) == 0);
+    static_assert(halfTurn * halfTurn == identity);
+    static_assert(rotation.transpose() * rotation == identity);
+}
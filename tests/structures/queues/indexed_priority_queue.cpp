@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include <dsa/structures/queues/indexed_priority_queue.h>
+
+using dsa::structures::queues::IndexedPriorityQueue;
+
+class IndexedPriorityQueueTest : public ::testing::Test
+{
+    protected:
+        IndexedPriorityQueue<int, std::less<int>, 4> queue{10};
+
+        void SetUp() override {
+            queue.push(0, 50);
+            queue.push(3, 20);
+            queue.push(5, 40);
+            queue.push(7, 10);
+        }
+};
+
+TEST_F(IndexedPriorityQueueTest, PushAndTop)
+{
+    EXPECT_EQ(queue.getSize(), 4);
+    EXPECT_EQ(queue.getMaxIndex(), 10);
+    EXPECT_EQ(queue.topIndex(), 7);
+    EXPECT_EQ(queue.top(), 10);
+
+    EXPECT_TRUE(queue.contains(3));
+    EXPECT_FALSE(queue.contains(4));
+    EXPECT_THROW(queue.push(3, 1), std::runtime_error);
+    EXPECT_THROW(queue.push(10, 1), std::out_of_range);
+}
+
+TEST_F(IndexedPriorityQueueTest, PopOrder)
+{
+    std::vector<size_t> order;
+
+    while (!queue.isEmpty()) {
+        order.push_back(queue.topIndex());
+        queue.pop();
+    }
+
+    EXPECT_EQ(order, (std::vector<size_t>{7, 3, 5, 0}));
+    EXPECT_THROW(queue.pop(), std::runtime_error);
+}
+
+TEST_F(IndexedPriorityQueueTest, DecreaseKey)
+{
+    queue.decreaseKey(0, 5);
+
+    EXPECT_EQ(queue.topIndex(), 0);
+    EXPECT_EQ(queue.getPriority(0), 5);
+
+    EXPECT_THROW(queue.decreaseKey(3, 30), std::invalid_argument);
+    EXPECT_THROW(queue.decreaseKey(4, 1), std::runtime_error);
+}
+
+TEST_F(IndexedPriorityQueueTest, UpdateBothDirections)
+{
+    queue.update(7, 100);
+    EXPECT_EQ(queue.topIndex(), 3);
+
+    queue.update(5, 1);
+    EXPECT_EQ(queue.topIndex(), 5);
+    EXPECT_EQ(queue.getPriority(7), 100);
+}
+
+TEST_F(IndexedPriorityQueueTest, RemoveAndReinsert)
+{
+    queue.remove(3);
+
+    EXPECT_FALSE(queue.contains(3));
+    EXPECT_EQ(queue.getSize(), 3);
+    EXPECT_THROW(queue.getPriority(3), std::runtime_error);
+
+    queue.pop();
+    EXPECT_EQ(queue.topIndex(), 5);
+
+    queue.push(3, 1);
+    EXPECT_EQ(queue.topIndex(), 3);
+}
+
+TEST_F(IndexedPriorityQueueTest, RemoveReleasesPriority)
+{
+    std::shared_ptr<int> owner = std::make_shared<int>(7);
+    auto lessByValue = [](const std::shared_ptr<int>& first, const std::shared_ptr<int>& second) { return *first < *second; };
+    IndexedPriorityQueue<std::shared_ptr<int>, decltype(lessByValue)> pointers(4, lessByValue);
+
+    pointers.push(2, owner);
+    pointers.push(1, std::make_shared<int>(9));
+    EXPECT_EQ(owner.use_count(), 2);
+
+    pointers.pop();
+    EXPECT_EQ(owner.use_count(), 1);
+}
+
+TEST_F(IndexedPriorityQueueTest, DijkstraStyleRelaxation)
+{
+    IndexedPriorityQueue<int> distances(100);
+
+    for (size_t i = 0; i < 100; ++i) {
+        distances.push(i, 1000 + static_cast<int>(i));
+    }
+
+    for (size_t i = 0; i < 100; i += 3) {
+        distances.decreaseKey(i, static_cast<int>(100 - i));
+    }
+
+    int previous = -1;
+
+    while (!distances.isEmpty()) {
+        EXPECT_LE(previous, distances.top());
+        previous = distances.top();
+        distances.pop();
+    }
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include <dsa/structures/queues/priority_queue.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::queues::PriorityQueue;
+
+class PriorityQueueTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+template<typename Queue>
+static std::vector<int> drain(Queue& queue)
+{
+    std::vector<int> values;
+
+    while (!queue.isEmpty()) {
+        values.push_back(queue.top());
+        queue.pop();
+    }
+
+    return values;
+}
+
+TEST_F(PriorityQueueTest, DefaultConstructor)
+{
+    PriorityQueue<int> queue;
+
+    EXPECT_EQ(queue.getSize(), 0);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_THROW(queue.top(), std::runtime_error);
+    EXPECT_THROW(queue.pop(), std::runtime_error);
+}
+
+TEST_F(PriorityQueueTest, PushAndPopMinHeap)
+{
+    PriorityQueue<int> queue;
+
+    for (int value : {5, 3, 8, 1, 9, 2}) {
+        queue.push(value);
+    }
+
+    EXPECT_EQ(queue.getSize(), 6);
+    EXPECT_EQ(queue.top(), 1);
+    EXPECT_EQ(drain(queue), (std::vector<int>{1, 2, 3, 5, 8, 9}));
+}
+
+TEST_F(PriorityQueueTest, CustomComparatorMaxHeap)
+{
+    PriorityQueue<int, std::greater<int>> queue{4, 7, 1, 7, 3};
+
+    EXPECT_EQ(queue.top(), 7);
+    EXPECT_EQ(drain(queue), (std::vector<int>{7, 7, 4, 3, 1}));
+}
+
+TEST_F(PriorityQueueTest, FourAryHeap)
+{
+    PriorityQueue<int, std::less<int>, 4> queue;
+    std::mt19937 random(42);
+    std::vector<int> expected;
+
+    for (int i = 0; i < 1000; ++i) {
+        int value = static_cast<int>(random() % 500);
+        queue.push(value);
+        expected.push_back(value);
+    }
+
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(drain(queue), expected);
+}
+
+TEST_F(PriorityQueueTest, DynamicArrayConstructorHeapify)
+{
+    DynamicArray<int> array{9, 4, 6, 1, 8, 2, 7};
+    PriorityQueue<int, std::less<int>, 3> queue(array);
+
+    EXPECT_EQ(queue.getSize(), 7);
+    EXPECT_EQ(drain(queue), (std::vector<int>{1, 2, 4, 6, 7, 8, 9}));
+    EXPECT_EQ(array.getSize(), 7);
+}
+
+TEST_F(PriorityQueueTest, PushBatch)
+{
+    PriorityQueue<int, std::less<int>, 4> queue;
+    DynamicArray<int> large{10, 30, 20, 50, 40};
+
+    queue.pushBatch(large);
+    EXPECT_EQ(queue.top(), 10);
+
+    std::vector<int> small{5, 35};
+    queue.pushBatch(small.begin(), small.end());
+
+    EXPECT_EQ(queue.getSize(), 7);
+    EXPECT_EQ(drain(queue), (std::vector<int>{5, 10, 20, 30, 35, 40, 50}));
+}
+
+TEST_F(PriorityQueueTest, ReserveAndClear)
+{
+    PriorityQueue<int> queue;
+
+    queue.reserve(64);
+    EXPECT_EQ(queue.getCapacity(), 64);
+
+    queue.push(3);
+    queue.push(1);
+    queue.clear();
+
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.getCapacity(), 64);
+}
+
+TEST_F(PriorityQueueTest, MoveOnlyFriendlyStrings)
+{
+    PriorityQueue<std::string> queue;
+
+    queue.push("pear");
+    queue.push("apple");
+    queue.push("orange");
+
+    EXPECT_EQ(queue.top(), "apple");
+    queue.pop();
+    EXPECT_EQ(queue.top(), "orange");
+}
+
+TEST_F(PriorityQueueTest, PopAndClearReleaseElements)
+{
+    auto lessByValue = [](const std::shared_ptr<int>& first, const std::shared_ptr<int>& second) { return *first < *second; };
+    PriorityQueue<std::shared_ptr<int>, decltype(lessByValue)> queue(lessByValue);
+    std::shared_ptr<int> first = std::make_shared<int>(1);
+    std::shared_ptr<int> second = std::make_shared<int>(2);
+    std::shared_ptr<int> third = std::make_shared<int>(3);
+
+    queue.push(first);
+    queue.push(second);
+    queue.push(third);
+
+    queue.pop();
+    EXPECT_EQ(first.use_count(), 1);
+
+    queue.pop();
+    queue.pop();
+    EXPECT_EQ(second.use_count(), 1);
+    EXPECT_EQ(third.use_count(), 1);
+
+    queue.push(first);
+    queue.push(second);
+    queue.clear();
+
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 1);
+}
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <dsa/structures/trees/radix_tree.h>
+
+using dsa::structures::trees::RadixTree;
+
+class RadixTreeTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+
+        static std::vector<std::pair<std::string, int>> collect(RadixTree<int>& tree)
+        {
+            std::vector<std::pair<std::string, int>> entries;
+
+            tree.forEach([&entries](std::string_view key, int& value) { entries.emplace_back(std::string(key), value); });
+
+            return entries;
+        }
+
+        static void expectSameAs(RadixTree<int>& tree, const std::map<std::string, int>& expected)
+        {
+            std::vector<std::pair<std::string, int>> entries(expected.begin(), expected.end());
+
+            ASSERT_EQ(tree.getSize(), expected.size());
+            EXPECT_EQ(collect(tree), entries);
+
+            for (const auto& [key, value] : expected) {
+                const int* found = tree.find(key);
+
+                ASSERT_NE(found, nullptr) << key;
+                EXPECT_EQ(*found, value);
+            }
+        }
+};
+
+TEST_F(RadixTreeTest, InsertAndFind)
+{
+    RadixTree<int> tree;
+
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_TRUE(tree.insert("romane", 1));
+    EXPECT_TRUE(tree.insert("romanus", 2));
+    EXPECT_TRUE(tree.insert("romulus", 3));
+    EXPECT_TRUE(tree.insert("rubens", 4));
+    EXPECT_FALSE(tree.insert("romane", 5));
+
+    EXPECT_EQ(tree.getSize(), 4);
+    EXPECT_EQ(tree.get("romane"), 5);
+    EXPECT_EQ(tree.get("rubens"), 4);
+    EXPECT_TRUE(tree.contains("romulus"));
+    EXPECT_FALSE(tree.contains("roman"));
+    EXPECT_FALSE(tree.contains("romanes"));
+    EXPECT_EQ(tree.find("ruber"), nullptr);
+    EXPECT_THROW(tree.get("r"), std::out_of_range);
+}
+
+TEST_F(RadixTreeTest, KeysThatArePrefixesOfOtherKeys)
+{
+    RadixTree<int> tree;
+
+    tree.insert("abc", 3);
+    tree.insert("a", 1);
+    tree.insert("", 0);
+    tree.insert("ab", 2);
+    tree.insert("abcd", 4);
+
+    std::vector<std::pair<std::string, int>> expected = {{"", 0}, {"a", 1}, {"ab", 2}, {"abc", 3}, {"abcd", 4}};
+
+    EXPECT_EQ(collect(tree), expected);
+
+    EXPECT_TRUE(tree.erase("ab"));
+    EXPECT_TRUE(tree.erase(""));
+    EXPECT_FALSE(tree.erase("ab"));
+    EXPECT_EQ(tree.get("abc"), 3);
+    EXPECT_EQ(tree.get("a"), 1);
+    EXPECT_EQ(tree.getSize(), 3);
+}
+
+TEST_F(RadixTreeTest, LongCompressedPaths)
+{
+    RadixTree<int> tree;
+    std::string base(40, 'x');
+
+    tree.insert(base + "1", 1);
+    tree.insert(base + "2", 2);
+    tree.insert(base.substr(0, 25) + "y", 3);
+    tree.insert(base.substr(0, 12), 4);
+
+    EXPECT_EQ(tree.get(base + "1"), 1);
+    EXPECT_EQ(tree.get(base + "2"), 2);
+    EXPECT_EQ(tree.get(base.substr(0, 25) + "y"), 3);
+    EXPECT_EQ(tree.get(base.substr(0, 12)), 4);
+    EXPECT_FALSE(tree.contains(base));
+    EXPECT_FALSE(tree.contains(base.substr(0, 30) + "z1"));
+
+    EXPECT_TRUE(tree.erase(base.substr(0, 25) + "y"));
+    EXPECT_TRUE(tree.erase(base.substr(0, 12)));
+    EXPECT_EQ(tree.get(base + "1"), 1);
+    EXPECT_FALSE(tree.contains(base.substr(0, 30) + "z1"));
+}
+
+TEST_F(RadixTreeTest, GrowsAndShrinksThroughAllNodeSizes)
+{
+    RadixTree<int> tree;
+    std::map<std::string, int> expected;
+
+    for (int c = 255; c >= 0; c--)
+    {
+        std::string key = "k" + std::string(1, static_cast<char>(c));
+
+        tree.insert(key, c);
+        expected[key] = c;
+    }
+
+    expectSameAs(tree, expected);
+
+    for (int c = 0; c < 256; c += 2)
+    {
+        std::string key = "k" + std::string(1, static_cast<char>(c));
+
+        EXPECT_TRUE(tree.erase(key));
+        expected.erase(key);
+
+        if (c % 32 == 0)
+            expectSameAs(tree, expected);
+    }
+
+    for (int c = 1; c < 256; c += 2)
+    {
+        tree.erase("k" + std::string(1, static_cast<char>(c)));
+    }
+
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.getMemoryUsage(), 0);
+}
+
+TEST_F(RadixTreeTest, MatchesOrderedMapOnRandomOperations)
+{
+    std::mt19937 random(42);
+    RadixTree<int> tree;
+    std::map<std::string, int> expected;
+    const char alphabet[] = "abc\xff";
+
+    for (int i = 0; i < 5000; i++)
+    {
+        std::string key;
+        size_t length = random() % 8;
+
+        for (size_t j = 0; j < length; j++) {
+            key += alphabet[random() % 4];
+        }
+
+        if (random() % 3 == 0) {
+            EXPECT_EQ(tree.erase(key), expected.erase(key) == 1) << key;
+        } else {
+            EXPECT_EQ(tree.insert(key, i), expected.find(key) == expected.end()) << key;
+            expected[key] = i;
+        }
+    }
+
+    expectSameAs(tree, expected);
+}
+
+TEST_F(RadixTreeTest, PrefixScan)
+{
+    RadixTree<int> tree;
+    std::vector<std::string> keys = {"apple", "application", "apply", "apt", "banana", "app", "applesauce"};
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        tree.insert(keys[i], static_cast<int>(i));
+    }
+
+    auto scan = [&tree](std::string_view prefix)
+    {
+        std::vector<std::string> found;
+
+        tree.forEachWithPrefix(prefix, [&found](std::string_view key, int&) { found.emplace_back(key); });
+
+        return found;
+    };
+
+    EXPECT_EQ(scan("appl"), (std::vector<std::string>{"apple", "applesauce", "application", "apply"}));
+    EXPECT_EQ(scan("app"), (std::vector<std::string>{"app", "apple", "applesauce", "application", "apply"}));
+    EXPECT_EQ(scan("applesauce"), (std::vector<std::string>{"applesauce"}));
+    EXPECT_EQ(scan("b"), (std::vector<std::string>{"banana"}));
+    EXPECT_EQ(scan("").size(), keys.size());
+    EXPECT_TRUE(scan("apq").empty());
+    EXPECT_TRUE(scan("bananas").empty());
+}
+
+TEST_F(RadixTreeTest, MoveAndClear)
+{
+    RadixTree<int> tree;
+
+    tree.insert("one", 1);
+    tree.insert("two", 2);
+
+    RadixTree<int> moved(std::move(tree));
+
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(moved.get("two"), 2);
+    EXPECT_GT(moved.getMemoryUsage(), 0);
+
+    moved.clear();
+
+    EXPECT_TRUE(moved.isEmpty());
+    EXPECT_EQ(moved.getMemoryUsage(), 0);
+    EXPECT_FALSE(moved.contains("one"));
+}
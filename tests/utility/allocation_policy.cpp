@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/allocation_policy.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::AlignedAllocationPolicy;
+using dsa::utility::DefaultAllocationPolicy;
+using dsa::utility::HugePageAllocationPolicy;
+
+namespace
+{
+    constexpr size_t HugePageSize = HugePageAllocationPolicy<int>::HugePageSize;
+}
+
+TEST(AllocationPolicyTest, DefaultPolicyRoundTrip)
+{
+    int* elements = DefaultAllocationPolicy<int>::allocate(4);
+
+    elements[3] = 7;
+    EXPECT_EQ(elements[3], 7);
+
+    DefaultAllocationPolicy<int>::deallocate(elements, 4);
+}
+
+TEST(AllocationPolicyTest, AlignedPolicyAlignsBuffer)
+{
+    float* floats = AlignedAllocationPolicy<float, 64>::allocate(7);
+    std::string* strings = AlignedAllocationPolicy<std::string, 32>::allocate(3);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(floats) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(strings) % 32, 0);
+    EXPECT_TRUE(strings[2].empty());
+
+    strings[1] = std::string(50, 'y');
+
+    AlignedAllocationPolicy<float, 64>::deallocate(floats, 7);
+    AlignedAllocationPolicy<std::string, 32>::deallocate(strings, 3);
+}
+
+TEST(AllocationPolicyTest, HugePageSmallBufferIsValueInitialized)
+{
+    using Policy = HugePageAllocationPolicy<int>;
+
+    EXPECT_FALSE(Policy::isMapped(16 * sizeof(int)));
+
+    int* elements = Policy::allocate(16);
+
+    for (size_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(elements[i], 0);
+    }
+
+    Policy::deallocate(elements, 16);
+}
+
+TEST(AllocationPolicyTest, HugePageLargeBufferIsAlignedAndZeroed)
+{
+    using Policy = HugePageAllocationPolicy<uint64_t>;
+
+    size_t count = 3 * HugePageSize / sizeof(uint64_t) + 5;
+    uint64_t* elements = Policy::allocate(count);
+
+    if (Policy::isMapped(count * sizeof(uint64_t))) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(elements) % HugePageSize, 0);
+    }
+
+    EXPECT_EQ(elements[0], 0);
+    EXPECT_EQ(elements[count - 1], 0);
+
+    elements[count - 1] = 42;
+    EXPECT_EQ(elements[count - 1], 42);
+
+    Policy::deallocate(elements, count);
+}
+
+TEST(AllocationPolicyTest, HugePageConstructsAndDestroysNonTrivialElements)
+{
+    using Policy = HugePageAllocationPolicy<std::string>;
+
+    size_t count = HugePageSize / sizeof(std::string) + 1;
+    std::string* elements = Policy::allocate(count);
+
+    EXPECT_TRUE(elements[count - 1].empty());
+
+    elements[0] = std::string(100, 'x');
+    elements[count - 1] = "last";
+
+    Policy::deallocate(elements, count);
+}
+
+TEST(AllocationPolicyTest, ParallelFirstTouchInitializesEveryElement)
+{
+    using Policy = HugePageAllocationPolicy<std::string, true>;
+
+    size_t count = 5 * HugePageSize / sizeof(std::string) + 3;
+    std::string* elements = Policy::allocate(count);
+
+    for (size_t i = 0; i < count; i += 997) {
+        EXPECT_TRUE(elements[i].empty());
+    }
+
+    EXPECT_TRUE(elements[count - 1].empty());
+
+    Policy::deallocate(elements, count);
+}
+
+TEST(AllocationPolicyTest, DynamicArrayWithHugePages)
+{
+    size_t count = HugePageSize / sizeof(int) * 2;
+    DynamicArray<int, HugePageAllocationPolicy<int>> arr(count);
+
+    EXPECT_EQ(arr.getSize(), count);
+    EXPECT_EQ(arr[count - 1], 0);
+
+    arr[count - 1] = 5;
+    arr.addLast(6);
+
+    DynamicArray<int, HugePageAllocationPolicy<int>> copy(arr);
+
+    EXPECT_EQ(copy.getSize(), count + 1);
+    EXPECT_EQ(copy[count - 1], 5);
+    EXPECT_EQ(copy.last(), 6);
+
+    int sum = 0;
+
+    for (int value : copy) {
+        sum += value;
+    }
+
+    EXPECT_EQ(sum, 11);
+}
+
+TEST(AllocationPolicyTest, HugePageArrayGrowsGeometrically)
+{
+    size_t count = HugePageSize / sizeof(uint64_t) * 4;
+    DynamicArray<uint64_t, HugePageAllocationPolicy<uint64_t>> arr;
+    size_t reallocations = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        size_t capacity = arr.getCapacity();
+
+        arr.addLast(i);
+
+        if (arr.getCapacity() != capacity) {
+            EXPECT_GE(arr.getCapacity(), capacity * 2);
+            reallocations++;
+        }
+    }
+
+    EXPECT_LE(reallocations, 64);
+
+    arr.addFirst(count);
+
+    EXPECT_EQ(arr.getSize(), count + 1);
+    EXPECT_EQ(arr.first(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(arr[i + 1], i);
+    }
+
+    DynamicArray<int> exact;
+
+    exact.addLast(1);
+    exact.addLast(2);
+
+    EXPECT_EQ(exact.getCapacity(), 2);
+}
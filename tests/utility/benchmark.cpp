@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <dsa/utility/benchmark.h>
+
+using namespace dsa::utility::benchmark;
+
+namespace
+{
+    void benchmarkLoop(State& state)
+    {
+        while (state.keepRunning())
+        {
+            uint64_t sum = 0;
+
+            for (uint64_t i = 0; i < 1000; i++)
+            {
+                doNotOptimize(sum += i);
+            }
+        }
+    }
+}
+
+class BenchmarkTest : public ::testing::Test
+{
+    protected:
+        std::filesystem::path mDirectory;
+
+        void SetUp() override {
+            this->mDirectory = std::filesystem::temp_directory_path() / ("dsa-benchmark-test-" + std::to_string(std::random_device()()));
+            std::filesystem::create_directories(this->mDirectory);
+            registerBenchmark("BenchmarkTest/Loop", &benchmarkLoop);
+        }
+
+        void TearDown() override {
+            getRegistry().removeLast();
+            std::filesystem::remove_all(this->mDirectory);
+        }
+
+        static Result makeResult(const std::string& name, double nsPerOp, double allocationsPerOp)
+        {
+            Result result;
+
+            result.name = name;
+            result.iterations = 10;
+            result.nsPerOp = nsPerOp;
+            result.allocationsPerOp = allocationsPerOp;
+            result.bytesPerOp = allocationsPerOp * 16;
+
+            return result;
+        }
+
+        static Report makeReport(const std::string& build, bool instrumented, Result result)
+        {
+            Report report;
+
+            report.build = build;
+            report.instrumented = instrumented;
+            report.results.addLast(result);
+
+            return report;
+        }
+
+        static bool compareReports(const Report& current, const Report& baseline, const Options& options = Options())
+        {
+            std::ostringstream os;
+            return compare(current, baseline, options, os);
+        }
+
+        std::string writeBaseline(const Report& report)
+        {
+            std::string path = (this->mDirectory / "baseline.json").string();
+            std::ofstream file(path);
+
+            writeJson(file, report);
+
+            return path;
+        }
+
+        int runWithBaseline(const std::string& baselinePath)
+        {
+            std::string output = (this->mDirectory / "output.json").string();
+            const char* arguments[] = {"--filter", "BenchmarkTest/", "--min-time", "0", "--repetitions", "1", "--output", output.c_str(), "--baseline", baselinePath.c_str()};
+            std::ostringstream report;
+            std::streambuf* previous = std::cout.rdbuf(report.rdbuf());
+            int code = runFromCommandLine(10, const_cast<char**>(arguments));
+
+            std::cout.rdbuf(previous);
+
+            return code;
+        }
+};
+
+TEST_F(BenchmarkTest, JsonRoundTrip)
+{
+    Result result = makeResult("Group/Name", 12.5, 3);
+
+    result.gflops = 1.5;
+    result.deterministicAllocations = false;
+    result.counters.addLast(Counter{"ratio", 0.25});
+
+    Report report = makeReport("optimized", true, result);
+    report.results.addLast(makeResult("Group/Other", 7, 0));
+
+    std::stringstream stream;
+    writeJson(stream, report);
+
+    Report read = readJson(stream);
+
+    EXPECT_EQ(read.build, "optimized");
+    EXPECT_TRUE(read.instrumented);
+    ASSERT_EQ(read.results.getSize(), 2);
+    EXPECT_EQ(read.results[0].name, "Group/Name");
+    EXPECT_EQ(read.results[0].iterations, 10);
+    EXPECT_DOUBLE_EQ(read.results[0].nsPerOp, 12.5);
+    EXPECT_DOUBLE_EQ(read.results[0].allocationsPerOp, 3);
+    EXPECT_DOUBLE_EQ(read.results[0].bytesPerOp, 48);
+    EXPECT_DOUBLE_EQ(read.results[0].gflops, 1.5);
+    EXPECT_FALSE(read.results[0].deterministicAllocations);
+    EXPECT_EQ(read.results[1].name, "Group/Other");
+    EXPECT_TRUE(read.results[1].deterministicAllocations);
+}
+
+TEST_F(BenchmarkTest, JsonReaderSkipsUnknownValues)
+{
+    std::string text = "{\"machine\": {\"cores\": [1, 2], \"name\": \"x\\\"y\"}, \"benchmarks\": [{\"name\": \"A/B\", \"extra\": null, \"nsPerOp\": -1e3}]}";
+    Report report = JsonReader(text).readReport();
+
+    EXPECT_EQ(report.build, "");
+    EXPECT_FALSE(report.instrumented);
+    ASSERT_EQ(report.results.getSize(), 1);
+    EXPECT_EQ(report.results[0].name, "A/B");
+    EXPECT_DOUBLE_EQ(report.results[0].nsPerOp, -1000);
+}
+
+TEST_F(BenchmarkTest, JsonReaderRejectsMalformedDocuments)
+{
+    for (std::string text : {"", "[]", "{\"benchmarks\": [{\"name\": \"A\"}", "{\"benchmarks\": [{\"nsPerOp\": x}]}", "{\"instrumented\": yes}"})
+    {
+        EXPECT_THROW(JsonReader(text).readReport(), std::runtime_error) << text;
+    }
+}
+
+TEST_F(BenchmarkTest, CompareDetectsSlowdownBeyondTolerance)
+{
+    Report baseline = makeReport("optimized", false, makeResult("A/B", 100, 0));
+    Options options;
+
+    options.tolerance = 0.5;
+
+    EXPECT_TRUE(compareReports(makeReport("optimized", false, makeResult("A/B", 149, 0)), baseline, options));
+    EXPECT_FALSE(compareReports(makeReport("optimized", false, makeResult("A/B", 151, 0)), baseline, options));
+    EXPECT_TRUE(compareReports(makeReport("optimized", false, makeResult("A/C", 1000, 0)), baseline, options));
+}
+
+TEST_F(BenchmarkTest, CompareSkipsTimeOfDifferentBuild)
+{
+    Report baseline = makeReport("optimized", false, makeResult("A/B", 100, 0));
+    std::ostringstream os;
+
+    EXPECT_TRUE(compare(makeReport("unoptimized", false, makeResult("A/B", 1000, 0)), baseline, Options(), os));
+    EXPECT_NE(os.str().find("times are not compared"), std::string::npos);
+
+    baseline.build.clear();
+
+    EXPECT_TRUE(compareReports(makeReport("optimized", false, makeResult("A/B", 1000, 0)), baseline));
+}
+
+TEST_F(BenchmarkTest, CompareChecksAllocationsOfInstrumentedReports)
+{
+    Report baseline = makeReport("optimized", true, makeResult("A/B", 100, 10));
+    Options options;
+
+    EXPECT_TRUE(compareReports(makeReport("optimized", true, makeResult("A/B", 100, 10)), baseline));
+    EXPECT_FALSE(compareReports(makeReport("optimized", true, makeResult("A/B", 100, 11)), baseline));
+    EXPECT_TRUE(compareReports(makeReport("optimized", false, makeResult("A/B", 100, 11)), baseline));
+
+    options.allocationTolerance = 0.2;
+
+    EXPECT_TRUE(compareReports(makeReport("optimized", true, makeResult("A/B", 100, 11)), baseline, options));
+    EXPECT_FALSE(compareReports(makeReport("optimized", true, makeResult("A/B", 100, 13)), baseline, options));
+}
+
+TEST_F(BenchmarkTest, CompareSkipsNonDeterministicAllocations)
+{
+    Report baseline = makeReport("optimized", true, makeResult("A/B", 100, 10));
+    Result result = makeResult("A/B", 100, 20);
+
+    result.deterministicAllocations = false;
+
+    EXPECT_TRUE(compareReports(makeReport("optimized", true, result), baseline));
+
+    baseline.results[0].deterministicAllocations = false;
+
+    EXPECT_TRUE(compareReports(makeReport("optimized", true, makeResult("A/B", 100, 20)), baseline));
+}
+
+TEST_F(BenchmarkTest, CommandLineReturnsRegressionExitCode)
+{
+    Report baseline = makeReport(getBuildType(), false, makeResult("BenchmarkTest/Loop", 1e12, 0));
+
+    EXPECT_EQ(runWithBaseline(this->writeBaseline(baseline)), 0);
+
+    baseline.results[0].nsPerOp = 0.001;
+
+    EXPECT_EQ(runWithBaseline(this->writeBaseline(baseline)), 1);
+
+    baseline.build = getBuildType() == "optimized" ? "unoptimized" : "optimized";
+
+    EXPECT_EQ(runWithBaseline(this->writeBaseline(baseline)), 0);
+}
+
+TEST_F(BenchmarkTest, CommandLineRejectsInvalidBaseline)
+{
+    std::string path = (this->mDirectory / "broken.json").string();
+    std::ofstream file(path);
+
+    EXPECT_EQ(runWithBaseline((this->mDirectory / "missing.json").string()), 2);
+
+    file << "{\"benchmarks\": [";
+    file.close();
+
+    EXPECT_EQ(runWithBaseline(path), 2);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <dsa/utility/epoch.h>
+
+using dsa::utility::EpochManager;
+
+namespace
+{
+    std::atomic<int> released{0};
+
+    void releaseInt(void* pointer)
+    {
+        delete static_cast<int*>(pointer);
+        released++;
+    }
+}
+
+TEST(EpochTest, RetiredObjectsWaitForActiveGuards)
+{
+    released = 0;
+
+    {
+        EpochManager manager(4);
+        EpochManager::Guard reader = manager.enter();
+
+        for (size_t i = 0; i < 4 * EpochManager::CollectInterval; i++)
+        {
+            EpochManager::Guard writer = manager.enter();
+            writer.retire(new int(0), &releaseInt);
+        }
+
+        // Reader entered in the first epoch, so nothing retired since can be released.
+        EXPECT_EQ(released, 0);
+        EXPECT_LE(manager.getEpoch(), 2);
+    }
+
+    EXPECT_EQ(released, 4 * EpochManager::CollectInterval);
+}
+
+TEST(EpochTest, QuiescentRetirementsAreReleased)
+{
+    released = 0;
+
+    EpochManager manager(4);
+
+    for (size_t i = 0; i < 4 * EpochManager::CollectInterval; i++)
+    {
+        EpochManager::Guard guard = manager.enter();
+        guard.retire(new int(0), &releaseInt);
+    }
+
+    EXPECT_GT(manager.getEpoch(), 2);
+    EXPECT_GT(released, 0);
+    EXPECT_EQ(released + manager.getPendingCount(), 4 * EpochManager::CollectInterval);
+}
+
+TEST(EpochTest, GuardsFromManyThreads)
+{
+    released = 0;
+
+    {
+        EpochManager manager(2);
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&manager]()
+            {
+                for (int i = 0; i < 1000; i++)
+                {
+                    EpochManager::Guard guard = manager.enter();
+                    guard.retire(new int(i), &releaseInt);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    EXPECT_EQ(released, 4000);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+#include <dsa/utility/instrumentation.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::StaticArray;
+using namespace dsa::utility::instrumentation;
+
+class InstrumentationTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+            if (!isEnabled())
+                GTEST_SKIP() << "Built without DSA_INSTRUMENTATION";
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(InstrumentationTest, StatisticsDifference)
+{
+    Statistics before;
+    Statistics after;
+
+    after.allocations = 5;
+    after.bytesAllocated = 40;
+    before.allocations = 2;
+    before.bytesAllocated = 16;
+
+    Statistics delta = after - before;
+
+    EXPECT_EQ(delta.allocations, 3);
+    EXPECT_EQ(delta.bytesAllocated, 24);
+    EXPECT_EQ(delta.elementCopies, 0);
+}
+
+TEST_F(InstrumentationTest, CountersReset)
+{
+    Counters counters;
+
+    counters.addAllocation(64);
+    counters.addCopies(3);
+    counters.addReallocation();
+
+    EXPECT_EQ(counters.getStatistics().bytesAllocated, 64);
+
+    counters.reset();
+
+    Statistics statistics = counters.getStatistics();
+    EXPECT_EQ(statistics.allocations, 0);
+    EXPECT_EQ(statistics.elementCopies, 0);
+    EXPECT_EQ(statistics.reallocations, 0);
+}
+
+TEST_F(InstrumentationTest, DynamicArrayAddLast)
+{
+    Statistics before = getStatistics<DynamicArray<int>>();
+
+    {
+        DynamicArray<int> arr;
+
+        arr.addLast(1);
+        arr.addLast(2);
+        arr.addLast(3);
+    }
+
+    Statistics delta = getStatistics<DynamicArray<int>>() - before;
+
+    EXPECT_EQ(delta.allocations, 3);
+    EXPECT_EQ(delta.deallocations, 3);
+    EXPECT_EQ(delta.bytesAllocated, 6 * sizeof(int));
+    EXPECT_EQ(delta.bytesAllocated, delta.bytesDeallocated);
+    EXPECT_EQ(delta.reallocations, 2);
+    EXPECT_EQ(delta.elementCopies, 0);
+    EXPECT_EQ(delta.elementMoves, 3);
+}
+
+TEST_F(InstrumentationTest, DynamicArrayCopyAndMove)
+{
+    DynamicArray<int> original{1, 2, 3, 4};
+    Statistics before = getStatistics<DynamicArray<int>>();
+
+    DynamicArray<int> copy(original);
+    DynamicArray<int> moved(std::move(copy));
+
+    Statistics delta = getStatistics<DynamicArray<int>>() - before;
+
+    EXPECT_EQ(delta.allocations, 1);
+    EXPECT_EQ(delta.elementCopies, 4);
+    EXPECT_EQ(delta.reallocations, 0);
+}
+
+TEST_F(InstrumentationTest, CountersArePerContainerType)
+{
+    Statistics doubleBefore = getStatistics<DynamicArray<double>>();
+    Statistics staticBefore = getStatistics<StaticArray<int, 8>>();
+    Statistics globalBefore = getGlobalStatistics();
+
+    DynamicArray<double> arr{1.0, 2.0};
+    StaticArray<int, 8> fixed;
+
+    EXPECT_EQ((getStatistics<DynamicArray<double>>() - doubleBefore).bytesAllocated, 2 * sizeof(double));
+    EXPECT_EQ((getStatistics<StaticArray<int, 8>>() - staticBefore).bytesAllocated, 0);
+    EXPECT_EQ((getGlobalStatistics() - globalBefore).allocations, 1);
+    EXPECT_EQ(fixed.getSize(), 8);
+}
+
+TEST_F(InstrumentationTest, StaticArrayCopyAndMove)
+{
+    StaticArray<int, 4> original{1, 2, 3, 4};
+    Statistics before = getStatistics<StaticArray<int, 4>>();
+
+    StaticArray<int, 4> copy(original);
+    StaticArray<int, 4> moved(std::move(copy));
+
+    Statistics delta = getStatistics<StaticArray<int, 4>>() - before;
+
+    EXPECT_EQ(delta.allocations, 0);
+    EXPECT_EQ(delta.elementCopies, 4);
+    EXPECT_EQ(delta.elementMoves, 4);
+}
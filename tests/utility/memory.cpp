@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <dsa/utility/memory.h>
+
+using dsa::utility::copyElements;
+using dsa::utility::moveElements;
+using dsa::utility::shiftElements;
+
+namespace
+{
+    struct Record
+    {
+        int id;
+        double value;
+    };
+}
+
+TEST(MemoryTest, CopyElementsTrivial)
+{
+    Record source[3] = { {1, 1.5}, {2, 2.5}, {3, 3.5} };
+    Record destination[3] = {};
+
+    copyElements(source, 3, destination);
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(destination[i].id, source[i].id);
+        EXPECT_EQ(destination[i].value, source[i].value);
+    }
+}
+
+TEST(MemoryTest, CopyElementsNonTrivial)
+{
+    std::string source[3] = { "a", "bb", "ccc" };
+    std::string destination[3];
+
+    copyElements(source, 3, destination);
+
+    EXPECT_EQ(destination[0], "a");
+    EXPECT_EQ(destination[2], "ccc");
+    EXPECT_EQ(source[1], "bb");
+}
+
+TEST(MemoryTest, CopyElementsEmpty)
+{
+    int destination[1] = { 7 };
+
+    copyElements<int>(nullptr, 0, destination);
+
+    EXPECT_EQ(destination[0], 7);
+}
+
+TEST(MemoryTest, ShiftElementsLeftTrivial)
+{
+    int data[5] = { 1, 2, 3, 4, 5 };
+
+    shiftElements(data + 1, 4, data);
+
+    EXPECT_EQ(data[0], 2);
+    EXPECT_EQ(data[3], 5);
+}
+
+TEST(MemoryTest, ShiftElementsRightTrivial)
+{
+    int data[5] = { 1, 2, 3, 4, 5 };
+
+    shiftElements(data, 4, data + 1);
+
+    EXPECT_EQ(data[1], 1);
+    EXPECT_EQ(data[4], 4);
+}
+
+TEST(MemoryTest, ShiftElementsNonTrivial)
+{
+    std::string left[4] = { "a", "b", "c", "d" };
+    std::string right[4] = { "a", "b", "c", "d" };
+
+    shiftElements(left + 1, 3, left);
+    shiftElements(right, 3, right + 1);
+
+    EXPECT_EQ(left[0], "b");
+    EXPECT_EQ(left[2], "d");
+    EXPECT_EQ(right[1], "a");
+    EXPECT_EQ(right[3], "c");
+}
+
+TEST(MemoryTest, MoveElementsNonTrivial)
+{
+    std::string source[2] = { "first", "second" };
+    std::string destination[2];
+
+    moveElements(source, 2, destination);
+
+    EXPECT_EQ(destination[0], "first");
+    EXPECT_EQ(destination[1], "second");
+}
+
+TEST(MemoryTest, ElementsCopiedAtCompileTime)
+{
+    constexpr int shifted = []()
+    {
+        int data[4] = { 1, 2, 3, 4 };
+        int copy[4] = {};
+
+        copyElements(data, 4, copy);
+        shiftElements(copy + 1, 3, copy);
+        moveElements(copy, 2, data);
+
+        return data[0] * 10 + data[1];
+    }();
+
+    static_assert(shifted == 23);
+    EXPECT_EQ(shifted, 23);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/utility/parallel.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::utility::getChunkCount;
+using dsa::utility::parallelFor;
+
+class ParallelTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(ParallelTest, ChunkCountIsBetweenOneAndThreadCount)
+{
+    EXPECT_EQ(getChunkCount(0, 4, 10), 1);
+    EXPECT_EQ(getChunkCount(25, 4, 10), 2);
+    EXPECT_EQ(getChunkCount(1000, 4, 10), 4);
+    EXPECT_EQ(getChunkCount(1000, 4, 0), 4);
+}
+
+TEST_F(ParallelTest, ChunksCoverRangeOnce)
+{
+    DynamicArray<int> visits(1000);
+    DynamicArray<size_t> owners(1000);
+
+    parallelFor(visits.getSize(), 7, [&](size_t begin, size_t end, size_t chunk) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+            owners[i] = chunk;
+        }
+    });
+
+    for (size_t i = 0; i < visits.getSize(); ++i) {
+        ASSERT_EQ(visits[i], 1);
+        ASSERT_GE(i, owners[i] * 1000 / 7);
+        ASSERT_LT(i, (owners[i] + 1) * 1000 / 7);
+    }
+}
+
+TEST_F(ParallelTest, ExceptionOfCallingThreadChunkIsRethrownAfterJoining)
+{
+    std::atomic<size_t> finished(0);
+
+    EXPECT_THROW(parallelFor(100, 4, [&](size_t, size_t, size_t chunk) {
+        if (chunk == 0)
+            throw std::runtime_error("chunk 0");
+
+        finished++;
+    }), std::runtime_error);
+
+    EXPECT_EQ(finished.load(), 3);
+}
+
+TEST_F(ParallelTest, ExceptionOfWorkerChunkIsRethrown)
+{
+    std::atomic<size_t> finished(0);
+
+    EXPECT_THROW(parallelFor(100, 4, [&](size_t, size_t, size_t chunk) {
+        if (chunk == 2)
+            throw std::logic_error("chunk 2");
+
+        finished++;
+    }), std::logic_error);
+
+    EXPECT_EQ(finished.load(), 3);
+}
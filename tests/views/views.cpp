@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <dsa/structures/arrays/dynamic_array.h>
+#include <dsa/structures/arrays/static_array.h>
+#include <dsa/utility/instrumentation.h>
+#include <dsa/views/views.h>
+
+using dsa::structures::arrays::DynamicArray;
+using dsa::structures::arrays::StaticArray;
+using namespace dsa::views;
+
+class ViewsTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override {
+        }
+
+        void TearDown() override {
+        }
+};
+
+TEST_F(ViewsTest, MapFilterCollect)
+{
+    DynamicArray<int> arr{1, 2, 3, 4, 5, 6};
+
+    DynamicArray<int> result = arr
+        | map([](int value) { return value * value; })
+        | filter([](int value) { return value % 2 == 0; })
+        | collect();
+
+    EXPECT_EQ(result.getSize(), 3);
+    EXPECT_EQ(result[0], 4);
+    EXPECT_EQ(result[1], 16);
+    EXPECT_EQ(result[2], 36);
+}
+
+TEST_F(ViewsTest, TakeStopsEarly)
+{
+    StaticArray<int, 6> arr{1, 2, 3, 4, 5, 6};
+    int calls = 0;
+
+    DynamicArray<int> result = arr
+        | map([&calls](int value) { calls++; return value * 10; })
+        | take(2)
+        | collect();
+
+    EXPECT_EQ(result.getSize(), 2);
+    EXPECT_EQ(result[1], 20);
+    EXPECT_EQ(calls, 2);
+
+    EXPECT_EQ((arr | take(100) | collect()).getSize(), 6);
+    EXPECT_EQ((arr | take(0) | collect()).getSize(), 0);
+}
+
+TEST_F(ViewsTest, FilterThenTake)
+{
+    DynamicArray<int> arr{1, 2, 3, 4, 5, 6, 7, 8};
+
+    DynamicArray<int> result = arr
+        | filter([](int value) { return value % 3 != 0; })
+        | take(4)
+        | collect();
+
+    EXPECT_EQ(result.getSize(), 4);
+    EXPECT_EQ(result[2], 4);
+    EXPECT_EQ(result[3], 5);
+}
+
+TEST_F(ViewsTest, ZipStopsAtShorterRange)
+{
+    DynamicArray<int> numbers{1, 2, 3};
+    StaticArray<std::string, 2> names{"one", "two"};
+
+    DynamicArray<std::pair<int, std::string>> result = zip(numbers, names) | collect();
+
+    EXPECT_EQ(result.getSize(), 2);
+    EXPECT_EQ(result[1].first, 2);
+    EXPECT_EQ(result[1].second, "two");
+}
+
+TEST_F(ViewsTest, ZipAllowsWritesThroughReferences)
+{
+    DynamicArray<int> source{1, 2, 3};
+    DynamicArray<int> target(3);
+
+    for (auto pair : zip(source, target)) {
+        pair.second = pair.first * 2;
+    }
+
+    EXPECT_EQ(target[2], 6);
+}
+
+TEST_F(ViewsTest, EnumerateAndComposition)
+{
+    const DynamicArray<char> letters{'a', 'b', 'c', 'd'};
+    std::string visited;
+
+    for (auto entry : letters | enumerate() | filter([](const auto& pair) { return pair.first % 2 == 1; })) {
+        visited += std::to_string(entry.first) + entry.second;
+    }
+
+    EXPECT_EQ(visited, "1b3d");
+
+    auto pairs = zip(letters, letters | map([](char c) { return c - 'a'; })) | take(3);
+    DynamicArray<std::pair<char, int>> collected = pairs | collect();
+
+    EXPECT_EQ(collected.getSize(), 3);
+    EXPECT_EQ(collected[2].second, 2);
+}
+
+TEST_F(ViewsTest, ViewsDoNotAllocateUntilCollect)
+{
+    using namespace dsa::utility::instrumentation;
+
+    DynamicArray<int> arr{1, 2, 3, 4, 5, 6, 7, 8};
+    Statistics before = getGlobalStatistics();
+    int sum = 0;
+
+    auto view = arr | map([](int value) { return value + 1; }) | filter([](int value) { return value > 4; }) | take(3);
+
+    for (int value : view) {
+        sum += value;
+    }
+
+    EXPECT_EQ(sum, 5 + 6 + 7);
+    EXPECT_EQ((getGlobalStatistics() - before).allocations, 0);
+
+    DynamicArray<int> result = view | collect();
+
+    EXPECT_EQ(result.getSize(), 3);
+
+    if (isEnabled()) {
+        EXPECT_EQ((getGlobalStatistics() - before).allocations, 1);
+    }
+}
+
+TEST_F(ViewsTest, CollectLargeViewGrowsGeometrically)
+{
+    DynamicArray<int> arr(1000);
+    DynamicArray<int> result = arr | enumerate() | map([](const auto& pair) { return static_cast<int>(pair.first); }) | collect();
+
+    EXPECT_EQ(result.getSize(), 1000);
+    EXPECT_EQ(result[999], 999);
+    EXPECT_LE(result.getCapacity(), 2048);
+}